@@ -5,6 +5,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
 
@@ -16,7 +17,21 @@ SphenixClient::SphenixClient(const std::string& gt_name)
 
 nlohmann::json SphenixClient::getPayloadIOVs(long long iov)
 {
-  return nopayloadclient::NoPayloadClient::getPayloadIOVs(0, iov);
+  auto iter = m_PayloadIovCache.find(iov);
+  if (iter != m_PayloadIovCache.end())
+  {
+    return {{"code", 0}, {"msg", iter->second}};
+  }
+  if (m_Offline)
+  {
+    return nopayloadclient::DataBaseException("iov " + std::to_string(iov) + " not in snapshot").jsonify();
+  }
+  nlohmann::json resp = nopayloadclient::NoPayloadClient::getPayloadIOVs(0, iov);
+  if (resp["code"] == 0)
+  {
+    m_PayloadIovCache[iov] = resp["msg"];
+  }
+  return resp;
 }
 
 nlohmann::json SphenixClient::getUrl(const std::string& pl_type, long long iov)
@@ -45,10 +60,11 @@ nlohmann::json SphenixClient::getUrl(const std::string& pl_type, long long iov)
     return nopayloadclient::DataBaseException("No valid payload with type " + pl_type).jsonify();
   }
   std::string payloadurl = payload_iov["payload_url"];
+  long long iov_start = payload_iov["minor_iov_start"];
   //  std::cout << "payload url: " << payloadurl << std::endl;
   // the makeResp(T msg)  creates always problems when just doing
   // makeResp(payload_iov["payload_url"] ) we get unresolved externals in non optimized code
-  return {{"code", 0}, {"msg", payloadurl}};
+  return {{"code", 0}, {"msg", payloadurl}, {"iov_start", iov_start}};
 }
 
 nlohmann::json SphenixClient::getUrlDict(long long iov)
@@ -78,15 +94,23 @@ nlohmann::json SphenixClient::getUrlDict(long long iov)
 
 nlohmann::json SphenixClient::deletePayloadIOV(const std::string& pl_type, long long iov_start)
 {
+  clearCache();
   return nopayloadclient::NoPayloadClient::deletePayloadIOV(pl_type, 0, iov_start);
 }
 
 nlohmann::json SphenixClient::deletePayloadIOV(const std::string& pl_type, long long iov_start, long long iov_end)
 {
+  clearCache();
   return nopayloadclient::NoPayloadClient::deletePayloadIOV(pl_type, 0, iov_start, 0, iov_end);
 }
 
 std::string SphenixClient::getCalibration(const std::string& pl_type, long long iov)
+{
+  long long iov_start = 0;
+  return getCalibration(pl_type, iov, iov_start);
+}
+
+std::string SphenixClient::getCalibration(const std::string& pl_type, long long iov, long long& iov_start)
 {
   nlohmann::json resp = getUrl(pl_type, iov);
   if (resp["code"] != 0)
@@ -97,6 +121,7 @@ std::string SphenixClient::getCalibration(const std::string& pl_type, long long
     }
     return "";
   }
+  iov_start = resp["iov_start"];
   return resp["msg"];
 }
 
@@ -123,12 +148,14 @@ nlohmann::json SphenixClient::lockGlobalTag(const std::string& gt_name)
 nlohmann::json SphenixClient::insertPayload(const std::string& pl_type, const std::string& file_url,
                                             long long iov_start)
 {
+  clearCache();
   return nopayloadclient::NoPayloadClient::insertPayload(pl_type, file_url, 0, iov_start);
 }
 
 nlohmann::json SphenixClient::insertPayload(const std::string& pl_type, const std::string& file_url,
                                             long long iov_start, long long iov_end)
 {
+  clearCache();
   return nopayloadclient::NoPayloadClient::insertPayload(pl_type, file_url, 0, iov_start, 0, iov_end);
 }
 
@@ -143,6 +170,7 @@ nlohmann::json SphenixClient::setGlobalTag(const std::string& gt_name)
   if (existGlobalTag(gt_name))
   {
     m_CachedGlobalTag = gt_name;
+    clearCache();
     return nopayloadclient::NoPayloadClient::setGlobalTag(gt_name);
   }
 
@@ -158,6 +186,7 @@ int SphenixClient::cache_set_GlobalTag(const std::string& tagname)
     return iret;
   }
   m_CachedGlobalTag = tagname;
+  clearCache();
   nopayloadclient::NoPayloadClient::setGlobalTag(tagname);
   bool found_gt = false;
   nlohmann::json resp = nopayloadclient::NoPayloadClient::getGlobalTags();
@@ -246,3 +275,66 @@ bool SphenixClient::existGlobalTag(const std::string& gt_name)
   }
   return false;
 }
+
+void SphenixClient::clearCache()
+{
+  // in offline mode the snapshot is the only source of payloads
+  if (!m_Offline)
+  {
+    m_PayloadIovCache.clear();
+  }
+}
+
+int SphenixClient::readSnapshot(const std::string& filename)
+{
+  std::ifstream infile(filename);
+  if (!infile.is_open())
+  {
+    std::cout << "SphenixClient: could not open snapshot " << filename << std::endl;
+    return -1;
+  }
+  nlohmann::json snapshot = nlohmann::json::parse(infile, nullptr, false);
+  if (snapshot.is_discarded() || !snapshot.contains("global_tag") || !snapshot.contains("iovs"))
+  {
+    std::cout << "SphenixClient: " << filename << " is not a valid snapshot" << std::endl;
+    return -1;
+  }
+  std::string gt_name = snapshot["global_tag"];
+  if (!m_CachedGlobalTag.empty() && gt_name != m_CachedGlobalTag)
+  {
+    std::cout << "SphenixClient: snapshot " << filename << " was made for global tag " << gt_name
+              << ", not " << m_CachedGlobalTag << std::endl;
+    return -1;
+  }
+  m_CachedGlobalTag = gt_name;
+  m_PayloadIovCache.clear();
+  for (auto& it : snapshot["iovs"].items())
+  {
+    m_PayloadIovCache[std::stoll(it.key())] = it.value();
+  }
+  m_Offline = true;
+  if (m_Verbosity > 0)
+  {
+    std::cout << "SphenixClient: read " << m_PayloadIovCache.size() << " iovs from snapshot " << filename << std::endl;
+  }
+  return 0;
+}
+
+int SphenixClient::writeSnapshot(const std::string& filename) const
+{
+  nlohmann::json snapshot;
+  snapshot["global_tag"] = m_CachedGlobalTag;
+  snapshot["iovs"] = nlohmann::json::object();
+  for (const auto& [iov, payload_iovs] : m_PayloadIovCache)
+  {
+    snapshot["iovs"][std::to_string(iov)] = payload_iovs;
+  }
+  std::ofstream outfile(filename);
+  if (!outfile.is_open())
+  {
+    std::cout << "SphenixClient: could not open snapshot " << filename << " for writing" << std::endl;
+    return -1;
+  }
+  outfile << snapshot.dump(1) << std::endl;
+  return 0;
+}
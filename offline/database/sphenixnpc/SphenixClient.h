@@ -5,6 +5,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <map>
 #include <set>
 #include <string>
 
@@ -29,6 +30,7 @@ class SphenixClient : public nopayloadclient::NoPayloadClient
   nlohmann::json insertPayload(const std::string& pl_type, const std::string& file_url, long long iov_start, long long iov_end) override;
   nlohmann::json setGlobalTag(const std::string& name) override;
   std::string getCalibration(const std::string& pl_type, long long iov);
+  std::string getCalibration(const std::string& pl_type, long long iov, long long& iov_start);
   nlohmann::json unlockGlobalTag(const std::string& gt_name) override;
   nlohmann::json lockGlobalTag(const std::string& gt_name) override;
   nlohmann::json deletePayloadIOV(const std::string& pl_type, long long iov_start, long long iov_end) override;
@@ -37,14 +39,25 @@ class SphenixClient : public nopayloadclient::NoPayloadClient
   int createDomain(const std::string& domain);
   int cache_set_GlobalTag(const std::string& name);
   bool isGlobalTagSet();
+  // payload lookups of all domains for a given iov are cached, so resolving
+  // many domains costs a single database query. Snapshots save these lookups
+  // to a json file, reading a snapshot switches the client to offline mode
+  // where the database is never contacted
+  int readSnapshot(const std::string& filename);
+  int writeSnapshot(const std::string& filename) const;
+  bool isOffline() const { return m_Offline; }
+  void clearCache();
+
   void Verbosity(int i) { m_Verbosity = i; }
   int Verbosity() const { return m_Verbosity; }
 
  private:
   int m_Verbosity = 0;
+  bool m_Offline = false;
   std::string m_CachedGlobalTag;
   std::set<std::string> m_DomainCache;
   std::set<std::string> m_GlobalTagCache;
+  std::map<long long, nlohmann::json> m_PayloadIovCache;
 };
 
 #endif  // SPHENIXNPC_SPHENIXCLIENT_H
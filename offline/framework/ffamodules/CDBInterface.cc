@@ -20,8 +20,11 @@
 
 #include <TSystem.h>
 
+#include <chrono>
 #include <cstdint>   // for uint64_t
+#include <filesystem>
 #include <iostream>  // for operator<<, basic_ostream, endl
+#include <system_error>
 #include <utility>   // for pair
 #include <vector>    // for vector
 
@@ -56,6 +59,10 @@ CDBInterface::~CDBInterface()
 int CDBInterface::End(PHCompositeNode *topNode)
 {
   int iret = UpdateRunNode(topNode);PHNodeIterator iter(topNode);
+  if (Verbosity() > 0)
+  {
+    Print("TIMING");
+  }
   return iret;
 }
 
@@ -110,14 +117,106 @@ int CDBInterface::UpdateRunNode(PHCompositeNode *topNode)
 }
 
 //____________________________________________________________________________..
-void CDBInterface::Print(const std::string & /* what */) const
+void CDBInterface::Print(const std::string &what) const
+{
+  if (what == "ALL" || what == "URL")
+  {
+    for (const auto &iter : m_UrlVector)
+    {
+      std::cout << "domain: " << std::get<0>(iter)
+                << ", url: " << std::get<1>(iter)
+                << ", timestamp: " << std::get<2>(iter) << std::endl;
+    }
+  }
+  if (what == "ALL" || what == "TIMING")
+  {
+    std::cout << Name() << ": " << m_NumLookups << " lookups took " << m_LookupTime << " s";
+    if (!m_LocalCacheDir.empty())
+    {
+      std::cout << ", local cache " << m_LocalCacheDir << ": " << m_CacheHits << " hits, "
+                << m_CacheCopies << " copies";
+    }
+    if (!m_SnapshotFile.empty())
+    {
+      std::cout << ", from snapshot " << m_SnapshotFile;
+    }
+    std::cout << std::endl;
+  }
+}
+
+void CDBInterface::Prefetch(const std::vector<std::string> &domains)
+{
+  for (const auto &domain : domains)
+  {
+    getUrl(domain);
+  }
+}
+
+int CDBInterface::WriteSnapshot(const std::string &filename)
+{
+  if (!cdbclient)
+  {
+    std::cout << PHWHERE << " no calibrations were looked up, not writing " << filename << std::endl;
+    return -1;
+  }
+  return cdbclient->writeSnapshot(filename);
+}
+
+SphenixClient *CDBInterface::client()
+{
+  if (cdbclient)
+  {
+    return cdbclient;
+  }
+  recoConsts *rc = recoConsts::instance();
+  cdbclient = new SphenixClient(rc->get_StringFlag("CDB_GLOBALTAG"));
+  if (!m_SnapshotFile.empty())
+  {
+    if (cdbclient->readSnapshot(m_SnapshotFile))
+    {
+      std::cout << PHWHERE << " could not read calibration snapshot " << m_SnapshotFile << std::endl;
+      gSystem->Exit(1);
+    }
+  }
+  return cdbclient;
+}
+
+// payload files are copied under a temporary name and renamed, so that jobs
+// sharing the cache directory never open a partially copied file.
+// Urls which are not local files (e.g. xrootd) are returned as is
+std::string CDBInterface::stageLocal(const std::string &globaltag, const std::string &domain, const long long iov_start, const std::string &url)
 {
-  for (const auto &iter : m_UrlVector)
+  std::error_code ec;
+  const std::filesystem::path source(url);
+  if (!std::filesystem::is_regular_file(source, ec))
   {
-    std::cout << "domain: " << std::get<0>(iter)
-              << ", url: " << std::get<1>(iter)
-              << ", timestamp: " << std::get<2>(iter) << std::endl;
+    return url;
   }
+  const std::filesystem::path target = std::filesystem::path(m_LocalCacheDir) / globaltag / domain / std::to_string(iov_start) / source.filename();
+  if (std::filesystem::exists(target, ec))
+  {
+    m_CacheHits++;
+    return target.string();
+  }
+  std::filesystem::create_directories(target.parent_path(), ec);
+  std::filesystem::path tmpfile = target;
+  tmpfile += "." + std::to_string(gSystem->GetPid()) + ".tmp";
+  std::filesystem::copy_file(source, tmpfile, std::filesystem::copy_options::overwrite_existing, ec);
+  if (!ec)
+  {
+    std::filesystem::rename(tmpfile, target, ec);
+  }
+  if (ec)
+  {
+    if (Verbosity() > 0)
+    {
+      std::cout << PHWHERE << " could not cache " << url << " in " << target << ": " << ec.message() << std::endl;
+    }
+    std::filesystem::remove(tmpfile, ec);
+    return url;
+  }
+  m_CacheCopies++;
+  return target.string();
 }
 
 std::string CDBInterface::getUrl(const std::string &domain, const std::string &filename)
@@ -140,10 +239,8 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
     std::cout << "rc->set_uint64Flag(\"TIMESTAMP\",<64 bit timestamp>)" << std::endl;
     gSystem->Exit(1);
   }
-  if (cdbclient == nullptr)
-  {
-    cdbclient = new SphenixClient(rc->get_StringFlag("CDB_GLOBALTAG"));
-  }
+  const auto start = std::chrono::steady_clock::now();
+  client();
   uint64_t timestamp = rc->get_uint64Flag("TIMESTAMP");
   if (Verbosity() > 0)
   {
@@ -151,14 +248,17 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
               << ", domain: " << domain_noconst
               << ", timestamp: " << timestamp;
   }
-  std::string return_url = cdbclient->getCalibration(domain_noconst, timestamp);
+  long long iov_start = 0;
+  std::string return_url = cdbclient->getCalibration(domain_noconst, timestamp, iov_start);
+  bool from_cdb = !return_url.empty();
   if (return_url.empty())
   {
     if (!disable_default)
     {
       std::string domain_copy = domain_noconst;
       domain_noconst = domain_noconst + "_default";
-      return_url = cdbclient->getCalibration(domain_noconst, timestamp);
+      return_url = cdbclient->getCalibration(domain_noconst, timestamp, iov_start);
+      from_cdb = !return_url.empty();
       if (return_url.empty())
       {
         if (Verbosity() > 0)
@@ -194,5 +294,11 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
 		<< ", time stamp: " << timestamp << std::endl;
     }
   }
+  if (from_cdb && !m_LocalCacheDir.empty())
+  {
+    return_url = stageLocal(rc->get_StringFlag("CDB_GLOBALTAG"), domain_noconst, iov_start, return_url);
+  }
+  m_NumLookups++;
+  m_LookupTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
   return return_url;
 }
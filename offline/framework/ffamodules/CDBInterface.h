@@ -9,6 +9,7 @@
 #include <set>
 #include <string>
 #include <tuple>  // for tuple
+#include <vector>
 
 class SphenixClient;
 
@@ -34,14 +35,39 @@ class CDBInterface : public SubsysReco
 
   std::string getUrl(const std::string &domain, const std::string &filename = "");
 
+  /// resolve all domains a macro needs up front. All domains are resolved by a single
+  /// database query and their payloads are staged in the local cache
+  void Prefetch(const std::vector<std::string> &domains);
+
+  /// copy payload files into this directory (keyed by global tag, domain and iov start)
+  /// and hand out the local copies. Jobs on the same node share the copies
+  void LocalCacheDir(const std::string &dir) { m_LocalCacheDir = dir; }
+
+  /// offline mode: resolve calibrations from a snapshot file written by WriteSnapshot,
+  /// the database is never contacted. Must be set before the first getUrl
+  void ReadSnapshot(const std::string &filename) { m_SnapshotFile = filename; }
+
+  /// save all lookups done so far for use with ReadSnapshot
+  int WriteSnapshot(const std::string &filename);
+
  private:
   CDBInterface(const std::string &name = "CDBInterface");
 
+  SphenixClient *client();
+  std::string stageLocal(const std::string &globaltag, const std::string &domain, const long long iov_start, const std::string &url);
+
   static CDBInterface *__instance;
   SphenixClient *cdbclient{nullptr};
   bool disable{false};
   bool disable_default{false};
   std::set<std::tuple<std::string, std::string, uint64_t>> m_UrlVector;
+  std::string m_LocalCacheDir;
+  std::string m_SnapshotFile;
+  // time spent in calibration lookups
+  double m_LookupTime{0};
+  unsigned int m_NumLookups{0};
+  unsigned int m_CacheHits{0};
+  unsigned int m_CacheCopies{0};
 };
 
 #endif  // FFAMODULES_CDBINTERFACE_H
@@ -4,6 +4,7 @@
 #include <TClonesArray.h>
 
 #include <iostream>
+#include <utility>
 
 static const int NTPCHITS = 10000;
 
@@ -46,25 +47,28 @@ unsigned int TpcRawHitContainerv3::get_nhits()
   return TpcRawHitsTCArray->GetEntriesFast();
 }
 
+// slots cleared by Reset are reused rather than constructed over,
+// so that the waveform buffers they keep are not leaked
 TpcRawHit *TpcRawHitContainerv3::AddHit()
 {
-  TpcRawHit *newhit = new ((*TpcRawHitsTCArray)[TpcRawHitsTCArray->GetLast() + 1]) TpcRawHitv3();
+  TpcRawHit *newhit = static_cast<TpcRawHit *>(TpcRawHitsTCArray->ConstructedAt(TpcRawHitsTCArray->GetLast() + 1));  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
   return newhit;
 }
 
 TpcRawHit *TpcRawHitContainerv3::AddHit(TpcRawHit *tpchit)
 {
+  auto *newhit = static_cast<TpcRawHitv3 *>(TpcRawHitsTCArray->ConstructedAt(TpcRawHitsTCArray->GetLast() + 1));  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
   if (tpchit->IsA() == TpcRawHitv3::Class())
   {
-    // fast add with move constructor to avoid ADC data copying
-
-    TpcRawHit *newhit = new ((*TpcRawHitsTCArray)[TpcRawHitsTCArray->GetLast() + 1])
-        TpcRawHitv3(std::move(*(static_cast<TpcRawHitv3 *>(tpchit))));  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+    // fast add with move assignment to avoid ADC data copying.
+    // tpchit gets back the emptied waveform buffers of the slot
+    *newhit = std::move(*(static_cast<TpcRawHitv3 *>(tpchit)));  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
     return newhit;
   }
 
   std::cout << __PRETTY_FUNCTION__ << "WARNING: input hit is not of type TpcRawHitv3. This is slow, please avoid." << std::endl;
-  TpcRawHit *newhit = new ((*TpcRawHitsTCArray)[TpcRawHitsTCArray->GetLast() + 1]) TpcRawHitv3(tpchit);
+  TpcRawHitv3 converted(tpchit);
+  *newhit = std::move(converted);
   return newhit;
 }
 
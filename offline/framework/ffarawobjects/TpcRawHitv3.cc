@@ -66,6 +66,30 @@ TpcRawHitv3::TpcRawHitv3(TpcRawHitv3 &&other) noexcept
   other.parityerror = true;
 }
 
+TpcRawHitv3 &TpcRawHitv3::operator=(TpcRawHitv3 &&other) noexcept
+{
+  if (this == &other)
+  {
+    return *this;
+  }
+  TpcRawHit::operator=(other);
+  bco = other.bco;
+  packetid = other.packetid;
+  fee = other.fee;
+  channel = other.channel;
+  type = other.type;
+  checksumerror = other.checksumerror;
+  parityerror = other.parityerror;
+  m_adcData.swap(other.m_adcData);
+  m_spareWaveforms.swap(other.m_spareWaveforms);
+
+  other.fee = std::numeric_limits<uint16_t>::max();
+  other.channel = std::numeric_limits<uint16_t>::max();
+  other.checksumerror = true;
+  other.parityerror = true;
+  return *this;
+}
+
 void TpcRawHitv3::identify(std::ostream &os) const
 {
   os << "BCO: 0x" << std::hex << bco << std::dec << std::endl;
@@ -104,18 +128,30 @@ void TpcRawHitv3::Clear(Option_t * /*unused*/)
   checksumerror = true;
   parityerror = true;
 
+  // waveform buffers keep their capacity for the next hit stored in this object
   for (auto &waveform : m_adcData)
   {
     waveform.second.clear();
-    waveform.second.shrink_to_fit();
+    m_spareWaveforms.push_back(std::move(waveform.second));
   }
   m_adcData.clear();
-  m_adcData.shrink_to_fit();
 
   // std::cout << __PRETTY_FUNCTION__ << " - m_adcData.capacity = "<<m_adcData.capacity() << std::endl;
 }
 
 void TpcRawHitv3::move_adc_waveform(const uint16_t start_time, std::vector<uint16_t> &&adc)
 {
-  m_adcData.emplace_back(start_time, adc);
+  m_adcData.emplace_back(start_time, std::move(adc));
+}
+
+void TpcRawHitv3::add_adc_waveform(const uint16_t start_time, const uint16_t *adc, const std::size_t nsamples)
+{
+  std::vector<uint16_t> waveform;
+  if (!m_spareWaveforms.empty())
+  {
+    waveform = std::move(m_spareWaveforms.back());
+    m_spareWaveforms.pop_back();
+  }
+  waveform.assign(adc, adc + nsamples);
+  m_adcData.emplace_back(start_time, std::move(waveform));
 }
@@ -6,6 +6,7 @@
 #include <phool/PHObject.h>
 
 #include <cassert>
+#include <cstddef>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -18,6 +19,9 @@ class TpcRawHitv3 : public TpcRawHit
   explicit TpcRawHitv3(TpcRawHit *tpchit);
   TpcRawHitv3(TpcRawHitv3 &&other) noexcept;
 
+  //! swaps the waveforms, so that other gets back the emptied buffers of this hit
+  TpcRawHitv3 &operator=(TpcRawHitv3 &&other) noexcept;
+
   ~TpcRawHitv3() override = default;
 
   /** identify Function from PHObject
@@ -75,6 +79,9 @@ class TpcRawHitv3 : public TpcRawHit
   //   }
   void move_adc_waveform(const uint16_t start_time, std::vector<uint16_t> &&adc);
 
+  //! copy nsamples adc values to a new waveform, reusing a buffer emptied by Clear when available
+  void add_adc_waveform(const uint16_t start_time, const uint16_t *adc, const std::size_t nsamples);
+
   uint16_t get_type() const override { return type; }
   void set_type(const uint16_t i) override { type = i; }
 
@@ -188,6 +195,9 @@ class TpcRawHitv3 : public TpcRawHit
   //! adc waveform std::vector< uint16_t > for each start time uint16_t
   std::vector<std::pair<uint16_t, std::vector<uint16_t> > > m_adcData;
 
+  //! waveform buffers emptied by Clear, with their capacity, reused by add_adc_waveform
+  std::vector<std::vector<uint16_t> > m_spareWaveforms;  //!
+
   ClassDefOverride(TpcRawHitv3, 2)
 };
 
@@ -22,7 +22,9 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>  // for operator<<, basic_ostream, endl
 #include <utility>   // for pair
@@ -136,6 +138,10 @@ int Fun4AllDstInputManager::fileopen(const std::string &filenam)
     {
       m_IManager->DisableReadCache();
     }
+    else if (m_ReadAheadEntries > 0)
+    {
+      m_IManager->ReadAhead(m_ReadAheadEntries, m_ReadAheadMaxBytes);
+    }
     if (m_IManager->NodeExist(syncdefs::SYNCNODENAME))
     {
       m_HaveSyncObject = 1;
@@ -181,7 +187,7 @@ int Fun4AllDstInputManager::run(const int nevents)
 readagain:
   PHCompositeNode *dummy;
   int ncount = 0;
-  dummy = m_IManager->read(dstNode);
+  dummy = readEvent();
   while (dummy)
   {
     ncount++;
@@ -189,7 +195,7 @@ readagain:
     {
       break;
     }
-    dummy = m_IManager->read(dstNode);
+    dummy = readEvent();
   }
   if (!dummy)
   {
@@ -219,6 +225,7 @@ int Fun4AllDstInputManager::fileclose()
     std::cout << Name() << ": fileclose: No Input file open" << std::endl;
     return -1;
   }
+  addReadAheadStats();
   delete m_IManager;
   m_IManager = nullptr;
   IsOpen(0);
@@ -369,7 +376,7 @@ int Fun4AllDstInputManager::SyncIt(const SyncObject *mastersync)
       // Here the event counter and segment number and run number do agree - we found the right match
       // now read the full event (previously we only read the sync object)
       PHCompositeNode *dummy;
-      dummy = m_IManager->read(dstNode);
+      dummy = readEvent();
       if (!dummy)
       {
         std::cout << PHWHERE << " " << Name() << " Could not read full Event" << std::endl;
@@ -474,7 +481,7 @@ readnextsync:
   }
   else
   {
-    if (m_IManager->read(dstNode))
+    if (readEvent())
     {
       itest = 1;
     }
@@ -614,6 +621,44 @@ void Fun4AllDstInputManager::Print(const std::string &what) const
       std::cout << std::endl;
     }
   }
+  if (what == "ALL" || what == "READAHEAD")
+  {
+    std::cout << "--------------------------------------" << std::endl
+              << std::endl;
+    std::cout << "Input wait in Fun4AllDstInputManager " << Name() << ":" << std::endl;
+    std::cout << "read ahead entries: " << m_ReadAheadEntries;
+    if (m_ReadAheadMaxBytes > 0)
+    {
+      std::cout << ", memory cap: " << m_ReadAheadMaxBytes << " bytes";
+    }
+    std::cout << std::endl;
+    std::cout << "events read: " << m_NumReads
+              << ", total wait: " << m_ReadWaitTime << " s"
+              << ", mean wait: " << (m_NumReads ? m_ReadWaitTime / m_NumReads * 1e3 : 0) << " ms"
+              << ", max wait: " << m_ReadWaitMax * 1e3 << " ms" << std::endl;
+    if (m_ReadAheadEntries > 0)
+    {
+      // the totals only cover closed files, add the open one
+      uint64_t prefetches = m_ReadAheadPrefetches;
+      uint64_t baskets = m_ReadAheadBaskets;
+      uint64_t waits = m_ReadAheadWaits;
+      double waittime = m_ReadAheadWaitTime;
+      double readtime = m_ReadTime;
+      if (m_IManager)
+      {
+        prefetches += m_IManager->ReadAheadPrefetches();
+        baskets += m_IManager->ReadAheadBaskets();
+        waits += m_IManager->ReadAheadWaits();
+        waittime += m_IManager->ReadAheadWaitTime();
+        readtime += m_IManager->ReadTime();
+      }
+      std::cout << "entries prefetched: " << prefetches
+                << ", baskets read ahead: " << baskets << std::endl;
+      std::cout << "waits on read ahead thread: " << waits
+                << ", wait time: " << waittime << " s"
+                << ", time in GetEntry: " << readtime << " s" << std::endl;
+    }
+  }
   if ((what == "ALL" || what == "PHOOL") && m_IManager)
   {
     // loop over the map and print out the content (name and location in memory)
@@ -626,6 +671,40 @@ void Fun4AllDstInputManager::Print(const std::string &what) const
   return;
 }
 
+void Fun4AllDstInputManager::ReadAhead(const unsigned int nentries, const uint64_t maxbytes)
+{
+  if (IsOpen())
+  {
+    std::cout << PHWHERE << " " << Name() << ": read ahead only applies to files opened after this call" << std::endl;
+  }
+  m_ReadAheadEntries = nentries;
+  m_ReadAheadMaxBytes = maxbytes;
+}
+
+PHCompositeNode *Fun4AllDstInputManager::readEvent()
+{
+  const auto start = std::chrono::steady_clock::now();
+  PHCompositeNode *node = m_IManager->read(dstNode);
+  const double wait = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  m_NumReads++;
+  m_ReadWaitTime += wait;
+  m_ReadWaitMax = std::max(m_ReadWaitMax, wait);
+  return node;
+}
+
+void Fun4AllDstInputManager::addReadAheadStats()
+{
+  if (!m_IManager)
+  {
+    return;
+  }
+  m_ReadAheadPrefetches += m_IManager->ReadAheadPrefetches();
+  m_ReadAheadBaskets += m_IManager->ReadAheadBaskets();
+  m_ReadAheadWaits += m_IManager->ReadAheadWaits();
+  m_ReadAheadWaitTime += m_IManager->ReadAheadWaitTime();
+  m_ReadTime += m_IManager->ReadTime();
+}
+
 int Fun4AllDstInputManager::PushBackEvents(const int i)
 {
   if (m_IManager)
@@ -7,6 +7,7 @@
 
 #include <phool/PHNodeIOManager.h>
 
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -27,6 +28,9 @@ class Fun4AllDstInputManager : public Fun4AllInputManager
   int BranchSelect(const std::string &branch, const int iflag) override;
   int setBranches() override;
   void CacheSize(uint64_t size) { m_IManager->CacheSize(size); }
+  //! read and unzip the next nentries entries of the selected branches of this input's tree
+  //! on a background thread, using at most maxbytes of memory (0: no cap)
+  void ReadAhead(const unsigned int nentries, const uint64_t maxbytes = 0);
   virtual int setSyncBranches(PHNodeIOManager *iman);
   void Print(const std::string &what = "ALL") const override;
   int PushBackEvents(const int i) override;
@@ -34,6 +38,10 @@ class Fun4AllDstInputManager : public Fun4AllInputManager
 
  protected:
   int ReadNextEventSyncObject();
+  //! read next event, accounting for the time spent waiting on input
+  PHCompositeNode *readEvent();
+  //! add the read ahead statistics of the current file to the totals, call before deleting the IManager
+  void addReadAheadStats();
   void ReadRunTTree(const int i) { m_ReadRunTTree = i; }
   void IManager(PHNodeIOManager *iman) { m_IManager = iman; }
   PHNodeIOManager *IManager() { return m_IManager; }
@@ -58,6 +66,16 @@ class Fun4AllDstInputManager : public Fun4AllInputManager
   int events_thisfile{0};
   int events_skipped_during_sync{0};
   int m_HaveSyncObject{0};
+  unsigned int m_ReadAheadEntries{0};
+  uint64_t m_ReadAheadMaxBytes{0};
+  uint64_t m_NumReads{0};
+  double m_ReadWaitTime{0};
+  double m_ReadWaitMax{0};
+  uint64_t m_ReadAheadPrefetches{0};
+  uint64_t m_ReadAheadBaskets{0};
+  uint64_t m_ReadAheadWaits{0};
+  double m_ReadAheadWaitTime{0};
+  double m_ReadTime{0};
   std::map<const std::string, int> branchread;
   std::string syncbranchname;
   std::string RunNode{"RUN"};
@@ -11,6 +11,8 @@
 
 #include <TSystem.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <filesystem>
 #include <format>
@@ -92,6 +94,21 @@ void Fun4AllDstOutputManager::Print(const std::string &what) const
       }
     }
   }
+  if (what == "ALL" || what == "WRITESTATS")
+  {
+    std::cout << Name() << ": parallel compression: " << (m_ParallelCompression ? "on" : "off");
+    if (m_FlushBytes > 0)
+    {
+      std::cout << ", basket flush every " << m_FlushBytes << " bytes";
+    }
+    std::cout << std::endl;
+    std::cout << Name() << ": events written: " << m_NumWrites
+              << ", MB written: " << m_BytesWritten / 1e6
+              << ", event loop time in write: " << m_WriteTime << " s"
+              << ", max: " << m_WriteTimeMax * 1e3 << " ms"
+              << ", write rate: " << (m_WriteTime > 0 ? m_BytesWritten / 1e6 / m_WriteTime : 0) << " MB/s"
+              << std::endl;
+  }
   // base class print method
   Fun4AllOutputManager::Print(what);
 
@@ -171,7 +188,14 @@ int Fun4AllDstOutputManager::Write(PHCompositeNode *startNode)
       }
     }
   }
+  const uint64_t bytes_before = dstOut->GetBytesWritten();
+  const auto start = std::chrono::steady_clock::now();
   dstOut->write(startNode);
+  const double writetime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  m_NumWrites++;
+  m_WriteTime += writetime;
+  m_WriteTimeMax = std::max(m_WriteTimeMax, writetime);
+  m_BytesWritten += dstOut->GetBytesWritten() - bytes_before;
   // to save some cpu cycles we only make it globally transient if
   // all nodes have been written (savenodes set is empty)
   // else we only make the nodes transient which we have written (all
@@ -227,6 +251,14 @@ int Fun4AllDstOutputManager::WriteNode(PHCompositeNode *thisNode)
       return 0;
     }
   }
+  if (dstOut)
+  {
+    // keep the node sizes of the file we are about to close
+    for (const auto &[nodename, bytes] : dstOut->GetNodeBytesOnDisk())
+    {
+      m_NodeBytes[nodename] += bytes;
+    }
+  }
   delete dstOut;
 
   if (UsedOutFileName().empty())
@@ -309,6 +341,24 @@ int Fun4AllDstOutputManager::WriteNode(PHCompositeNode *thisNode)
   return 0;
 }
 
+uint64_t Fun4AllDstOutputManager::NodeBytesOnDisk(const std::string &nodename)
+{
+  uint64_t bytes = 0;
+  if (auto iter = m_NodeBytes.find(nodename); iter != m_NodeBytes.end())
+  {
+    bytes += iter->second;
+  }
+  if (dstOut)
+  {
+    const auto nodebytes = dstOut->GetNodeBytesOnDisk();
+    if (auto iter = nodebytes.find(nodename); iter != nodebytes.end())
+    {
+      bytes += iter->second;
+    }
+  }
+  return bytes;
+}
+
 int Fun4AllDstOutputManager::outfile_open_first_write()
 {
   delete dstOut;
@@ -355,6 +405,8 @@ int Fun4AllDstOutputManager::outfile_open_first_write()
   }
 
   dstOut->SetCompressionSetting(m_CompressionSetting);
+  dstOut->ParallelCompression(m_ParallelCompression);
+  dstOut->AutoFlushBytes(m_FlushBytes);
   return 0;
 }
 
@@ -5,6 +5,8 @@
 
 #include "Fun4AllOutputManager.h"
 
+#include <cstdint>
+#include <map>
 #include <set>
 #include <string>
 
@@ -36,7 +38,19 @@ class Fun4AllDstOutputManager : public Fun4AllOutputManager
   const std::string &UsedOutFileName() const { return m_UsedOutFileName; }
   void CompressionSetting(const int i) override { m_CompressionSetting = i; }
   void InitializeLastEvent(int eventnumber) override;
-  
+  //! compress the baskets of the branches of this output tree concurrently (TTree::SetImplicitMT)
+  //! or serially (off, the default). The ROOT implicit MT pool has to be enabled by the macro
+  //! (ROOT::EnableImplicitMT). Entries, their order and the basket boundaries are the same as
+  //! in the serial write, only the order of the baskets in the file may differ.
+  //! Baskets are still written out synchronously from Write()
+  void ParallelCompression(const bool flag) { m_ParallelCompression = flag; }
+  //! flush the baskets whenever maxbytes are buffered instead of the ROOT default auto flush,
+  //! this bounds the memory but changes the cluster layout of the file
+  void BasketFlushBytes(const uint64_t maxbytes) { m_FlushBytes = maxbytes; }
+  //! compressed bytes written for a node, summed over the output files. The pending
+  //! baskets of the open file are flushed to get its share
+  uint64_t NodeBytesOnDisk(const std::string &nodename);
+
  private:
   int outfile_open_first_write();
   PHNodeIOManager *dstOut{nullptr};
@@ -44,6 +58,14 @@ class Fun4AllDstOutputManager : public Fun4AllOutputManager
   int m_SaveDstNodeFlag{1};
   int m_CompressionSetting{505};
   bool m_LastEventInitialized{false};
+  bool m_ParallelCompression{false};
+  uint64_t m_FlushBytes{0};
+  uint64_t m_NumWrites{0};
+  uint64_t m_BytesWritten{0};
+  double m_WriteTime{0};
+  double m_WriteTimeMax{0};
+  //! compressed bytes per node of the closed output files
+  std::map<std::string, uint64_t> m_NodeBytes;
   std::string m_FileNameStem;
   std::string m_UsedOutFileName;
   std::set<std::string> savenodes;
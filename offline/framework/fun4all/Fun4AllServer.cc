@@ -266,6 +266,7 @@ int Fun4AllServer::registerSubsystem(SubsysReco *subsystem, const std::string &t
     std::cout << "Registering Subsystem " << subsystem->Name() << std::endl;
   }
   Subsystems.push_back(newsubsyspair);
+  m_DispatchTableValid = false;
   std::string timer_name;
   timer_name = subsystem->Name() + "_" + topnodename;
   PHTimer timer(timer_name);
@@ -318,6 +319,7 @@ int Fun4AllServer::unregisterSubsystemsNow()
                 << " at index " << index << std::endl;
     }
     Subsystems.erase(Subsystems.begin() + index);
+    m_DispatchTableValid = false;
     delete (*removeiter).first;
     // also update the vector with return codes
     RetCodes.erase(RetCodes.begin() + index);
@@ -504,6 +506,36 @@ TNamed *Fun4AllServer::getHisto(const std::string &hname) const
   return (ServerHistoManager->getHisto(hname));
 }
 
+void Fun4AllServer::BuildDispatchTable()
+{
+  m_DispatchTable.clear();
+  m_DispatchTable.reserve(Subsystems.size());
+  for (auto &Subsystem : Subsystems)
+  {
+    SubsysDispatch dispatch;
+    std::string newdirname = Subsystem.second->getName() + "/" + Subsystem.first->Name();
+    dispatch.dir = gROOT->GetDirectory(newdirname.c_str());
+    if (!dispatch.dir)
+    {
+      std::cout << PHWHERE << "Unexpected TDirectory Problem cd'ing to "
+                << Subsystem.second->getName()
+                << " - send e-mail to off-l with your macro" << std::endl;
+      exit(1);
+    }
+    dispatch.timer_name = Subsystem.first->Name() + "_" + Subsystem.second->getName();
+    // map nodes are stable, the timer pointer stays valid
+    auto titer = timer_map.find(dispatch.timer_name);
+    if (titer == timer_map.end())
+    {
+      std::cout << "could not find timer for " << dispatch.timer_name << ", creating it" << std::endl;
+      titer = timer_map.insert(std::make_pair(dispatch.timer_name, PHTimer(dispatch.timer_name))).first;
+    }
+    dispatch.timer = &titer->second;
+    m_DispatchTable.push_back(dispatch);
+  }
+  m_DispatchTableValid = true;
+}
+
 int Fun4AllServer::process_event()
 {
   eventcounter++;
@@ -530,6 +562,10 @@ int Fun4AllServer::process_event()
   {
     unregisterSubsystemsNow();
   }
+  if (!m_DispatchTableValid)
+  {
+    BuildDispatchTable();
+  }
   gROOT->cd(default_Tdirectory.c_str());
   std::string currdir = gDirectory->GetPath();
   for (auto &Subsystem : Subsystems)
@@ -538,42 +574,20 @@ int Fun4AllServer::process_event()
     {
       std::cout << "Fun4AllServer::process_event processing " << Subsystem.first->Name() << std::endl;
     }
-    std::string newdirname = Subsystem.second->getName() + "/" + Subsystem.first->Name();
-    if (!gROOT->cd(newdirname.c_str()))
-    {
-      std::cout << PHWHERE << "Unexpected TDirectory Problem cd'ing to "
-                << Subsystem.second->getName()
-                << " - send e-mail to off-l with your macro" << std::endl;
-      exit(1);
-    }
-    else
+    const SubsysDispatch &dispatch = m_DispatchTable[icnt];
+    dispatch.dir->cd();
+    if (Verbosity() >= VERBOSITY_EVEN_MORE)
     {
-      if (Verbosity() >= VERBOSITY_EVEN_MORE)
-      {
-        std::cout << "process_event: cded to " << newdirname << std::endl;
-      }
+      std::cout << "process_event: cded to " << dispatch.dir->GetPath() << std::endl;
     }
 
-    PHTimer subsystem_timer("SubsystemTimer");
-    subsystem_timer.restart();
+    m_SubsystemTimer.restart();
 
     try
     {
-      std::string timer_name;
-      timer_name = Subsystem.first->Name() + "_" + Subsystem.second->getName();
-      std::map<const std::string, PHTimer>::iterator titer = timer_map.find(timer_name);
-      bool timer_found = false;
-      if (titer != timer_map.end())
-      {
-        timer_found = true;
-        titer->second.restart();
-      }
-      else
-      {
-        std::cout << "could not find timer for " << timer_name << std::endl;
-      }
+      dispatch.timer->restart();
 #ifdef FFAMEMTRACKER
-      ffamemtracker->Start(timer_name, "SubsysReco");
+      ffamemtracker->Start(dispatch.timer_name, "SubsysReco");
       ffamemtracker->Snapshot("Fun4AllServerProcessEvent");
 #endif
       int retcode = Subsystem.first->process_event(Subsystem.second);
@@ -596,12 +610,9 @@ int Fun4AllServer::process_event()
         std::cout << "error: " << e.what() << std::endl;
         gSystem->Exit(1);
       }
-      if (timer_found)
-      {
-        titer->second.stop();
-      }
+      dispatch.timer->stop();
 #ifdef FFAMEMTRACKER
-      ffamemtracker->Stop(timer_name, "SubsysReco");
+      ffamemtracker->Stop(dispatch.timer_name, "SubsysReco");
 #endif
     }
     catch (const std::exception &e)
@@ -661,12 +672,13 @@ int Fun4AllServer::process_event()
         return Fun4AllReturnCodes::ABORTRUN;
       }
     }
-    subsystem_timer.stop();
-    double TimeSubsystem = subsystem_timer.elapsed();
+    m_SubsystemTimer.stop();
     if (Verbosity() >= VERBOSITY_MORE)
     {
       std::cout << "Fun4AllServer::process_event processing " << Subsystem.first->Name()
-                << " processing total time: " << TimeSubsystem << " ms" << std::endl;
+                << " processing total time: " << m_SubsystemTimer.elapsed() << " ms" << std::endl;
+      std::cout << "Fun4AllServer::process_event processing " << Subsystem.first->Name()
+                << " process_event time: " << dispatch.timer->elapsed() << " ms" << std::endl;
     }
     icnt++;
   }
@@ -127,6 +127,7 @@ class Fun4AllServer : public Fun4AllBase
   int UpdateEventSelector(Fun4AllOutputManager *manager);
   int unregisterSubsystemsNow();
   int setRun(const int runno);
+  void BuildDispatchTable();
   static Fun4AllServer *__instance;
   TH1 *FrameWorkVars{nullptr};
   Fun4AllMemoryTracker *ffamemtracker{nullptr};
@@ -159,6 +160,19 @@ class Fun4AllServer : public Fun4AllBase
   std::vector<Fun4AllSyncManager *> SyncManagers;
   std::map<int, int> retcodesmap;
   std::map<const std::string, PHTimer> timer_map;
+
+  //! per subsystem handles used in process_event, resolved once after the list of subsystems changes
+  struct SubsysDispatch
+  {
+    TDirectory *dir{nullptr};
+    PHTimer *timer{nullptr};
+    std::string timer_name;  // also the memory tracker name
+  };
+  std::vector<SubsysDispatch> m_DispatchTable;
+  bool m_DispatchTableValid{false};
+
+  //! total time spent on a subsystem in process_event, including return code handling
+  PHTimer m_SubsystemTimer{"SubsystemTimer"};
 };
 
 #endif
@@ -45,6 +45,8 @@
 #include <cstdlib>
 #include <format>
 #include <iostream>  // for operator<<, basic_ostream, endl
+#include <map>
+#include <set>
 #include <utility>   // for pair
 
 Fun4AllStreamingInputManager::Fun4AllStreamingInputManager(const std::string &name, const std::string &dstnodename, const std::string &topnodename)
@@ -82,10 +84,6 @@ Fun4AllStreamingInputManager::~Fun4AllStreamingInputManager()
     {
       delete mvtxhititer;
     }
-    for (auto *mvtxFeeIdInfo : mapiter.second.MvtxFeeIdInfoVector)
-    {
-      delete mvtxFeeIdInfo;
-    }
   }
   m_MvtxRawHitMap.clear();
 
@@ -269,6 +267,14 @@ void Fun4AllStreamingInputManager::Print(const std::string &what) const
       }
     }
   }
+  if (what == "ALL" || what == "BUFFERS")
+  {
+    m_Gl1RawHitMap.PrintStats("Gl1");
+    m_InttRawHitMap.PrintStats("Intt");
+    m_MicromegasRawHitMap.PrintStats("Micromegas");
+    m_MvtxRawHitMap.PrintStats("Mvtx");
+    m_TpcRawHitMap.PrintStats("Tpc");
+  }
   if (what == "ALL" || what == "INPUTFILES")
   {
     std::cout << "-----------------------------" << std::endl;
@@ -509,11 +515,10 @@ void Fun4AllStreamingInputManager::AddMvtxFeeIdInfo(uint64_t bclk, uint16_t feei
     std::cout << "Adding mvtx feeid info to bclk 0x"
               << std::hex << bclk << std::dec << std::endl;
   }
-  MvtxFeeIdInfo *feeidInfo = new MvtxFeeIdInfov1();
-  feeidInfo->set_bco(bclk);
-  feeidInfo->set_feeId(feeid);
-  feeidInfo->set_detField(detField);
-  m_MvtxRawHitMap[bclk].MvtxFeeIdInfoVector.push_back(feeidInfo);
+  MvtxFeeIdInfov1 &feeidInfo = m_MvtxRawHitMap[bclk].MvtxFeeIdInfoVector.emplace_back();
+  feeidInfo.set_bco(bclk);
+  feeidInfo.set_feeId(feeid);
+  feeidInfo.set_detField(detField);
 }
 
 void Fun4AllStreamingInputManager::AddMvtxL1TrgBco(uint64_t bclk, uint64_t lv1Bco)
@@ -534,7 +539,6 @@ void Fun4AllStreamingInputManager::AddInttRawHit(uint64_t bclk, InttRawHit *hit)
               << std::hex << bclk << std::dec << std::endl;
   }
   m_InttRawHitMap[bclk].InttRawHitVector.push_back(hit);
-  m_InttPacketFeeBcoMap[hit->get_packetid()][hit->get_fee()] = bclk;
 }
 
 void Fun4AllStreamingInputManager::AddMicromegasRawHit(uint64_t bclk, MicromegasRawHit *hit)
@@ -634,8 +638,7 @@ int Fun4AllStreamingInputManager::FillGl1()
     {
       iter->CleanupUsedPackets(m_Gl1RawHitMap.begin()->first);
     }
-    m_Gl1RawHitMap.begin()->second.Gl1RawHitVector.clear();
-    m_Gl1RawHitMap.erase(m_Gl1RawHitMap.begin());
+    m_Gl1RawHitMap.pop_front();
   }
   // std::cout << "size  m_Gl1RawHitMap: " <<  m_Gl1RawHitMap.size()
   // 	    << std::endl;
@@ -700,8 +703,7 @@ int Fun4AllStreamingInputManager::FillIntt()
       iter->clearFeeGTML1BCOMap(m_InttRawHitMap.begin()->first);
     }
 
-    m_InttRawHitMap.begin()->second.InttRawHitVector.clear();
-    m_InttRawHitMap.erase(m_InttRawHitMap.begin());
+    m_InttRawHitMap.pop_front();
 
     iret = FillInttPool();
     if (iret)
@@ -858,19 +860,15 @@ int Fun4AllStreamingInputManager::FillMvtx()
       iter->CleanupUsedPackets(m_MvtxRawHitMap.begin()->first);
       iter->clearFeeGTML1BCOMap(m_MvtxRawHitMap.begin()->first);
     }
-    for (auto *mvtxFeeIdInfo : m_MvtxRawHitMap.begin()->second.MvtxFeeIdInfoVector)
+    if (Verbosity() > 1)
     {
-      if (Verbosity() > 1)
+      for (const auto &mvtxFeeIdInfo : m_MvtxRawHitMap.begin()->second.MvtxFeeIdInfoVector)
       {
-        mvtxFeeIdInfo->identify();
+        mvtxFeeIdInfo.identify();
       }
-      delete mvtxFeeIdInfo;
     }
 
-    m_MvtxRawHitMap.begin()->second.MvtxFeeIdInfoVector.clear();
-    m_MvtxRawHitMap.begin()->second.MvtxL1TrgBco.clear();
-    m_MvtxRawHitMap.begin()->second.MvtxRawHitVector.clear();
-    m_MvtxRawHitMap.erase(m_MvtxRawHitMap.begin());
+    m_MvtxRawHitMap.pop_front();
 
     iret = FillMvtxPool();
     if (iret)
@@ -892,9 +890,9 @@ int Fun4AllStreamingInputManager::FillMvtx()
     auto diff = (m_RefBCO > strbbco) ? m_RefBCO - strbbco : strbbco - m_RefBCO;
     bool match = false;
     int packetid = -99;
-    for (auto *feeidinfo : mvtxrawhitinfo.MvtxFeeIdInfoVector)
+    for (const auto &feeidinfo : mvtxrawhitinfo.MvtxFeeIdInfoVector)
     {
-      auto feeId = feeidinfo->get_feeId();
+      auto feeId = feeidinfo.get_feeId();
 
       auto link = MvtxRawDefs::decode_feeid(feeId);
       auto [felix, endpoint] = MvtxRawDefs::get_flx_endpoint(link.layer, link.stave);
@@ -990,13 +988,13 @@ int Fun4AllStreamingInputManager::FillMvtx()
       std::cout << "Adding 0x" << std::hex << bco 
                 << " ref: 0x" << select_crossings << std::dec << std::endl;
     }
-    for (auto *mvtxFeeIdInfo : hitinfo.MvtxFeeIdInfoVector)
+    for (auto &mvtxFeeIdInfo : hitinfo.MvtxFeeIdInfoVector)
     {
       if (Verbosity() > 1)
       {
-        mvtxFeeIdInfo->identify();
+        mvtxFeeIdInfo.identify();
       }
-      mvtxEvtHeader->AddFeeIdInfo(mvtxFeeIdInfo);
+      mvtxEvtHeader->AddFeeIdInfo(&mvtxFeeIdInfo);
     }
     mvtxEvtHeader->AddL1Trg(hitinfo.MvtxL1TrgBco);
 
@@ -1070,7 +1068,7 @@ int Fun4AllStreamingInputManager::FillMicromegas()
     }
 
     // remove
-    m_MicromegasRawHitMap.erase(m_MicromegasRawHitMap.begin());
+    m_MicromegasRawHitMap.pop_front();
 
     // fill pools again
     iret = FillMicromegasPool();
@@ -1087,17 +1085,18 @@ int Fun4AllStreamingInputManager::FillMicromegas()
   }
 
   // store hits relevant for this trigger and cleanup
-  for (auto iter = m_MicromegasRawHitMap.begin(); iter != m_MicromegasRawHitMap.end() && iter->first <= last_bco; iter = m_MicromegasRawHitMap.erase(iter))
+  while (!m_MicromegasRawHitMap.empty() && m_MicromegasRawHitMap.front().first <= last_bco)
   {
-    for (const auto &hititer : iter->second.MicromegasRawHitVector)
+    for (const auto &hititer : m_MicromegasRawHitMap.front().second.MicromegasRawHitVector)
     {
       container->AddHit(hititer);
     }
 
     for (const auto &poolinput : m_MicromegasInputVector)
     {
-      poolinput->CleanupUsedPackets(iter->first);
+      poolinput->CleanupUsedPackets(m_MicromegasRawHitMap.front().first);
     }
+    m_MicromegasRawHitMap.pop_front();
   }
 
   return 0;
@@ -1148,8 +1147,7 @@ int Fun4AllStreamingInputManager::FillTpc()
         iter->CleanupUsedPackets(m_TpcRawHitMap.begin()->first);
         iter->clearPacketBClkStackMap(m_TpcRawHitMap.begin()->first);
       }
-      m_TpcRawHitMap.begin()->second.TpcRawHitVector.clear();
-      m_TpcRawHitMap.erase(m_TpcRawHitMap.begin());
+      m_TpcRawHitMap.pop_front();
       iret = FillTpcPool();
       if (iret)
       {
@@ -1176,8 +1174,7 @@ int Fun4AllStreamingInputManager::FillTpc()
         iter->CleanupUsedPackets(m_TpcRawHitMap.begin()->first);
         // we just want to erase anything that is well away from the current GL1
       }
-      m_TpcRawHitMap.begin()->second.TpcRawHitVector.clear();
-      m_TpcRawHitMap.erase(m_TpcRawHitMap.begin());
+      m_TpcRawHitMap.pop_front();
       if (m_TpcRawHitMap.empty())
       {
         break;
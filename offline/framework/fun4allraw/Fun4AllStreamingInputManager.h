@@ -4,19 +4,21 @@
 #define FUN4ALLRAW_FUN4ALLSTREAMINGINPUTMANAGER_H
 
 #include "InputManagerType.h"
+#include "StreamingBcoBuffer.h"
+
+#include <ffarawobjects/MvtxFeeIdInfov1.h>
 
 #include <fun4all/Fun4AllInputManager.h>
 
-#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 class SingleStreamingInput;
 class Gl1Packet;
 class InttRawHit;
 class MicromegasRawHit;
 class MvtxRawHit;
-class MvtxFeeIdInfo;
 class PHCompositeNode;
 class SyncObject;
 class TpcRawHit;
@@ -73,33 +75,61 @@ class Fun4AllStreamingInputManager : public Fun4AllInputManager
   struct MvtxRawHitInfo
   {
     std::set<uint64_t> MvtxL1TrgBco;
-    std::vector<MvtxFeeIdInfo *> MvtxFeeIdInfoVector;
+    // stored by value, so that recycled entries do not allocate them again
+    std::vector<MvtxFeeIdInfov1> MvtxFeeIdInfoVector;
     std::vector<MvtxRawHit *> MvtxRawHitVector;
     unsigned int EventFoundCounter{0};
+    void Reset()
+    {
+      MvtxL1TrgBco.clear();
+      MvtxFeeIdInfoVector.clear();
+      MvtxRawHitVector.clear();
+      EventFoundCounter = 0;
+    }
   };
 
   struct Gl1RawHitInfo
   {
     std::vector<Gl1Packet *> Gl1RawHitVector;
     unsigned int EventFoundCounter{0};
+    void Reset()
+    {
+      Gl1RawHitVector.clear();
+      EventFoundCounter = 0;
+    }
   };
 
   struct InttRawHitInfo
   {
     std::vector<InttRawHit *> InttRawHitVector;
     unsigned int EventFoundCounter{0};
+    void Reset()
+    {
+      InttRawHitVector.clear();
+      EventFoundCounter = 0;
+    }
   };
 
   struct MicromegasRawHitInfo
   {
     std::vector<MicromegasRawHit *> MicromegasRawHitVector;
     unsigned int EventFoundCounter{0};
+    void Reset()
+    {
+      MicromegasRawHitVector.clear();
+      EventFoundCounter = 0;
+    }
   };
 
   struct TpcRawHitInfo
   {
     std::vector<TpcRawHit *> TpcRawHitVector;
     unsigned int EventFoundCounter{0};
+    void Reset()
+    {
+      TpcRawHitVector.clear();
+      EventFoundCounter = 0;
+    }
   };
 
   void createQAHistos();
@@ -132,12 +162,12 @@ class Fun4AllStreamingInputManager : public Fun4AllInputManager
   std::vector<SingleStreamingInput *> m_MicromegasInputVector;
   std::vector<SingleStreamingInput *> m_MvtxInputVector;
   std::vector<SingleStreamingInput *> m_TpcInputVector;
-  std::map<uint64_t, Gl1RawHitInfo> m_Gl1RawHitMap;
-  std::map<uint64_t, InttRawHitInfo> m_InttRawHitMap;
-  std::map<uint64_t, MicromegasRawHitInfo> m_MicromegasRawHitMap;
-  std::map<uint64_t, MvtxRawHitInfo> m_MvtxRawHitMap;
-  std::map<uint64_t, TpcRawHitInfo> m_TpcRawHitMap;
-  std::map<int, std::map<int, uint64_t>> m_InttPacketFeeBcoMap;
+  // BCO ordered hit buffers
+  StreamingBcoBuffer<Gl1RawHitInfo> m_Gl1RawHitMap;
+  StreamingBcoBuffer<InttRawHitInfo> m_InttRawHitMap;
+  StreamingBcoBuffer<MicromegasRawHitInfo> m_MicromegasRawHitMap;
+  StreamingBcoBuffer<MvtxRawHitInfo> m_MvtxRawHitMap;
+  StreamingBcoBuffer<TpcRawHitInfo> m_TpcRawHitMap;
 
   // QA histos
   TH1 *h_refbco_mvtx[12]{nullptr};
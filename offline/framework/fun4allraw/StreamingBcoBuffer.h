@@ -0,0 +1,159 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef FUN4ALLRAW_STREAMINGBCOBUFFER_H
+#define FUN4ALLRAW_STREAMINGBCOBUFFER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Time ordered buffer of per BCO hit information, used by Fun4AllStreamingInputManager
+ *
+ * Entries are kept sorted by BCO in a deque. Streaming data come mostly in BCO order,
+ * so that adding to the last BCO, appending a new BCO and draining the oldest one are O(1).
+ * Late BCOs are located by binary search and inserted in place.
+ *
+ * Drained entries are reset and recycled for the next BCOs, so that their hit vectors
+ * keep their capacity. T must provide a Reset() method.
+ *
+ * The buffer keeps track of its depth and of the drain latency, the wall time
+ * between the creation of a BCO entry and its removal from the buffer.
+ */
+template <class T>
+class StreamingBcoBuffer
+{
+ public:
+  using value_type = std::pair<uint64_t, T>;
+  using iterator = typename std::deque<value_type>::iterator;
+  using const_iterator = typename std::deque<value_type>::const_iterator;
+
+  //! entry for a given BCO, created if not found
+  T &operator[](const uint64_t bco)
+  {
+    if (m_entries.empty() || m_entries.back().first < bco)
+    {
+      m_entries.emplace_back(bco, new_entry());
+      m_created.push_back(clock::now());
+      update_depth();
+      return m_entries.back().second;
+    }
+    if (m_entries.back().first == bco)
+    {
+      return m_entries.back().second;
+    }
+
+    // late BCO
+    const auto iter = std::lower_bound(m_entries.begin(), m_entries.end(), bco,
+                                       [](const value_type &entry, const uint64_t value)
+                                       { return entry.first < value; });
+    if (iter->first == bco)
+    {
+      return iter->second;
+    }
+    ++m_late;
+    const auto index = std::distance(m_entries.begin(), iter);
+    m_created.insert(m_created.begin() + index, clock::now());
+    auto newentry = m_entries.emplace(iter, bco, new_entry());
+    update_depth();
+    return newentry->second;
+  }
+
+  bool empty() const { return m_entries.empty(); }
+  std::size_t size() const { return m_entries.size(); }
+
+  iterator begin() { return m_entries.begin(); }
+  iterator end() { return m_entries.end(); }
+  const_iterator begin() const { return m_entries.begin(); }
+  const_iterator end() const { return m_entries.end(); }
+
+  value_type &front() { return m_entries.front(); }
+
+  //! remove oldest BCO. Its entry is recycled
+  void pop_front()
+  {
+    const double latency = std::chrono::duration<double>(clock::now() - m_created.front()).count();
+    m_latency_sum += latency;
+    m_latency_max = std::max(m_latency_max, latency);
+    ++m_drained;
+
+    m_entries.front().second.Reset();
+    m_free.push_back(std::move(m_entries.front().second));
+    m_entries.pop_front();
+    m_created.pop_front();
+  }
+
+  //! remove all BCOs, the caller is responsible for the hits they own
+  void clear()
+  {
+    while (!m_entries.empty())
+    {
+      pop_front();
+    }
+  }
+
+  //! maximum number of buffered BCOs
+  std::size_t max_depth() const { return m_max_depth; }
+
+  //! number of drained BCOs
+  uint64_t drained() const { return m_drained; }
+
+  //! number of BCOs which came after a more recent one
+  uint64_t late() const { return m_late; }
+
+  //! mean drain latency (s)
+  double mean_latency() const { return m_drained ? m_latency_sum / m_drained : 0; }
+
+  //! maximum drain latency (s)
+  double max_latency() const { return m_latency_max; }
+
+  void PrintStats(const std::string &name, std::ostream &os = std::cout) const
+  {
+    os << name << " bco buffer: depth " << size()
+       << ", max depth " << max_depth()
+       << ", drained " << drained()
+       << ", late " << late()
+       << ", mean drain latency " << mean_latency() * 1e3 << " ms"
+       << ", max drain latency " << max_latency() * 1e3 << " ms"
+       << std::endl;
+  }
+
+ private:
+  using clock = std::chrono::steady_clock;
+
+  T new_entry()
+  {
+    if (m_free.empty())
+    {
+      return T();
+    }
+    T entry = std::move(m_free.back());
+    m_free.pop_back();
+    return entry;
+  }
+
+  void update_depth()
+  {
+    m_max_depth = std::max(m_max_depth, m_entries.size());
+  }
+
+  std::deque<value_type> m_entries;
+  std::deque<clock::time_point> m_created;
+
+  //! drained entries, kept for their memory
+  std::vector<T> m_free;
+
+  std::size_t m_max_depth{0};
+  uint64_t m_drained{0};
+  uint64_t m_late{0};
+  double m_latency_sum{0};
+  double m_latency_max{0};
+};
+
+#endif
@@ -21,7 +21,9 @@
 #include <TTree.h>
 #include <TVector3.h>
 
+#include <array>
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -39,6 +41,12 @@ TpcTimeFrameBuilder::TpcTimeFrameBuilder(const int packet_id)
   }
 
   m_feeData.resize(MAX_FEECOUNT);
+  for (auto& data_buffer : m_feeData)
+  {
+    data_buffer.reserve(2 * MAX_PACKET_LENGTH);
+  }
+  m_feeDecodedWords.resize(MAX_FEECOUNT, 0);
+  m_feeDecodeTime.resize(MAX_FEECOUNT, 0);
 
   // cppcheck-suppress noCopyConstructor
   // cppcheck-suppress noOperatorEq
@@ -169,6 +177,11 @@ TpcTimeFrameBuilder::TpcTimeFrameBuilder(const int packet_id)
 
 TpcTimeFrameBuilder::~TpcTimeFrameBuilder()
 {
+  if (m_verbosity >= 1)
+  {
+    printDecodeRate();
+  }
+
   for (auto& timeFrameEntry : m_timeFrameMap)
   {
     while (!timeFrameEntry.second.empty())
@@ -177,12 +190,54 @@ TpcTimeFrameBuilder::~TpcTimeFrameBuilder()
       timeFrameEntry.second.pop_back();
     }
   }
+  for (auto* hit : m_hitPool)
+  {
+    delete hit;
+  }
 
   delete m_packetTimer;
 
   delete m_digitalCurrentDebugTTree;
 }
 
+TpcRawHitv3* TpcTimeFrameBuilder::allocate_hit()
+{
+  if (m_hitPool.empty())
+  {
+    return new TpcRawHitv3();
+  }
+  TpcRawHitv3* hit = m_hitPool.back();
+  m_hitPool.pop_back();
+  return hit;
+}
+
+void TpcTimeFrameBuilder::release_hit(TpcRawHit* hit)
+{
+  // all hits are created by allocate_hit()
+  // their waveforms are usually already moved out to the hit container, which gave back its emptied buffers.
+  // Clear keeps them for the next hit decoded into this object
+  hit->Clear("");
+  m_hitPool.push_back(static_cast<TpcRawHitv3*>(hit));
+}
+
+void TpcTimeFrameBuilder::printDecodeRate(std::ostream& os) const
+{
+  os << "TpcTimeFrameBuilder - packet " << m_packet_id << " decoded words per FEE:" << std::endl;
+  for (unsigned int fee = 0; fee < m_feeDecodedWords.size(); ++fee)
+  {
+    if (m_feeDecodedWords[fee] == 0)
+    {
+      continue;
+    }
+    os << "\t- FEE " << fee << ": " << m_feeDecodedWords[fee] << " words";
+    if (m_feeDecodeTime[fee] > 0)
+    {
+      os << ", " << m_feeDecodedWords[fee] / m_feeDecodeTime[fee] << " words/s";
+    }
+    os << std::endl;
+  }
+}
+
 void TpcTimeFrameBuilder::setVerbosity(const int i)
 {
   m_verbosity = i;
@@ -266,7 +321,7 @@ std::vector<TpcRawHit*>& TpcTimeFrameBuilder::getTimeFrame(const uint64_t& gtm_b
       h_GTMClockDiff_Dropped->Fill(int64_t(it->first) - int64_t(bclk_rollover_corrected));
       for (const auto& hit : it->second)
       {
-        delete hit;
+        release_hit(hit);
       }
       it = m_timeFrameMap.erase(it);
     }
@@ -365,7 +420,7 @@ void TpcTimeFrameBuilder::CleanupUsedPackets(const uint64_t& bclk)
     {
       while (!it->second.empty())
       {
-        delete it->second.back();
+        release_hit(it->second.back());
         it->second.pop_back();
       }
       m_timeFrameMap.erase(it);
@@ -384,7 +439,7 @@ void TpcTimeFrameBuilder::CleanupUsedPackets(const uint64_t& bclk)
       while (!it->second.empty())
       {
         m_hFEEDataStream->Fill(it->second.back()->get_fee(), "HitUnusedBeforeCleanup", 1);
-        delete it->second.back();
+        release_hit(it->second.back());
         it->second.pop_back();
         ++count;
       }
@@ -524,7 +579,11 @@ int TpcTimeFrameBuilder::ProcessPacket(Packet* packet)
   }
 
   size_t dma_words_buffer = static_cast<size_t>(data_length) * 2 / DAM_DMA_WORD_LENGTH + 1;
-  std::vector<dma_word> buffer(dma_words_buffer);
+  if (m_dmaBuffer.size() < dma_words_buffer)
+  {
+    m_dmaBuffer.resize(dma_words_buffer);
+  }
+  std::vector<dma_word>& buffer = m_dmaBuffer;
 
   int l2 = 0;
   packet->fillIntArray(reinterpret_cast<int*>(buffer.data()), data_length + DAM_DMA_WORD_LENGTH / 2, &l2, "DATA");
@@ -551,7 +610,7 @@ int TpcTimeFrameBuilder::ProcessPacket(Packet* packet)
 
   size_t dma_words = static_cast<size_t>(l2) * 2 / DAM_DMA_WORD_LENGTH;
   size_t dma_residual = (static_cast<size_t>(l2) * 2) % DAM_DMA_WORD_LENGTH;
-  assert(dma_words <= buffer.size());
+  assert(dma_words <= dma_words_buffer);
   assert(h_PacketLength_Residual);
   h_PacketLength_Residual->Fill(dma_residual);
   if (dma_residual > 0)
@@ -559,7 +618,7 @@ int TpcTimeFrameBuilder::ProcessPacket(Packet* packet)
     std::cout << __PRETTY_FUNCTION__ << "\t- : Warning : mismatch of RCDAQ data to DMA transfer. Dropping mismatched data: "
               << dma_residual << "\t- in packet " << m_packet_id << ". Dropping residual data : " << std::endl;
 
-    assert(dma_words + 1 < buffer.size());
+    assert(dma_words + 1 < dma_words_buffer);
     const dma_word& last_dma_word_data = buffer[dma_words + 1];
     const uint16_t* last_dma_word = reinterpret_cast<const uint16_t*>(&last_dma_word_data);
 
@@ -598,10 +657,7 @@ int TpcTimeFrameBuilder::ProcessPacket(Packet* packet)
 
       if (fee_id < MAX_FEECOUNT)
       {
-        for (const uint16_t& i : dma_word_data.data)
-        {
-          m_feeData[fee_id].push_back(i);
-        }
+        m_feeData[fee_id].insert(m_feeData[fee_id].end(), std::begin(dma_word_data.data), std::end(dma_word_data.data));
         m_hNorm->Fill("DMA_WORD_FEE", 1);
 
         // immediate fee buffer processing to reduce memory consuption
@@ -642,7 +698,7 @@ int TpcTimeFrameBuilder::ProcessPacket(Packet* packet)
 
       while (!timeframe.second.empty())
       {
-        delete timeframe.second.back();
+        release_hit(timeframe.second.back());
         timeframe.second.pop_back();
       }
     }
@@ -665,15 +721,18 @@ int TpcTimeFrameBuilder::process_fee_data(unsigned int fee)
   }
 
   assert(fee < m_feeData.size());
-  std::deque<uint16_t>& data_buffer = m_feeData[fee];
+  std::vector<uint16_t>& data_buffer = m_feeData[fee];
 
-  while (HEADER_LENGTH <= data_buffer.size())
+  // start of the not yet decoded data. Decoded words are removed from the buffer at the end
+  size_t start = 0;
+  while (start + HEADER_LENGTH <= data_buffer.size())
   {
     // packet loop
+    const uint16_t* data = data_buffer.data() + start;
 
     bool is_digital_current = false;
     // test if digital current packet
-    if (data_buffer[3] == FEE_PACKET_MAGIC_KEY_3_DC)
+    if (data[3] == FEE_PACKET_MAGIC_KEY_3_DC)
     {
       if (m_verbosity > 2)
       {
@@ -684,36 +743,36 @@ int TpcTimeFrameBuilder::process_fee_data(unsigned int fee)
 
       m_hFEEDataStream->Fill(fee, "WordDigitalCurrentKeyWord", 1);
       is_digital_current = true;
-    }  //     if (data_buffer[3] == FEE_PACKET_MAGIC_KEY_3)
+    }  //     if (data[3] == FEE_PACKET_MAGIC_KEY_3)
     else
     {
-      if (data_buffer[1] != FEE_PACKET_MAGIC_KEY_1)
+      if (data[1] != FEE_PACKET_MAGIC_KEY_1)
       {
         if (m_verbosity > 1)
         {
-          std::cout << __PRETTY_FUNCTION__ << "\t- : Error : Invalid FEE magic key at position 1 0x" << std::hex << data_buffer[1] << std::dec << std::endl;
+          std::cout << __PRETTY_FUNCTION__ << "\t- : Error : Invalid FEE magic key at position 1 0x" << std::hex << data[1] << std::dec << std::endl;
         }
         m_hFEEDataStream->Fill(fee, "WordSkipped", 1);
-        data_buffer.pop_front();
+        ++start;
         continue;
       }
-      assert(data_buffer[1] == FEE_PACKET_MAGIC_KEY_1);
+      assert(data[1] == FEE_PACKET_MAGIC_KEY_1);
 
-      if (data_buffer[2] != FEE_PACKET_MAGIC_KEY_2)
+      if (data[2] != FEE_PACKET_MAGIC_KEY_2)
       {
         if (m_verbosity > 1)
         {
-          std::cout << __PRETTY_FUNCTION__ << "\t- : Error : Invalid FEE magic key at position 2 0x" << std::hex << data_buffer[2] << std::dec << std::endl;
+          std::cout << __PRETTY_FUNCTION__ << "\t- : Error : Invalid FEE magic key at position 2 0x" << std::hex << data[2] << std::dec << std::endl;
         }
         m_hFEEDataStream->Fill(fee, "WordSkipped", 1);
-        data_buffer.pop_front();
+        ++start;
         continue;
       }
-      assert(data_buffer[2] == FEE_PACKET_MAGIC_KEY_2);
+      assert(data[2] == FEE_PACKET_MAGIC_KEY_2);
     }
 
     // valid packet
-    const uint16_t pkt_length = data_buffer[0];  // this is indeed the number of 10-bit words + 5 in this packet
+    const uint16_t pkt_length = data[0];  // this is indeed the number of 10-bit words + 5 in this packet
     if (pkt_length > MAX_PACKET_LENGTH)
     {
       if (m_verbosity > 1)
@@ -721,40 +780,47 @@ int TpcTimeFrameBuilder::process_fee_data(unsigned int fee)
         std::cout << __PRETTY_FUNCTION__ << "\t- : Error : Invalid FEE pkt_length " << pkt_length << std::endl;
       }
       m_hFEEDataStream->Fill(fee, "InvalidLength", 1);
-      data_buffer.pop_front();
+      ++start;
       continue;
     }
 
-    if (pkt_length + 1U > data_buffer.size())
+    if (start + pkt_length + 1U > data_buffer.size())
     {
       if (m_verbosity > 2)
       {
         std::cout << __PRETTY_FUNCTION__ << "\t- : packet over buffer boundary for now, skip decoding and wait for more data: "
                                             " pkt_length = "
                   << pkt_length
-                  << "\t- data_buffer.size() = " << data_buffer.size()
+                  << "\t- data_buffer.size() = " << data_buffer.size() - start
                   << std::endl;
       }
       break;
     }
 
+    const auto decode_start = std::chrono::steady_clock::now();
     if (is_digital_current)
     {
-      process_fee_data_digital_current(fee, data_buffer);
+      process_fee_data_digital_current(fee, data);
     }
     else
     {
-      process_fee_data_waveform(fee, data_buffer);
+      process_fee_data_waveform(fee, data);
     }
-    data_buffer.erase(data_buffer.begin(), data_buffer.begin() + pkt_length + 1);
+    m_feeDecodeTime[fee] += std::chrono::duration<double>(std::chrono::steady_clock::now() - decode_start).count();
+    m_feeDecodedWords[fee] += pkt_length + 1;
+
+    start += pkt_length + 1;
     m_hFEEDataStream->Fill(fee, "WordValid", pkt_length + 1);
 
-  }  //     while (HEADER_LENGTH < data_buffer.size())
+  }  //     while (start + HEADER_LENGTH <= data_buffer.size())
+
+  // at most one incomplete packet is left, move it to the front of the buffer
+  data_buffer.erase(data_buffer.begin(), data_buffer.begin() + start);
 
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
-void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std::deque<uint16_t>& data_buffer)
+void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, const uint16_t* data_buffer)
 {
   const uint16_t& pkt_length = data_buffer[0];
 
@@ -773,7 +839,7 @@ void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std
 
   if (!m_fastBCOSkip)
   {
-    auto crc_parity = crc16_parity(fee, pkt_length);
+    auto crc_parity = crc16_parity(data_buffer, pkt_length);
     payload.calc_crc = crc_parity.first;
     payload.calc_parity = crc_parity.second;
 
@@ -913,18 +979,32 @@ void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std
   {
     m_hFEEDataStream->Fill(fee, "RawHit", 1);
 
+    // valid packet in the buffer, waveforms are decoded directly into a new hit
+    TpcRawHitv3* hit = nullptr;
+    if (payload.type != TpcTimeFrameBuilder::BcoMatchingInformation::HEARTBEAT_T)
+    {
+      hit = allocate_hit();
+      m_timeFrameMap[payload.gtm_bco].push_back(hit);
+
+      hit->set_bco(payload.bx_timestamp);
+      hit->set_packetid(m_packet_id);
+      hit->set_fee(fee);
+      hit->set_channel(payload.channel);
+      hit->set_type(payload.type);
+      // hit->set_checksum(payload.data_crc);
+      hit->set_checksumerror(payload.data_crc != payload.calc_crc);
+      // hit->set_parity(payload.data_parity);
+      hit->set_parityerror(payload.data_parity != payload.calc_parity);
+    }
+
     // Format is (N sample) (start time), (1st sample)... (Nth sample)
     size_t pos = HEADER_LENGTH;
-    std::deque<uint16_t>::const_iterator data_buffer_iterator = data_buffer.cbegin();
-    std::advance(data_buffer_iterator, pos);
     while (pos + 2 < pkt_length)
     {
-      const uint16_t& nsamp = *data_buffer_iterator;
+      const uint16_t& nsamp = data_buffer[pos];
       ++pos;
-      ++data_buffer_iterator;
-      const uint16_t& start_t = *data_buffer_iterator;
+      const uint16_t& start_t = data_buffer[pos];
       ++pos;
-      ++data_buffer_iterator;
       if (m_verbosity > 3)
       {
         std::cout << __PRETTY_FUNCTION__ << ": nsamp: " << nsamp
@@ -952,18 +1032,17 @@ void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std
       }
 
       const unsigned int fee_sampa_address = fee * MAX_SAMPA + payload.sampa_address;
-      std::vector<uint16_t> adc(nsamp);
+      const uint16_t* adc = data_buffer + pos;
       for (int j = 0; j < nsamp; j++)
       {
-        const uint16_t& adc_value = *data_buffer_iterator;
-
-        adc[j] = adc_value;
-        m_hFEESAMPAADC->Fill(start_t + j, fee_sampa_address, adc_value);
-
-        ++pos;
-        ++data_buffer_iterator;  // data_buffer[pos++];
+        m_hFEESAMPAADC->Fill(start_t + j, fee_sampa_address, adc[j]);
+      }
+      if (hit)
+      {
+        // reuses the waveform buffers of the pooled hit
+        hit->add_adc_waveform(start_t, adc, nsamp);
       }
-      payload.waveforms.emplace_back(start_t, std::move(adc));
+      pos += nsamp;
 
       //   // an exception to deal with the last sample that is missing in the current hit format
       //   if (pos + 1 == pkt_length) break;
@@ -979,34 +1058,12 @@ void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std
       }
       m_hFEEDataStream->Fill(fee, "HitFormatErrorMismatchedLength", 1);
     }
-
-    // valid packet in the buffer, create a new hit
-    if (payload.type != TpcTimeFrameBuilder::BcoMatchingInformation::HEARTBEAT_T)
-    {
-      TpcRawHitv3* hit = new TpcRawHitv3();
-      m_timeFrameMap[payload.gtm_bco].push_back(hit);
-
-      hit->set_bco(payload.bx_timestamp);
-      hit->set_packetid(m_packet_id);
-      hit->set_fee(fee);
-      hit->set_channel(payload.channel);
-      hit->set_type(payload.type);
-      // hit->set_checksum(payload.data_crc);
-      hit->set_checksumerror(payload.data_crc != payload.calc_crc);
-      // hit->set_parity(payload.data_parity);
-      hit->set_parityerror(payload.data_parity != payload.calc_parity);
-
-      for (std::pair<uint16_t, std::vector<uint16_t>>& waveform : payload.waveforms)
-      {
-        hit->move_adc_waveform(waveform.first, std::move(waveform.second));
-      }
-    }
   }  //     if (not m_fastBCOSkip)
 
   return;
 }
 
-void TpcTimeFrameBuilder::process_fee_data_digital_current(const unsigned int& fee, std::deque<uint16_t>& data_buffer)
+void TpcTimeFrameBuilder::process_fee_data_digital_current(const unsigned int& fee, const uint16_t* data_buffer)
 {
   if (m_verbosity > 2)
   {
@@ -1059,7 +1116,7 @@ void TpcTimeFrameBuilder::process_fee_data_digital_current(const unsigned int& f
   }
 
   payload.data_crc = data_buffer[pkt_length];
-  auto crc_parity = crc16_parity(fee, pkt_length);
+  auto crc_parity = crc16_parity(data_buffer, pkt_length);
   payload.calc_crc = crc_parity.first;
   // payload.calc_parity = crc_parity.second;
 
@@ -1256,39 +1313,52 @@ uint16_t TpcTimeFrameBuilder::reverseBits(const uint16_t x) const
   return n;
 }
 
-std::pair<uint16_t, uint16_t> TpcTimeFrameBuilder::crc16_parity(const uint32_t fee, const uint16_t l) const
+namespace
 {
-  const std::deque<uint16_t>& data_buffer = m_feeData[fee];
-  assert(l < data_buffer.size());
-
-  std::deque<uint16_t>::const_iterator it = data_buffer.begin();
-
-  uint16_t crc = 0xffffU;
-  uint16_t data_parity = 0U;
-
-  for (int i = 0; i < l; ++i, ++it)
+  // byte wise lookup table for the reflected CRC-16 polynomial 0xa001
+  constexpr std::array<uint16_t, 256> make_crc16_table()
   {
-    const uint16_t& x = *it;
-
-    crc ^= reverseBits(x);
-    for (uint16_t k = 0; k < 16U; k++)
+    std::array<uint16_t, 256> table{};
+    for (unsigned int i = 0; i < 256; ++i)
     {
-      crc = crc & 1U ? static_cast<uint16_t>(crc >> 1U) ^ 0xa001U : crc >> 1U;
+      uint16_t crc = i;
+      for (unsigned int k = 0; k < 8; ++k)
+      {
+        crc = crc & 1U ? static_cast<uint16_t>(crc >> 1U) ^ 0xa001U : crc >> 1U;
+      }
+      table[i] = crc;
     }
+    return table;
+  }
+  constexpr std::array<uint16_t, 256> crc16_table = make_crc16_table();
+}  // namespace
 
-    // parity on data payload only
-    if (i >= HEADER_LENGTH)
-    {
-      // fast parity
-      uint16_t word = x & uint16_t((1U << 10U) - 1U);
-      word = word ^ static_cast<uint16_t>(word >> 1U);
-      word = word ^ static_cast<uint16_t>(word >> 2U);
-      word = word ^ static_cast<uint16_t>(word >> 4U);
-      word = word ^ static_cast<uint16_t>(word >> 8U);
-      data_parity ^= word & 1U;
-    }
+std::pair<uint16_t, uint16_t> TpcTimeFrameBuilder::crc16_parity(const uint16_t* data, const uint16_t l) const
+{
+  uint16_t crc = 0xffffU;
+
+  for (int i = 0; i < l; ++i)
+  {
+    // same as shifting the 16 bits of the reversed word one by one
+    const uint16_t x = reverseBits(data[i]);
+    crc = static_cast<uint16_t>(crc >> 8U) ^ crc16_table[(crc ^ x) & 0xffU];
+    crc = static_cast<uint16_t>(crc >> 8U) ^ crc16_table[(crc ^ static_cast<uint16_t>(x >> 8U)) & 0xffU];
   }
   crc = reverseBits(crc);
+
+  // parity on data payload only. Parity is linear, so that the words can be combined first
+  uint16_t word = 0U;
+  for (int i = HEADER_LENGTH; i < l; ++i)
+  {
+    word ^= data[i];
+  }
+  word &= uint16_t((1U << 10U) - 1U);
+  word = word ^ static_cast<uint16_t>(word >> 1U);
+  word = word ^ static_cast<uint16_t>(word >> 2U);
+  word = word ^ static_cast<uint16_t>(word >> 4U);
+  word = word ^ static_cast<uint16_t>(word >> 8U);
+  const uint16_t data_parity = word & 1U;
+
   return std::make_pair(crc, data_parity);
 }
 
@@ -3,7 +3,6 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <deque>
 #include <functional>
 #include <iostream>
 #include <limits>
@@ -18,6 +17,7 @@
 
 class Packet;
 class TpcRawHit;
+class TpcRawHitv3;
 class PHTimer;
 class TH1;
 class TH2;
@@ -44,6 +44,9 @@ class TpcTimeFrameBuilder
   // enable saving of digital current debug TTree with file name `name`
   void SaveDigitalCurrentDebugTTree(const std::string &name);
 
+  // print number of decoded words and decoding rate per FEE
+  void printDecodeRate(std::ostream &os = std::cout) const;
+
  protected:
   // Length for the 256-bit wide Round Robin Multiplexer for the data stream
   static const size_t DAM_DMA_WORD_LENGTH = 16;
@@ -70,7 +73,8 @@ class TpcTimeFrameBuilder
   int m_hitFormat = -1;
 
   uint16_t reverseBits(const uint16_t x) const;
-  std::pair<uint16_t, uint16_t> crc16_parity(const uint32_t fee, const uint16_t l) const;
+  //! crc and parity of the first l words of a FEE packet
+  std::pair<uint16_t, uint16_t> crc16_parity(const uint16_t *data, const uint16_t l) const;
 
   //! DMA word structure
   struct dma_word
@@ -81,8 +85,9 @@ class TpcTimeFrameBuilder
 
   int decode_gtm_data(const dma_word &gtm_word);
   int process_fee_data(unsigned int fee_id);
-  void process_fee_data_waveform(const unsigned int & fee_id, std::deque<uint16_t>& data_buffer);
-  void process_fee_data_digital_current(const unsigned int & fee_id, std::deque<uint16_t>& data_buffer);
+  //! decode a complete FEE packet in place. data points to the packet length word, followed by pkt_length words
+  void process_fee_data_waveform(const unsigned int & fee_id, const uint16_t *data);
+  void process_fee_data_digital_current(const unsigned int & fee_id, const uint16_t *data);
 
   struct gtm_payload
   {
@@ -115,8 +120,6 @@ class TpcTimeFrameBuilder
     
     uint16_t data_parity = 0;
     uint16_t calc_parity = 0;
-
-    std::vector<std::pair<uint16_t, std::vector<uint16_t>>> waveforms;
   };
 
   struct digital_current_payload
@@ -369,7 +372,24 @@ class TpcTimeFrameBuilder
   };  //   class BcoMatchingInformation
 
  private:
-  std::vector<std::deque<uint16_t>> m_feeData;
+  //! get a hit from the pool
+  TpcRawHitv3 *allocate_hit();
+
+  //! return a hit to the pool
+  void release_hit(TpcRawHit *);
+
+  //! contiguous data stream per FEE. Decoded packets are removed from the front after each DMA word
+  std::vector<std::vector<uint16_t>> m_feeData;
+
+  //! DMA payload of the current packet, reused from one packet to the next
+  std::vector<dma_word> m_dmaBuffer;
+
+  //! free hits, reused for the next time frames
+  std::vector<TpcRawHitv3 *> m_hitPool;
+
+  //! decoded words and decoding time (s) per FEE
+  std::vector<uint64_t> m_feeDecodedWords;
+  std::vector<double> m_feeDecodeTime;
 
   int m_verbosity = 0;
   int m_packet_id = 0;
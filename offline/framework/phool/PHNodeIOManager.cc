@@ -5,6 +5,7 @@
 #include "PHCompositeNode.h"
 #include "PHIODataNode.h"
 #include "PHNodeIterator.h"
+#include "PHNodeReadAhead.h"
 #include "phooldefs.h"
 
 #include <TBranch.h>  // for TBranch
@@ -20,10 +21,13 @@
 #include <TSystem.h>
 #include <TTree.h>
 #include <TTreeCache.h>
+#include <TTreeCacheUnzip.h>
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
@@ -63,6 +67,7 @@ PHNodeIOManager::~PHNodeIOManager()
 
 void PHNodeIOManager::closeFile()
 {
+  m_ReadAhead.reset();
   if (file)
   {
     if (accessMode == PHWrite || accessMode == PHUpdate)
@@ -227,8 +232,18 @@ void PHNodeIOManager::print() const
   }
   if (file && tree)
   {
+    waitReadAhead();
     tree->Print();
   }
+  if (m_ReadAhead)
+  {
+    std::cout << "read ahead entries: " << m_ReadAheadEntries
+              << ", prefetched: " << ReadAheadPrefetches()
+              << ", baskets: " << ReadAheadBaskets()
+              << ", waits: " << ReadAheadWaits()
+              << ", wait time: " << ReadAheadWaitTime() << " s"
+              << ", read time: " << m_ReadTime << " s" << std::endl;
+  }
   std::cout << "\n\nList of selected objects to read:" << std::endl;
   std::map<std::string, bool>::const_iterator classiter;
   for (classiter = objectToRead.begin(); classiter != objectToRead.end(); ++classiter)
@@ -293,12 +308,23 @@ bool PHNodeIOManager::readEventFromFile(size_t requestedEvent)
   std::string currdir = gDirectory->GetPath();
   TFile* file_ptr = gFile;  // save current gFile
   file->cd();
-  
-  if (m_cacheSize != std::numeric_limits<uint64_t>::max())
+
+  if (m_ReadAheadEntries > 0)
+  {
+    if (!m_ReadAheadReady)
+    {
+      setupReadAhead();
+    }
+  }
+  else if (m_cacheSize != std::numeric_limits<uint64_t>::max())
   {
     tree->SetCacheSize(m_cacheSize);
   }
 
+  // the read ahead thread must be done with the tree before we read from it
+  waitReadAhead();
+  const auto start = std::chrono::steady_clock::now();
+
   if (requestedEvent)
   {
     bytesRead = tree->GetEvent(requestedEvent);
@@ -312,6 +338,16 @@ bool PHNodeIOManager::readEventFromFile(size_t requestedEvent)
     bytesRead = tree->GetEvent(eventNumber++);
   }
 
+  if (m_ReadAhead)
+  {
+    m_ReadTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // hand the next entry to the read ahead thread while this one is processed
+    if (bytesRead > 0)
+    {
+      m_ReadAhead->post(eventNumber);
+    }
+  }
+
   gFile = file_ptr;  // recover gFile
   gROOT->cd(currdir.c_str());
 
@@ -339,6 +375,7 @@ int PHNodeIOManager::readSpecific(size_t requestedEvent, const std::string& obje
     TBranch* branch = p->second;
     if (branch)
     {
+      waitReadAhead();
       return branch->GetEvent(requestedEvent);
     }
   }
@@ -513,6 +550,7 @@ void PHNodeIOManager::selectObjectToRead(const std::string& objectName, bool rea
   // If tree is already open, loop over map and set branch status
   if (tree)
   {
+    waitReadAhead();
     std::map<std::string, bool>::const_iterator it;
 
     for (it = objectToRead.begin(); it != objectToRead.end(); ++it)
@@ -546,6 +584,29 @@ bool PHNodeIOManager::SetCompressionSetting(const int level)
   return true;
 }
 
+void PHNodeIOManager::ParallelCompression(const bool flag)
+{
+  if (!tree || accessMode == PHReadOnly)
+  {
+    return;
+  }
+#ifdef R__USE_IMT
+  // set explicitly both ways, a new tree is IMT enabled by default whenever
+  // the macro enabled implicit MT. Entries are still filled in order on the
+  // calling thread, only the compression of full baskets is done concurrently
+  tree->SetImplicitMT(flag);
+#endif
+}
+
+void PHNodeIOManager::AutoFlushBytes(const uint64_t maxbytes)
+{
+  if (!tree || accessMode == PHReadOnly || maxbytes == 0)
+  {
+    return;
+  }
+  tree->SetAutoFlush(-static_cast<Long64_t>(maxbytes));
+}
+
 uint64_t
 PHNodeIOManager::GetBytesWritten()
 {
@@ -566,6 +627,31 @@ PHNodeIOManager::GetFileSize()
   return 0.;
 }
 
+std::map<std::string, uint64_t>
+PHNodeIOManager::GetNodeBytesOnDisk()
+{
+  std::map<std::string, uint64_t> nodebytes;
+  if (!file || !tree || accessMode == PHReadOnly)
+  {
+    return nodebytes;
+  }
+  TObjArray* branchArray = tree->GetListOfBranches();
+  for (int i = 0; i < branchArray->GetEntriesFast(); i++)
+  {
+    TBranch* thisBranch = static_cast<TBranch*>(branchArray->At(i));
+    // the branch name is the node path, the node name is its last element
+    std::string nodename = thisBranch->GetName();
+    const auto pos = nodename.rfind(phooldefs::branchpathdelim);
+    if (pos != std::string::npos)
+    {
+      nodename.erase(0, pos + phooldefs::branchpathdelim.size());
+    }
+    thisBranch->FlushBaskets();
+    nodebytes[nodename] += thisBranch->GetZipBytes("*");
+  }
+  return nodebytes;
+}
+
 std::map<std::string, TBranch*>*
 PHNodeIOManager::GetBranchMap()
 {
@@ -577,6 +663,7 @@ int PHNodeIOManager::FillBranchMap()
 {
   if (fBranches.empty())
   {
+    waitReadAhead();
     TTree* treetmp = nullptr;
     file->GetObject(TreeName.c_str(),treetmp);
     if (treetmp)
@@ -622,7 +709,105 @@ void PHNodeIOManager::DisableReadCache()
 {
   if (file)
   {
+    waitReadAhead();
     file->SetCacheRead(nullptr);
   }
   return;
 }
+
+void PHNodeIOManager::ReadAhead(const unsigned int nentries, const uint64_t maxbytes)
+{
+  m_ReadAheadEntries = nentries;
+  m_ReadAheadMaxBytes = maxbytes;
+  m_ReadAheadReady = false;
+}
+
+uint64_t PHNodeIOManager::ReadAheadPrefetches() const
+{
+  return m_ReadAhead ? m_ReadAhead->Prefetches() : 0;
+}
+
+uint64_t PHNodeIOManager::ReadAheadBaskets() const
+{
+  return m_ReadAhead ? m_ReadAhead->Baskets() : 0;
+}
+
+uint64_t PHNodeIOManager::ReadAheadWaits() const
+{
+  return m_ReadAhead ? m_ReadAhead->Waits() : 0;
+}
+
+double PHNodeIOManager::ReadAheadWaitTime() const
+{
+  return m_ReadAhead ? m_ReadAhead->WaitTime() : 0;
+}
+
+void PHNodeIOManager::waitReadAhead() const
+{
+  if (m_ReadAhead)
+  {
+    m_ReadAhead->wait();
+  }
+}
+
+void PHNodeIOManager::setupReadAhead()
+{
+  m_ReadAheadReady = true;
+  const Long64_t nentries = tree->GetEntries();
+  if (nentries <= 0)
+  {
+    return;
+  }
+
+  // average compressed and uncompressed size of the branches we actually read
+  Long64_t zipbytes = 0;
+  Long64_t totbytes = 0;
+  TObjArray* branches = tree->GetListOfBranches();
+  for (int i = 0; i < branches->GetEntriesFast(); i++)
+  {
+    TBranch* branch = static_cast<TBranch*>(branches->At(i));
+    if (!tree->GetBranchStatus(branch->GetName()))
+    {
+      continue;
+    }
+    zipbytes += branch->GetZipBytes("*");
+    totbytes += branch->GetTotBytes("*");
+  }
+  if (zipbytes <= 0)
+  {
+    return;
+  }
+
+  // the read cache holds the compressed baskets, the branches their uncompressed content,
+  // together they must fit in the memory cap
+  unsigned int depth = m_ReadAheadEntries;
+  if (m_ReadAheadMaxBytes > 0)
+  {
+    const uint64_t bytesperentry = std::max<uint64_t>((zipbytes + totbytes) / nentries, 1);
+    depth = std::clamp<uint64_t>(m_ReadAheadMaxBytes / bytesperentry, 1, depth);
+  }
+  const uint64_t cachesize = std::max<uint64_t>(zipbytes / nentries, 1) * depth;
+
+  // the baskets are unzipped by our own thread, the read cache of this tree must not
+  // unzip them in parallel as well. Whether a new cache does is a static TTreeCacheUnzip
+  // setting, it is switched off for this tree only and restored right after
+  const bool parallelunzip = TTreeCacheUnzip::IsParallelUnzip();
+  TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kDisable);
+  tree->SetCacheSize(static_cast<Long64_t>(cachesize));
+  TTreeCacheUnzip::SetParallelUnzip(parallelunzip ? TTreeCacheUnzip::kEnable : TTreeCacheUnzip::kDisable);
+
+  // cache exactly the branches selected for reading, no learning phase
+  for (int i = 0; i < branches->GetEntriesFast(); i++)
+  {
+    TBranch* branch = static_cast<TBranch*>(branches->At(i));
+    if (tree->GetBranchStatus(branch->GetName()))
+    {
+      tree->AddBranchToCache(branch, true);
+    }
+  }
+  tree->StopCacheLearningPhase();
+  // keep the baskets of the current cluster in memory until the tree moves on
+  tree->SetClusterPrefetch(true);
+
+  m_ReadAhead = std::make_unique<PHNodeReadAhead>(tree, depth);
+}
@@ -13,9 +13,11 @@
 #include <cstdint>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 
 class PHCompositeNode;
+class PHNodeReadAhead;
 class TBranch;
 class TFile;
 class TObject;
@@ -43,8 +45,14 @@ class PHNodeIOManager : public PHIOManager
   bool isSelected(const std::string &objectName);
   int isFunctional() const { return isFunctionalFlag; }
   bool SetCompressionSetting(const int level);
+  //! compress the baskets of this tree on ROOT implicit MT tasks (on) or on the calling thread (off)
+  void ParallelCompression(const bool flag);
+  //! flush the baskets whenever maxbytes are buffered, this changes the cluster layout of the file
+  void AutoFlushBytes(const uint64_t maxbytes);
   uint64_t GetBytesWritten();
   uint64_t GetFileSize();
+  //! compressed bytes on file of each written node, by node name. Pending baskets are flushed first
+  std::map<std::string, uint64_t> GetNodeBytesOnDisk();
   std::map<std::string, TBranch *> *GetBranchMap();
 
   bool write(TObject **, const std::string &, int nodebuffersize, int nodesplitlevel);
@@ -59,16 +67,39 @@ class PHNodeIOManager : public PHIOManager
   
   void DisableReadCache();
 
+  //! read and unzip the baskets of the next nentries entries on a background thread while the
+  //! current one is processed, using at most maxbytes of memory (compressed + uncompressed, 0: no cap).
+  //! Only branches selected for reading are prefetched
+  void ReadAhead(const unsigned int nentries, const uint64_t maxbytes);
+  unsigned int ReadAheadEntries() const { return m_ReadAheadEntries; }
+  //! entries handed to the read ahead thread
+  uint64_t ReadAheadPrefetches() const;
+  //! baskets read and unzipped by the read ahead thread
+  uint64_t ReadAheadBaskets() const;
+  //! number of times the event thread waited for the read ahead thread, and the time it waited (s)
+  uint64_t ReadAheadWaits() const;
+  double ReadAheadWaitTime() const;
+  //! time spent by the event thread in GetEntry with read ahead (s)
+  double ReadTime() const { return m_ReadTime; }
+
 private:
   int FillBranchMap();
   PHCompositeNode *reconstructNodeTree(PHCompositeNode *);
   bool readEventFromFile(size_t requestedEvent);
   static std::string getBranchClassName(TBranch *);
+  void setupReadAhead();
+  //! wait for the read ahead thread before touching the tree or the file
+  void waitReadAhead() const;
 
   TFile *file{nullptr};
   TTree *tree{nullptr};
   std::string TreeName{"T"};
   uint64_t m_cacheSize = std::numeric_limits<uint64_t>::max();
+  uint64_t m_ReadAheadMaxBytes{0};
+  unsigned int m_ReadAheadEntries{0};
+  bool m_ReadAheadReady{false};
+  std::unique_ptr<PHNodeReadAhead> m_ReadAhead;
+  double m_ReadTime{0};
   int accessMode{PHReadOnly};
   int m_CompressionSetting{505};  // ZSTD
   int isFunctionalFlag{0};        // flag to tell if that object initialized properly
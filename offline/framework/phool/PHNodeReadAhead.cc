@@ -0,0 +1,135 @@
+#include "PHNodeReadAhead.h"
+
+#include <TBranch.h>
+#include <TMath.h>
+#include <TObjArray.h>
+#include <TROOT.h>
+#include <TTree.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+  // active branches with baskets of their own, including the sub-branches of split objects
+  void add_branches(TObjArray *branches, std::vector<TBranch *> &active)
+  {
+    for (int i = 0; i < branches->GetEntriesFast(); i++)
+    {
+      TBranch *branch = static_cast<TBranch *>(branches->At(i));
+      if (branch->TestBit(kDoNotProcess))
+      {
+        continue;
+      }
+      if (branch->GetZipBytes() > 0)
+      {
+        active.push_back(branch);
+      }
+      add_branches(branch->GetListOfBranches(), active);
+    }
+  }
+}  // namespace
+
+PHNodeReadAhead::PHNodeReadAhead(TTree *tree, unsigned int nentries)
+  : m_tree(tree)
+  , m_nentries(tree->GetEntries())
+  , m_depth(std::max(nentries, 1U))
+{
+  // the baskets are read and unzipped through ROOT from a second thread
+  ROOT::EnableThreadSafety();
+  add_branches(m_tree->GetListOfBranches(), m_branches);
+  m_thread = std::thread(&PHNodeReadAhead::loop, this);
+}
+
+PHNodeReadAhead::~PHNodeReadAhead()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_work_cv.notify_all();
+  if (m_thread.joinable())
+  {
+    m_thread.join();
+  }
+}
+
+void PHNodeReadAhead::post(int64_t entry)
+{
+  if (entry < 0 || entry >= m_nentries)
+  {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entry = entry;
+    m_busy = true;
+  }
+  m_prefetches++;
+  m_work_cv.notify_all();
+}
+
+void PHNodeReadAhead::wait()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!m_busy)
+  {
+    return;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  m_done_cv.wait(lock, [this]
+                 { return !m_busy; });
+  m_waits++;
+  m_waittime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void PHNodeReadAhead::loop()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true)
+  {
+    m_work_cv.wait(lock, [this]
+                   { return m_stop || m_entry >= 0; });
+    if (m_stop)
+    {
+      return;
+    }
+    const int64_t entry = m_entry;
+    m_entry = -1;
+    lock.unlock();
+    prefetch(entry);
+    lock.lock();
+    m_busy = false;
+    m_done_cv.notify_all();
+  }
+}
+
+void PHNodeReadAhead::prefetch(int64_t entry)
+{
+  // stay within the cluster of entry, baskets of the following clusters would be
+  // dropped again when the event thread moves into the current one
+  auto clusters = m_tree->GetClusterIterator(entry);
+  clusters.Next();
+  const Long64_t last = std::min<Long64_t>({clusters.GetNextEntry(), entry + m_depth, m_nentries}) - 1;
+
+  for (TBranch *branch : m_branches)
+  {
+    // same lookup as TBranch::GetEntry
+    const Long64_t *basketentry = branch->GetBasketEntry();
+    const Int_t nbaskets = branch->GetWriteBasket() + 1;
+    const Int_t first = TMath::BinarySearch(nbaskets, basketentry, static_cast<Long64_t>(entry));
+    const Int_t end = TMath::BinarySearch(nbaskets, basketentry, last);
+    for (Int_t basket = std::max(first, 0); basket <= end; ++basket)
+    {
+      if (branch->GetListOfBaskets()->UncheckedAt(basket))
+      {
+        continue;
+      }
+      // reads the basket from the file and unzips it
+      if (branch->GetBasket(basket))
+      {
+        ++m_baskets;
+      }
+    }
+  }
+}
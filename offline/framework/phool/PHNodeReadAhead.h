@@ -0,0 +1,77 @@
+#ifndef PHOOL_PHNODEREADAHEAD_H
+#define PHOOL_PHNODEREADAHEAD_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class TBranch;
+class TTree;
+
+/**
+ * Background thread reading and unzipping the baskets of the next entries of
+ * an input tree while the event thread processes the current one.
+ *
+ * The event thread hands the next entry over with post() after each GetEntry, and
+ * calls wait() before it touches the tree again, so that the tree and its file are
+ * only ever used by one thread at a time. The baskets are left in the branches,
+ * GetEntry then only streams them into the node objects, which are still in use
+ * by the current event while the prefetch runs.
+ * Only branches selected for reading are prefetched, and never beyond the
+ * cluster of the posted entry.
+ */
+class PHNodeReadAhead
+{
+ public:
+  PHNodeReadAhead(TTree *tree, unsigned int nentries);
+  ~PHNodeReadAhead();
+
+  PHNodeReadAhead(const PHNodeReadAhead &) = delete;
+  PHNodeReadAhead &operator=(const PHNodeReadAhead &) = delete;
+
+  //! prefetch the baskets of entry and of the entries following it
+  void post(int64_t entry);
+
+  //! block until the current prefetch, if any, is done
+  void wait();
+
+  //! number of times the event thread had to wait, and the time it waited (s)
+  uint64_t Waits() const { return m_waits; }
+  double WaitTime() const { return m_waittime; }
+
+  //! entries posted and baskets read by the background thread
+  uint64_t Prefetches() const { return m_prefetches; }
+  uint64_t Baskets() const { return m_baskets; }
+
+ private:
+  void loop();
+  void prefetch(int64_t entry);
+
+  TTree *m_tree{nullptr};
+  int64_t m_nentries{0};
+  unsigned int m_depth{1};
+  std::vector<TBranch *> m_branches;
+
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_done_cv;
+
+  //! entry to prefetch (-1: none) and whether the thread works on it, protected by m_mutex
+  int64_t m_entry{-1};
+  bool m_busy{false};
+  bool m_stop{false};
+
+  //! only updated by the event thread
+  uint64_t m_waits{0};
+  uint64_t m_prefetches{0};
+  double m_waittime{0};
+
+  //! only updated by the background thread
+  std::atomic<uint64_t> m_baskets{0};
+};
+
+#endif
@@ -0,0 +1,82 @@
+#include "PHWorkerPool.h"
+
+PHWorkerPool::PHWorkerPool(unsigned int nthreads)
+{
+  if (nthreads == 0)
+  {
+    nthreads = 1;
+  }
+  m_workers.reserve(nthreads);
+  for (unsigned int i = 0; i < nthreads; ++i)
+  {
+    m_workers.emplace_back(&PHWorkerPool::worker_loop, this, i);
+  }
+}
+
+PHWorkerPool::~PHWorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_work_cv.notify_all();
+  for (auto &worker : m_workers)
+  {
+    if (worker.joinable())
+    {
+      worker.join();
+    }
+  }
+}
+
+void PHWorkerPool::run(std::size_t nitems, const task_t &task)
+{
+  if (nitems == 0)
+  {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_task = &task;
+  m_nitems = nitems;
+  m_next_item = 0;
+  m_nfinished = 0;
+  ++m_generation;
+  m_work_cv.notify_all();
+
+  // wait for all items of this batch to be processed
+  m_done_cv.wait(lock, [this]
+                 { return m_nfinished == m_nitems; });
+  m_task = nullptr;
+  m_nitems = 0;
+}
+
+void PHWorkerPool::worker_loop(unsigned int worker)
+{
+  unsigned long seen_generation = 0;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true)
+  {
+    m_work_cv.wait(lock, [this, seen_generation]
+                   { return m_stop || (m_generation != seen_generation && m_next_item < m_nitems); });
+    if (m_stop)
+    {
+      return;
+    }
+
+    // pull items from the queue until it is drained
+    while (m_next_item < m_nitems)
+    {
+      const std::size_t item = m_next_item++;
+      const task_t *task = m_task;
+      lock.unlock();
+      (*task)(worker, item);
+      lock.lock();
+      if (++m_nfinished == m_nitems)
+      {
+        m_done_cv.notify_all();
+      }
+    }
+    seen_generation = m_generation;
+  }
+}
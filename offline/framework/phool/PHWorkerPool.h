@@ -0,0 +1,59 @@
+#ifndef PHOOL_PHWORKERPOOL_H
+#define PHOOL_PHWORKERPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Long lived pool of worker threads, for modules which split their event
+ * processing into independent work items.
+ *
+ * The pool is created once (InitRun) and reused for every event. Each call to run()
+ * publishes a batch of work items which the workers pull from a shared queue until
+ * it is drained; run() returns once all items are processed.
+ * Workers are identified by a stable index in [0, size()), which callers can use
+ * to address per-worker scratch data.
+ */
+class PHWorkerPool
+{
+ public:
+  //! task signature: worker index, work item index
+  using task_t = std::function<void(unsigned int, std::size_t)>;
+
+  explicit PHWorkerPool(unsigned int nthreads);
+  ~PHWorkerPool();
+
+  PHWorkerPool(const PHWorkerPool &) = delete;
+  PHWorkerPool &operator=(const PHWorkerPool &) = delete;
+
+  //! number of worker threads
+  unsigned int size() const { return m_workers.size(); }
+
+  //! process items [0, nitems) with task, blocking until all are done
+  void run(std::size_t nitems, const task_t &task);
+
+ private:
+  void worker_loop(unsigned int worker);
+
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_done_cv;
+
+  //! current batch, protected by m_mutex
+  const task_t *m_task = nullptr;
+  std::size_t m_nitems = 0;
+  std::size_t m_next_item = 0;
+  std::size_t m_nfinished = 0;
+
+  //! incremented for every batch so that idle workers can detect new work
+  unsigned long m_generation = 0;
+  bool m_stop = false;
+};
+
+#endif
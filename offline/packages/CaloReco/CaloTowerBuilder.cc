@@ -74,6 +74,7 @@ int CaloTowerBuilder::InitRun(PHCompositeNode *topNode)
   {
     WaveformProcessing->set_bitFlipRecovery(m_dobitfliprecovery);
   }
+  WaveformProcessing->set_fastfit_validation(m_fastfit_validation);
 
   // Set functional fit parameters
   if (_processingtype == CaloWaveformProcessing::FUNCFIT)
@@ -94,6 +94,12 @@ public:
     m_dobitfliprecovery = dobitfliprecovery;
   }
 
+  // TEMPLATE_FAST: compare with the Minuit template fit on one event out of prescale (0 = off)
+  void set_fastfit_validation(int prescale)
+  {
+    m_fastfit_validation = prescale;
+  }
+
   // Functional fit options: 0 = PowerLawExp, 1 = PowerLawDoubleExp
   void set_funcfit_type(int type)
   {
@@ -162,6 +168,7 @@ private:
   float m_timeLim_low{-3.0};
   float m_timeLim_high{4.0};
   bool m_dobitfliprecovery{false};
+  int m_fastfit_validation{0};
 
   int m_saturation{16383};
   std::string calibdir;
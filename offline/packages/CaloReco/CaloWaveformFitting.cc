@@ -19,11 +19,24 @@
 
 #include <pthread.h>
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <limits>
 #include <string>
+#include <utility>
 
 static ROOT::TThreadExecutor *t = new ROOT::TThreadExecutor(1);  // NOLINT(misc-use-anonymous-namespace)
+
+namespace
+{
+  // fast template fit validation tolerances: relative + absolute (ADC) on the amplitude,
+  // samples on the time, relative + absolute on chi2/ndf
+  constexpr double fastfit_amplitude_reltol = 1e-3;
+  constexpr double fastfit_amplitude_abstol = 0.5;
+  constexpr double fastfit_time_tol = 0.01;
+  constexpr double fastfit_chi2_reltol = 1e-2;
+  constexpr double fastfit_chi2_abstol = 1e-3;
+}  // namespace
 double CaloWaveformFitting::template_function(double *x, double *par)
 {
   Double_t v1 = (par[0] * h_template->Interpolate(x[0] - par[1])) + par[2];
@@ -32,6 +45,10 @@ double CaloWaveformFitting::template_function(double *x, double *par)
 
 CaloWaveformFitting::~CaloWaveformFitting()
 {
+  if (m_fastfit_stats.nchannels > 0)
+  {
+    print_fastfit_validation();
+  }
   delete h_template;
 }
 
@@ -45,9 +62,52 @@ void CaloWaveformFitting::initialize_processing(const std::string &templatefile)
   fin->Close();
   delete fin;
   m_peakTimeTemp = h_template->GetBinCenter(h_template->GetMaximumBin());
+
+  // tabulate the template for the fast fit
+  const int nbins = h_template->GetNbinsX();
+  m_template_xmin = h_template->GetBinCenter(1);
+  m_template_binwidth = h_template->GetBinWidth(1);
+  m_template_values.resize(nbins);
+  m_template_slopes.assign(nbins, 0);
+  for (int i = 0; i < nbins; i++)
+  {
+    m_template_values[i] = h_template->GetBinContent(i + 1);
+  }
+  for (int i = 0; i < nbins - 1; i++)
+  {
+    m_template_slopes[i] = (m_template_values[i + 1] - m_template_values[i]) / m_template_binwidth;
+  }
   t = new ROOT::TThreadExecutor(_nthreads);
 }
 
+double CaloWaveformFitting::template_value(double x) const
+{
+  // same as TH1::Interpolate: linear between bin centers, constant outside
+  const double u = (x - m_template_xmin) / m_template_binwidth;
+  if (u <= 0)
+  {
+    return m_template_values.front();
+  }
+  const int last = m_template_values.size() - 1;
+  if (u >= last)
+  {
+    return m_template_values.back();
+  }
+  const int bin = u;
+  return m_template_values[bin] + (u - bin) * m_template_binwidth * m_template_slopes[bin];
+}
+
+double CaloWaveformFitting::template_derivative(double x) const
+{
+  const double u = (x - m_template_xmin) / m_template_binwidth;
+  const int last = m_template_values.size() - 1;
+  if (u <= 0 || u >= last)
+  {
+    return 0;
+  }
+  return m_template_slopes[static_cast<int>(u)];
+}
+
 std::vector<std::vector<float>> CaloWaveformFitting::process_waveform(std::vector<std::vector<float>> waveformvector)
 {
   int size1 = waveformvector.size();
@@ -314,6 +374,356 @@ std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_templatefit
   return fit_params;
 }
 
+double CaloWaveformFitting::template_fit_linear(const std::vector<float> &samples, const std::vector<unsigned char> &mask, double time, double &amplitude, double &pedestal) const
+{
+  // minimize sum (y - amplitude * T(x - time) - pedestal)^2 over the unmasked samples
+  double sw = 0;
+  double st = 0;
+  double stt = 0;
+  double sy = 0;
+  double sty = 0;
+  const int nsamples = mask.size();
+  for (int i = 0; i < nsamples; i++)
+  {
+    if (!mask[i])
+    {
+      continue;
+    }
+    const double tv = template_value(i - time);
+    const double y = samples[i];
+    sw += 1;
+    st += tv;
+    stt += tv * tv;
+    sy += y;
+    sty += tv * y;
+  }
+  const double det = sw * stt - st * st;
+  if (det > 0)
+  {
+    amplitude = (sw * sty - st * sy) / det;
+    pedestal = (stt * sy - st * sty) / det;
+  }
+  else
+  {
+    amplitude = 0;
+    pedestal = sw > 0 ? sy / sw : 0;
+  }
+
+  double chi2 = 0;
+  for (int i = 0; i < nsamples; i++)
+  {
+    if (mask[i])
+    {
+      const double r = samples[i] - (amplitude * template_value(i - time)) - pedestal;
+      chi2 += r * r;
+    }
+  }
+  return chi2;
+}
+
+int CaloWaveformFitting::template_fit_fast(const std::vector<float> &samples, const std::vector<unsigned char> &mask, double time_min, double time_max, double time_start, double (&params)[3], double &chi2) const
+{
+  double amplitude = 0;
+  double pedestal = 0;
+
+  // coarse scan around the start value, to get in the basin of the closest minimum
+  double time = std::clamp(time_start, time_min, time_max);
+  chi2 = template_fit_linear(samples, mask, time, amplitude, pedestal);
+  for (double dt = -m_fastfit_scanrange; dt <= m_fastfit_scanrange + 1e-9; dt += m_fastfit_scanstep)
+  {
+    const double trial_time = time_start + dt;
+    if (trial_time < time_min || trial_time > time_max)
+    {
+      continue;
+    }
+    double trial_amplitude = 0;
+    double trial_pedestal = 0;
+    const double trial_chi2 = template_fit_linear(samples, mask, trial_time, trial_amplitude, trial_pedestal);
+    if (trial_chi2 < chi2)
+    {
+      chi2 = trial_chi2;
+      time = trial_time;
+      amplitude = trial_amplitude;
+      pedestal = trial_pedestal;
+    }
+  }
+
+  // Gauss-Newton refinement on (amplitude, time, pedestal).
+  // Only the time step is used, amplitude and pedestal are recomputed linearly at each new time
+  int status = 1;
+  const int nsamples = mask.size();
+  for (int iter = 0; iter < m_fastfit_maxiter; iter++)
+  {
+    // normal equations, jacobian of the model is (T, -amplitude * T', 1)
+    double jtj[3][3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
+    double jtr[3] = {0, 0, 0};
+    for (int i = 0; i < nsamples; i++)
+    {
+      if (!mask[i])
+      {
+        continue;
+      }
+      const double tv = template_value(i - time);
+      const double jac[3] = {tv, -amplitude * template_derivative(i - time), 1.};
+      const double r = samples[i] - (amplitude * tv) - pedestal;
+      for (int a = 0; a < 3; a++)
+      {
+        jtr[a] += jac[a] * r;
+        for (int b = 0; b < 3; b++)
+        {
+          jtj[a][b] += jac[a] * jac[b];
+        }
+      }
+    }
+
+    // time component of the solution, with Cramer's rule
+    const double det = jtj[0][0] * (jtj[1][1] * jtj[2][2] - jtj[1][2] * jtj[2][1]) -
+                       jtj[0][1] * (jtj[1][0] * jtj[2][2] - jtj[1][2] * jtj[2][0]) +
+                       jtj[0][2] * (jtj[1][0] * jtj[2][1] - jtj[1][1] * jtj[2][0]);
+    if (det == 0)
+    {
+      break;
+    }
+    const double dettime = jtj[0][0] * (jtr[1] * jtj[2][2] - jtj[1][2] * jtr[2]) -
+                           jtr[0] * (jtj[1][0] * jtj[2][2] - jtj[1][2] * jtj[2][0]) +
+                           jtj[0][2] * (jtj[1][0] * jtr[2] - jtr[1] * jtj[2][0]);
+    double step = dettime / det;
+
+    // step halving until chi2 decreases
+    bool improved = false;
+    for (int ihalf = 0; ihalf < 8; ihalf++, step /= 2)
+    {
+      const double trial_time = std::clamp(time + step, time_min, time_max);
+      double trial_amplitude = 0;
+      double trial_pedestal = 0;
+      const double trial_chi2 = template_fit_linear(samples, mask, trial_time, trial_amplitude, trial_pedestal);
+      if (trial_chi2 <= chi2)
+      {
+        step = trial_time - time;
+        chi2 = trial_chi2;
+        time = trial_time;
+        amplitude = trial_amplitude;
+        pedestal = trial_pedestal;
+        improved = true;
+        break;
+      }
+    }
+    if (!improved || std::abs(step) < m_fastfit_tolerance)
+    {
+      status = 0;
+      break;
+    }
+  }
+
+  params[0] = amplitude;
+  params[1] = time;
+  params[2] = pedestal;
+  return status;
+}
+
+std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_templatefit_fast(std::vector<std::vector<float>> &chnlvector)
+{
+  // bit-flip recovery modifies the waveforms, keep a copy of the input for the validation
+  std::vector<std::vector<float>> validation_input;
+  const bool validate = m_fastfit_validation > 0 && (m_fastfit_ncalls++ % m_fastfit_validation) == 0;
+  if (validate)
+  {
+    validation_input = chnlvector;
+  }
+
+  std::vector<std::vector<float>> fit_params(chnlvector.size());
+  auto func = [&](std::vector<float> &v)
+  {
+    // per thread scratch, reused from one channel to the next
+    thread_local std::vector<unsigned char> mask;
+    thread_local std::vector<float> rv;
+
+    std::vector<float> &result = fit_params[&v - chnlvector.data()];
+    int size1 = v.size();
+    if (size1 == _nzerosuppresssamples)
+    {
+      float chi2 = std::numeric_limits<float>::quiet_NaN();
+      if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
+      {
+        chi2 = 1000000;
+      }
+      result = {v.at(1) - v.at(0), std::numeric_limits<float>::quiet_NaN(), v.at(0), chi2, 0, 0};
+      return;
+    }
+
+    float maxheight = 0;
+    int maxbin = 0;
+    for (int i = 0; i < size1; i++)
+    {
+      if (v.at(i) > maxheight)
+      {
+        maxheight = v.at(i);
+        maxbin = i;
+      }
+    }
+    float pedestal = 1500;
+    if (maxbin > 4)
+    {
+      pedestal = 0.5 * (v.at(maxbin - 4) + v.at(maxbin - 5));
+    }
+    else if (maxbin > 3)
+    {
+      pedestal = (v.at(maxbin - 4));
+    }
+    else
+    {
+      pedestal = 0.5 * (v.at(size1 - 3) + v.at(size1 - 2));
+    }
+
+    if ((_bdosoftwarezerosuppression && v.at(6) - v.at(0) < _nsoftwarezerosuppression) || (_maxsoftwarezerosuppression && maxheight - pedestal < _nsoftwarezerosuppression))
+    {
+      float chi2 = std::numeric_limits<float>::quiet_NaN();
+      if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
+      {
+        chi2 = 1000000;
+      }
+      result = {v.at(6) - v.at(0), std::numeric_limits<float>::quiet_NaN(), v.at(0), chi2, 0, 0};
+      return;
+    }
+
+    mask.assign(size1, 1);
+    int ndata = size1;
+    if (_handleSaturation)
+    {
+      for (int i = 0; i < size1; ++i)
+      {
+        if (v.at(i) == 16383)
+        {
+          mask[i] = 0;
+          ndata--;
+        }
+      }
+    }
+    // if too many are saturated don't do the saturation recovery need enough ndf
+    if (ndata < (size1 - 4))
+    {
+      ndata = size1;
+      mask.assign(size1, 1);
+    }
+
+    double time_min = -1 * m_peakTimeTemp;
+    double time_max = size1 - m_peakTimeTemp;
+    if (m_setTimeLim)
+    {
+      time_min = m_timeLim_low;
+      time_max = m_timeLim_high;
+    }
+    double params[3];
+    double chi2min = 0;
+    const int validfit = template_fit_fast(v, mask, time_min, time_max, maxbin - m_peakTimeTemp, params, chi2min);
+    chi2min /= ndata - 3;  // divide by the number of dof
+
+    if (chi2min > _chi2threshold && (params[2] < _bfr_highpedestalthreshold || pedestal < _bfr_highpedestalthreshold) && (params[2] > _bfr_lowpedestalthreshold || pedestal > _bfr_lowpedestalthreshold) && _dobitfliprecovery)
+    {
+      rv.assign(v.begin(), v.end());
+      unsigned int bits[3] = {8192, 4096, 2048};
+      for (auto bit : bits)
+      {
+        for (int i = 0; i < size1; i++)
+        {
+          if (((unsigned int) rv.at(i) & bit) && ((unsigned int) rv.at(i) % bit > _bfr_lowpedestalthreshold))
+          {
+            rv.at(i) = rv.at(i) - bit;
+          }
+        }
+      }
+
+      // same time limits and start value as the Minuit recovery fit
+      mask.assign(size1, 1);
+      double recover_params[3];
+      double recover_chi2min = 0;
+      const int recover_validfit = template_fit_fast(rv, mask, -1 * m_peakTimeTemp, size1 - m_peakTimeTemp, 0, recover_params, recover_chi2min);
+      recover_chi2min /= size1 - 3;  // divide by the number of dof
+      if (recover_chi2min < _chi2lowthreshold && recover_params[2] < _bfr_highpedestalthreshold && recover_params[2] > _bfr_lowpedestalthreshold)
+      {
+        std::copy(rv.begin(), rv.end(), v.begin());
+        result = {static_cast<float>(recover_params[0]), static_cast<float>(recover_params[1]), static_cast<float>(recover_params[2]), static_cast<float>(recover_chi2min), 1, static_cast<float>(recover_validfit)};
+        return;
+      }
+    }
+    result = {static_cast<float>(params[0]), static_cast<float>(params[1]), static_cast<float>(params[2]), static_cast<float>(chi2min), 0, static_cast<float>(validfit)};
+  };
+
+  t->Foreach(func, chnlvector);
+
+  if (validate)
+  {
+    validate_fastfit(std::move(validation_input), fit_params);
+  }
+  return fit_params;
+}
+
+void CaloWaveformFitting::validate_fastfit(std::vector<std::vector<float>> waveforms, const std::vector<std::vector<float>> &fast_results)
+{
+  for (std::size_t i = 0; i < waveforms.size(); i++)
+  {
+    waveforms[i].push_back(i);
+  }
+  const std::vector<std::vector<float>> minuit_results = calo_processing_templatefit(std::move(waveforms));
+
+  for (std::size_t i = 0; i < minuit_results.size(); i++)
+  {
+    const auto &minuit = minuit_results[i];
+    const auto &fast = fast_results[i];
+    ++m_fastfit_stats.nchannels;
+
+    // zero suppressed channels have no time, the other fields must be identical
+    if (std::isnan(minuit[1]) || std::isnan(fast[1]))
+    {
+      if (!(std::isnan(minuit[1]) && std::isnan(fast[1]) && minuit[0] == fast[0] && minuit[2] == fast[2]))
+      {
+        ++m_fastfit_stats.nfail_other;
+      }
+      continue;
+    }
+
+    ++m_fastfit_stats.nfitted;
+    // bit-flip recovery must be applied to the same channels
+    if (minuit[4] != fast[4])
+    {
+      ++m_fastfit_stats.nfail_other;
+      continue;
+    }
+
+    const double damplitude = std::abs(fast[0] - minuit[0]);
+    const double dtime = std::abs(fast[1] - minuit[1]);
+    const double dchi2 = std::abs(fast[3] - minuit[3]);
+    m_fastfit_stats.max_amplitude = std::max(m_fastfit_stats.max_amplitude, damplitude / std::max<double>(std::abs(minuit[0]), 1));
+    m_fastfit_stats.max_time = std::max(m_fastfit_stats.max_time, dtime);
+    m_fastfit_stats.max_chi2 = std::max(m_fastfit_stats.max_chi2, dchi2 / std::max<double>(std::abs(minuit[3]), 1));
+    if (damplitude > fastfit_amplitude_reltol * std::abs(minuit[0]) + fastfit_amplitude_abstol)
+    {
+      ++m_fastfit_stats.nfail_amplitude;
+    }
+    if (dtime > fastfit_time_tol)
+    {
+      ++m_fastfit_stats.nfail_time;
+    }
+    if (dchi2 > fastfit_chi2_reltol * std::abs(minuit[3]) + fastfit_chi2_abstol)
+    {
+      ++m_fastfit_stats.nfail_chi2;
+    }
+  }
+}
+
+void CaloWaveformFitting::print_fastfit_validation() const
+{
+  const auto &stats = m_fastfit_stats;
+  std::cout << "CaloWaveformFitting - fast template fit vs Minuit template fit: " << stats.nchannels << " channels, " << stats.nfitted << " fitted" << std::endl;
+  std::cout << "  amplitude: tolerance " << fastfit_amplitude_reltol << " relative + " << fastfit_amplitude_abstol << " ADC, "
+            << stats.nfail_amplitude << " outside, max relative difference " << stats.max_amplitude << std::endl;
+  std::cout << "  time: tolerance " << fastfit_time_tol << " samples, "
+            << stats.nfail_time << " outside, max difference " << stats.max_time << std::endl;
+  std::cout << "  chi2/ndf: tolerance " << fastfit_chi2_reltol << " relative + " << fastfit_chi2_abstol << ", "
+            << stats.nfail_chi2 << " outside, max relative difference " << stats.max_chi2 << std::endl;
+  std::cout << "  zero suppression or bit-flip recovery mismatches: " << stats.nfail_other << std::endl;
+}
+
 void CaloWaveformFitting::FastMax(float x0, float x1, float x2, float y0, float y1, float y2, float &xmax, float &ymax)
 {
   int n = 3;
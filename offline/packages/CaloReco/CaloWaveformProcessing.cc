@@ -27,7 +27,7 @@ void CaloWaveformProcessing::initialize_processing()
 {
   char *calibrationsroot = getenv("CALIBRATIONROOT");
   assert(calibrationsroot);
-  if (m_processingtype == CaloWaveformProcessing::TEMPLATE || m_processingtype == CaloWaveformProcessing::TEMPLATE_NOSAT)
+  if (m_processingtype == CaloWaveformProcessing::TEMPLATE || m_processingtype == CaloWaveformProcessing::TEMPLATE_NOSAT || m_processingtype == CaloWaveformProcessing::TEMPLATE_FAST)
   {
     std::string calibrations_repo_template = std::string(calibrationsroot) + "/WaveformProcessing/templates/" + m_template_input_file;
     url_template = CDBInterface::instance()->getUrl(m_template_name, calibrations_repo_template);
@@ -51,6 +51,10 @@ void CaloWaveformProcessing::initialize_processing()
     {
       m_Fitter->set_bitFlipRecovery(_dobitfliprecovery);
     }
+    if (m_processingtype == CaloWaveformProcessing::TEMPLATE_FAST)
+    {
+      m_Fitter->set_fastfit_validation(_fastfit_validation);
+    }
   }
   else if (m_processingtype == CaloWaveformProcessing::ONNX)
   {
@@ -92,6 +96,10 @@ std::vector<std::vector<float>> CaloWaveformProcessing::process_waveform(std::ve
     }
     fitresults = m_Fitter->calo_processing_templatefit(waveformvector);
   }
+  if (m_processingtype == CaloWaveformProcessing::TEMPLATE_FAST)
+  {
+    fitresults = m_Fitter->calo_processing_templatefit_fast(waveformvector);
+  }
   if (m_processingtype == CaloWaveformProcessing::ONNX)
   {
     fitresults = CaloWaveformProcessing::calo_processing_ONNX(waveformvector);
@@ -21,6 +21,7 @@ class CaloWaveformProcessing : public SubsysReco
     NYQUIST = 4,
     TEMPLATE_NOSAT = 5,
     FUNCFIT = 6,
+    TEMPLATE_FAST = 7,
   };
 
   CaloWaveformProcessing() = default;
@@ -76,6 +77,12 @@ class CaloWaveformProcessing : public SubsysReco
     _dobitfliprecovery = dobitfliprecovery;
   }
 
+  // TEMPLATE_FAST: compare with the Minuit template fit on one event out of prescale (0 = off)
+  void set_fastfit_validation(int prescale)
+  {
+    _fastfit_validation = prescale;
+  }
+
   // Functional fit options: 0 = PowerLawExp, 1 = PowerLawDoubleExp
   void set_funcfit_type(int type)
   {
@@ -115,6 +122,7 @@ class CaloWaveformProcessing : public SubsysReco
   int _nsoftwarezerosuppression{40};
   bool _bdosoftwarezerosuppression{false};
   bool _dobitfliprecovery{false};
+  int _fastfit_validation{0};
 
   std::string m_template_input_file;
   std::string url_template;
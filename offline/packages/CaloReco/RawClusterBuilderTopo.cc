@@ -26,7 +26,6 @@
 #include <exception>
 #include <iostream>
 #include <iterator>  // for begin, end
-#include <list>
 #include <memory>  // for allocator_traits<>::valu...
 #include <stdexcept>
 #include <utility>
@@ -198,6 +197,33 @@ std::vector<int> RawClusterBuilderTopo::get_adjacent_towers_by_ID(int ID)
   return adjacent_towers;
 }
 
+void RawClusterBuilderTopo::build_adjacency_table()
+{
+  int n_IDs = 2 * _EMCAL_NETA * _EMCAL_NPHI;
+
+  _ADJACENT_OFFSET_BY_ID.assign(n_IDs + 1, 0);
+  _ADJACENT_IDS.clear();
+  for (int ID = 0; ID < n_IDs; ID++)
+  {
+    _ADJACENT_OFFSET_BY_ID[ID] = _ADJACENT_IDS.size();
+
+    // IDs between the HCal and the EMCal ranges are not used
+    if (ID >= 2 * _HCAL_NETA * _HCAL_NPHI && ID < _EMCAL_NETA * _EMCAL_NPHI)
+    {
+      continue;
+    }
+
+    std::vector<int> adjacent_towers = get_adjacent_towers_by_ID(ID);
+    _ADJACENT_IDS.insert(_ADJACENT_IDS.end(), adjacent_towers.begin(), adjacent_towers.end());
+  }
+  _ADJACENT_OFFSET_BY_ID[n_IDs] = _ADJACENT_IDS.size();
+
+  if (Verbosity() > 0)
+  {
+    std::cout << "RawClusterBuilderTopo::build_adjacency_table: " << _ADJACENT_IDS.size() << " neighbor links for " << n_IDs << " tower IDs" << std::endl;
+  }
+}
+
 void RawClusterBuilderTopo::export_single_cluster(const std::vector<int> &original_towers)
 {
   if (Verbosity() > 2)
@@ -205,17 +231,16 @@ void RawClusterBuilderTopo::export_single_cluster(const std::vector<int> &origin
     std::cout << "RawClusterBuilderTopo::export_single_cluster called " << std::endl;
   }
 
-  std::map<int, std::pair<int, int> > tower_ownership;
   for (const int &original_tower : original_towers)
   {
-    tower_ownership[original_tower] = std::pair<int, int>(0, -1);  // all towers owned by cluster 0
+    _TOWER_OWNERSHIP_BY_ID[original_tower] = std::pair<int, int>(0, -1);  // all towers owned by cluster 0
   }
-  export_clusters(original_towers, tower_ownership, 1, std::vector<float>(), std::vector<float>(), std::vector<float>());
+  export_clusters(original_towers, _TOWER_OWNERSHIP_BY_ID, 1, std::vector<float>(), std::vector<float>(), std::vector<float>());
 
   return;
 }
 
-void RawClusterBuilderTopo::export_clusters(const std::vector<int> &original_towers, std::map<int, std::pair<int, int> > tower_ownership, unsigned int n_clusters, const std::vector<float> &pseudocluster_sumE, const std::vector<float> &pseudocluster_eta, const std::vector<float> &pseudocluster_phi)
+void RawClusterBuilderTopo::export_clusters(const std::vector<int> &original_towers, const std::vector<std::pair<int, int> > &tower_ownership, unsigned int n_clusters, const std::vector<float> &pseudocluster_sumE, const std::vector<float> &pseudocluster_eta, const std::vector<float> &pseudocluster_phi)
 {
   if (n_clusters != 1)  // if we didn't just pass down from export_single_cluster
   {
@@ -251,20 +276,10 @@ void RawClusterBuilderTopo::export_clusters(const std::vector<int> &original_tow
     {
       std::cout << "RawClusterBuilderTopo::export_clusters -> assigning tower " << original_tower << " with ownership ( " << the_pair.first << ", " << the_pair.second << " ) " << std::endl;
     }
-    int this_ieta = get_ieta_from_ID(this_ID);
-    int this_iphi = get_iphi_from_ID(this_ID);
     int this_layer = get_ilayer_from_ID(this_ID);
     float this_E = get_E_from_ID(this_ID);
 
-    int this_key = 0;
-    if (this_layer == 2)
-    {
-      this_key = _EMTOWERMAP_KEY_ETA_PHI[this_ieta][this_iphi];
-    }
-    else
-    {
-      this_key = _TOWERMAP_KEY_LAYER_ETA_PHI[this_layer][this_ieta][this_iphi];
-    }
+    int this_key = _TOWERMAP_KEY_BY_ID[this_ID];
 
     RawTowerGeom *tower_geom = _geom_containers[this_layer]->get_tower_geometry(this_key);
 
@@ -455,10 +470,6 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
     // define geometry only once if it has not been yet
     _EMCAL_NETA = _geom_containers[2]->get_etabins();
     _EMCAL_NPHI = _geom_containers[2]->get_phibins();
-
-    _EMTOWERMAP_STATUS_ETA_PHI.resize(_EMCAL_NETA, std::vector<int>(_EMCAL_NPHI, -2));
-    _EMTOWERMAP_KEY_ETA_PHI.resize(_EMCAL_NETA, std::vector<int>(_EMCAL_NPHI, 0));
-    _EMTOWERMAP_E_ETA_PHI.resize(_EMCAL_NETA, std::vector<float>(_EMCAL_NPHI, 0));
   }
 
   if (_HCAL_NETA < 0)
@@ -466,33 +477,25 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
     // define geometry only once if it has not been yet
     _HCAL_NETA = _geom_containers[1]->get_etabins();
     _HCAL_NPHI = _geom_containers[1]->get_phibins();
+  }
+
+  if (_ADJACENT_OFFSET_BY_ID.empty())
+  {
+    // allocate tower maps and precompute neighbors only once
+    int n_IDs = 2 * _EMCAL_NETA * _EMCAL_NPHI;
 
-    _TOWERMAP_STATUS_LAYER_ETA_PHI.resize(2, std::vector<std::vector<int> >(_HCAL_NETA, std::vector<int>(_HCAL_NPHI, -2)));
-    _TOWERMAP_KEY_LAYER_ETA_PHI.resize(2, std::vector<std::vector<int> >(_HCAL_NETA, std::vector<int>(_HCAL_NPHI, 0)));
-    _TOWERMAP_E_LAYER_ETA_PHI.resize(2, std::vector<std::vector<float> >(_HCAL_NETA, std::vector<float>(_HCAL_NPHI, 0)));
+    _TOWERMAP_STATUS_BY_ID.resize(n_IDs, -2);
+    _TOWERMAP_KEY_BY_ID.resize(n_IDs, 0);
+    _TOWERMAP_E_BY_ID.resize(n_IDs, 0);
+    _TOWER_OWNERSHIP_BY_ID.resize(n_IDs, std::pair<int, int>(-1, -1));
+
+    build_adjacency_table();
   }
 
   // reset maps
   // but note -- do not reset keys!
-  for (int ieta = 0; ieta < _EMCAL_NETA; ieta++)
-  {
-    for (int iphi = 0; iphi < _EMCAL_NPHI; iphi++)
-    {
-      _EMTOWERMAP_STATUS_ETA_PHI[ieta][iphi] = -2;  // set tower does not exist
-      _EMTOWERMAP_E_ETA_PHI[ieta][iphi] = 0;        // set zero energy
-    }
-  }
-  for (int ilayer = 0; ilayer < 2; ilayer++)
-  {
-    for (int ieta = 0; ieta < _HCAL_NETA; ieta++)
-    {
-      for (int iphi = 0; iphi < _HCAL_NPHI; iphi++)
-      {
-        _TOWERMAP_STATUS_LAYER_ETA_PHI[ilayer][ieta][iphi] = -2;  // set tower does not exist
-        _TOWERMAP_E_LAYER_ETA_PHI[ilayer][ieta][iphi] = 0;        // set zero energy
-      }
-    }
-  }
+  std::fill(_TOWERMAP_STATUS_BY_ID.begin(), _TOWERMAP_STATUS_BY_ID.end(), -2);  // set tower does not exist
+  std::fill(_TOWERMAP_E_BY_ID.begin(), _TOWERMAP_E_BY_ID.end(), 0);             // set zero energy
 
   // setup
   std::vector<std::pair<int, float> > list_of_seeds;
@@ -530,14 +533,14 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         continue;
       }
 
-      _EMTOWERMAP_STATUS_ETA_PHI[ieta][iphi] = -1;  // change status to unknown
-      _EMTOWERMAP_E_ETA_PHI[ieta][iphi] = this_E;
-      _EMTOWERMAP_KEY_ETA_PHI[ieta][iphi] = key;
+      int ID = get_ID(2, ieta, iphi);
+      _TOWERMAP_STATUS_BY_ID[ID] = -1;  // change status to unknown
+      _TOWERMAP_E_BY_ID[ID] = this_E;
+      _TOWERMAP_KEY_BY_ID[ID] = key;
 
       // use fabs() here for simplicity - if we're not using abs E, negative towers are already excluded
       if (std::fabs(this_E) >= _sigma_seed * _noise_LAYER[2])
       {
-        int ID = get_ID(2, ieta, iphi);
         list_of_seeds.emplace_back(ID, this_E);
         if (Verbosity() > 10)
         {
@@ -576,13 +579,13 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         continue;
       }
 
-      _TOWERMAP_STATUS_LAYER_ETA_PHI[0][ieta][iphi] = -1;  // change status to unknown
-      _TOWERMAP_E_LAYER_ETA_PHI[0][ieta][iphi] = this_E;
-      _TOWERMAP_KEY_LAYER_ETA_PHI[0][ieta][iphi] = key;
+      int ID = get_ID(0, ieta, iphi);
+      _TOWERMAP_STATUS_BY_ID[ID] = -1;  // change status to unknown
+      _TOWERMAP_E_BY_ID[ID] = this_E;
+      _TOWERMAP_KEY_BY_ID[ID] = key;
 
       if (std::fabs(this_E) >= _sigma_seed * _noise_LAYER[0])
       {
-        int ID = get_ID(0, ieta, iphi);
         list_of_seeds.emplace_back(ID, this_E);
         if (Verbosity() > 10)
         {
@@ -615,13 +618,13 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         continue;
       }
 
-      _TOWERMAP_STATUS_LAYER_ETA_PHI[1][ieta][iphi] = -1;  // change status to unknown
-      _TOWERMAP_E_LAYER_ETA_PHI[1][ieta][iphi] = this_E;
-      _TOWERMAP_KEY_LAYER_ETA_PHI[1][ieta][iphi] = key;
+      int ID = get_ID(1, ieta, iphi);
+      _TOWERMAP_STATUS_BY_ID[ID] = -1;  // change status to unknown
+      _TOWERMAP_E_BY_ID[ID] = this_E;
+      _TOWERMAP_KEY_BY_ID[ID] = key;
 
       if (std::fabs(this_E) >= _sigma_seed * _noise_LAYER[1])
       {
-        int ID = get_ID(1, ieta, iphi);
         list_of_seeds.emplace_back(ID, this_E);
         if (Verbosity() > 10)
         {
@@ -659,14 +662,13 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
 
   std::vector<std::vector<int> > all_cluster_towers;  // store final cluster tower lists here
 
-  while (!list_of_seeds.empty())
+  for (unsigned int iseed = 0; iseed < list_of_seeds.size(); iseed++)
   {
-    int seed_ID = list_of_seeds.at(0).first;
-    list_of_seeds.erase(list_of_seeds.begin());
+    int seed_ID = list_of_seeds[iseed].first;
 
     if (Verbosity() > 5)
     {
-      std::cout << " RawClusterBuilderTopo::process_event: in seeded loop, current seed has ID = " << seed_ID << " , length of remaining seed vector = " << list_of_seeds.size() << std::endl;
+      std::cout << " RawClusterBuilderTopo::process_event: in seeded loop, current seed has ID = " << seed_ID << " , length of remaining seed vector = " << list_of_seeds.size() - iseed - 1 << std::endl;
     }
 
     // if this seed was already claimed by some other seed during its growth, remove it and do nothing
@@ -686,8 +688,8 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
     std::vector<int> cluster_tower_ID;
     cluster_tower_ID.push_back(seed_ID);
 
-    std::vector<int> grow_tower_ID;
-    grow_tower_ID.push_back(seed_ID);
+    // during growth, cluster_tower_ID is also the queue of grow towers: those from grow_index onwards are still to be examined
+    unsigned int grow_index = 0;
 
     // iteratively process growth towers, adding > 2 * sigma neighbors to the list for further checking
 
@@ -696,17 +698,17 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
       std::cout << " RawClusterBuilderTopo::process_event: Entering Growth stage for cluster " << cluster_index << std::endl;
     }
 
-    while (!grow_tower_ID.empty())
+    while (grow_index < cluster_tower_ID.size())
     {
-      int grow_ID = grow_tower_ID.at(0);
-      grow_tower_ID.erase(grow_tower_ID.begin());
+      int grow_ID = cluster_tower_ID[grow_index];
+      grow_index++;
 
       if (Verbosity() > 5)
       {
-        std::cout << " --> cluster " << cluster_index << ", growth stage, examining neighbors of ID " << grow_ID << ", " << grow_tower_ID.size() << " grow towers left" << std::endl;
+        std::cout << " --> cluster " << cluster_index << ", growth stage, examining neighbors of ID " << grow_ID << ", " << cluster_tower_ID.size() - grow_index << " grow towers left" << std::endl;
       }
 
-      std::vector<int> adjacent_tower_IDs = get_adjacent_towers_by_ID(grow_ID);
+      AdjacentTowers adjacent_tower_IDs = get_adjacent_towers(grow_ID);
 
       for (int this_adjacent_tower_ID : adjacent_tower_IDs)
       {
@@ -757,7 +759,6 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         }
 
         // tower good to be added to cluster and to list of grow towers
-        grow_tower_ID.push_back(this_adjacent_tower_ID);
         cluster_tower_ID.push_back(this_adjacent_tower_ID);
         set_status_by_ID(this_adjacent_tower_ID, cluster_index);
         if (Verbosity() > 10)
@@ -768,7 +769,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
 
       if (Verbosity() > 5)
       {
-        std::cout << " --> after examining neighbors, grow list is now " << grow_tower_ID.size() << ", # of towers in cluster = " << cluster_tower_ID.size() << std::endl;
+        std::cout << " --> after examining neighbors, grow list is now " << cluster_tower_ID.size() - grow_index << ", # of towers in cluster = " << cluster_tower_ID.size() << std::endl;
       }
     }
 
@@ -788,7 +789,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
       {
         std::cout << " --> cluster " << cluster_index << ", perimeter stage, examining neighbors of ID " << core_ID << ", core cluster # " << ic << " of " << n_core_towers << " total " << std::endl;
       }
-      std::vector<int> adjacent_tower_IDs = get_adjacent_towers_by_ID(core_ID);
+      AdjacentTowers adjacent_tower_IDs = get_adjacent_towers(core_ID);
 
       for (int this_adjacent_tower_ID : adjacent_tower_IDs)
       {
@@ -845,7 +846,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
     }
 
     // keep track of these
-    all_cluster_towers.push_back(cluster_tower_ID);
+    all_cluster_towers.push_back(std::move(cluster_tower_ID));
 
     // increment cluster index for next one
     cluster_index++;
@@ -862,7 +863,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
 
   for (int cl = 0; cl < original_cluster_index; cl++)
   {
-    std::vector<int> original_towers = all_cluster_towers.at(cl);
+    const std::vector<int> &original_towers = all_cluster_towers.at(cl);
 
     if (!_do_split)
     {
@@ -896,7 +897,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
       }
 
       // examine neighbors
-      std::vector<int> adjacent_tower_IDs = get_adjacent_towers_by_ID(tower_ID);
+      AdjacentTowers adjacent_tower_IDs = get_adjacent_towers(tower_ID);
       int neighbors_in_cluster = 0;
 
       // check for higher neighbor
@@ -1043,8 +1044,8 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
     // -1 means unseen
     // -2 means seen and in the seed list now (e.g. don't add it to the seed list again)
     // -3 shared tower, ignore going forward...
-    std::map<int, std::pair<int, int> > tower_ownership;
-    for (int &original_tower : original_towers)
+    std::vector<std::pair<int, int> > &tower_ownership = _TOWER_OWNERSHIP_BY_ID;
+    for (int original_tower : original_towers)
     {
       tower_ownership[original_tower] = std::pair<int, int>(-1, -1);  // initialize all towers as un-seen
     }
@@ -1052,6 +1053,10 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
     std::vector<int> neighbor_list;
     std::vector<int> shared_list;
 
+    std::vector<int> new_ownerships;
+    std::vector<int> new_neighbor_list;
+    std::vector<bool> pseudocluster_adjacency;
+
     // sort maxima before populating seed list
     std::sort(local_maxima_ID.begin(), local_maxima_ID.end(), sort_by_pair_second);
 
@@ -1064,7 +1069,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
 
     if (Verbosity() > 100)
     {
-      for (int &original_tower : original_towers)
+      for (int original_tower : original_towers)
       {
         std::pair<int, int> the_pair = tower_ownership[original_tower];
         std::cout << " Debug Pre-Split: tower_ownership[ " << original_tower << " ] = ( " << the_pair.first << ", " << the_pair.second << " ) ";
@@ -1082,7 +1087,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         std::cout << " -> starting split loop with " << seed_list.size() << " seed, " << neighbor_list.size() << " neighbor, and " << shared_list.size() << " shared towers " << std::endl;
       }
       // go through neighbor list, assigning ownership only via the seed list
-      std::vector<int> new_ownerships;
+      new_ownerships.clear();
 
       for (unsigned int n = 0; n < neighbor_list.size(); n++)
       {
@@ -1102,13 +1107,9 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         }
         else
         {
-          std::map<int, bool> pseudocluster_adjacency;
-          for (unsigned int s = 0; s < local_maxima_ID.size(); s++)
-          {
-            pseudocluster_adjacency[s] = false;
-          }
+          pseudocluster_adjacency.assign(local_maxima_ID.size(), false);
           // look over all towers THIS one is adjacent to, and count up...
-          std::vector<int> adjacent_tower_IDs = get_adjacent_towers_by_ID(neighbor_ID);
+          AdjacentTowers adjacent_tower_IDs = get_adjacent_towers(neighbor_ID);
 
           for (int this_adjacent_tower_ID : adjacent_tower_IDs)
           {
@@ -1198,13 +1199,13 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         std::cout << " producing a new neighbor list ... " << std::endl;
       }
       // populate a new neighbor list from the about-to-be-owned towers before transferring this one
-      std::list<int> new_neighbor_list;
+      new_neighbor_list.clear();
       for (unsigned int n = 0; n < neighbor_list.size(); n++)
       {
         int neighbor_ID = neighbor_list.at(n);
         if (new_ownerships.at(n) > -1)
         {
-          std::vector<int> adjacent_tower_IDs = get_adjacent_towers_by_ID(neighbor_ID);
+          AdjacentTowers adjacent_tower_IDs = get_adjacent_towers(neighbor_ID);
 
           for (int this_adjacent_tower_ID : adjacent_tower_IDs)
           {
@@ -1229,23 +1230,16 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         std::cout << " new neighbor list has size " << new_neighbor_list.size() << ", but after removing duplicate elements: ";
       }
 
-      new_neighbor_list.sort();
-      new_neighbor_list.unique();
+      std::sort(new_neighbor_list.begin(), new_neighbor_list.end());
+      new_neighbor_list.erase(std::unique(new_neighbor_list.begin(), new_neighbor_list.end()), new_neighbor_list.end());
 
       if (Verbosity() > 5)
       {
         std::cout << new_neighbor_list.size() << std::endl;
       }
 
-      // clear neighbor list!
-      neighbor_list.clear();
-
       // now transfer over new neighbor list
-      for (; !new_neighbor_list.empty();)
-      {
-        neighbor_list.push_back(new_neighbor_list.front());
-        new_neighbor_list.pop_front();
-      }
+      neighbor_list.swap(new_neighbor_list);
 
       first_pass = false;
 
@@ -1253,7 +1247,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
 
     if (Verbosity() > 100)
     {
-      for (int &original_tower : original_towers)
+      for (int original_tower : original_towers)
       {
         std::pair<int, int> the_pair = tower_ownership[original_tower];
         std::cout << " Debug Mid-Split: tower_ownership[ " << original_tower << " ] = ( " << the_pair.first << ", " << the_pair.second << " ) ";
@@ -1261,7 +1255,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         std::cout << std::endl;
         if (the_pair.first == -1)
         {
-          std::vector<int> adjacent_tower_IDs = get_adjacent_towers_by_ID(original_tower);
+          AdjacentTowers adjacent_tower_IDs = get_adjacent_towers(original_tower);
 
           for (int this_adjacent_tower_ID : adjacent_tower_IDs)
           {
@@ -1288,7 +1282,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
     pseudocluster_sumE.resize(local_maxima_ID.size(), 0);
     pseudocluster_ntower.resize(local_maxima_ID.size(), 0);
 
-    for (int &original_tower : original_towers)
+    for (int original_tower : original_towers)
     {
       std::pair<int, int> the_pair = tower_ownership[original_tower];
       if (the_pair.first > -1)
@@ -1320,21 +1314,19 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
       std::cout << "RawClusterBuilderTopo::process_event now splitting up shared clusters (including unassigned clusters), initial shared list has size " << shared_list.size() << std::endl;
     }
     // iterate through shared cells, identifying which two they belong to
-    while (!shared_list.empty())
+    for (unsigned int ishared = 0; ishared < shared_list.size(); ishared++)
     {
-      // pick the first cell and pop off list
-      int shared_ID = shared_list.at(0);
-      shared_list.erase(shared_list.begin());
+      // pick the next cell, the list is only appended to
+      int shared_ID = shared_list[ishared];
 
       if (Verbosity() > 5)
       {
-        std::cout << " -> looking at shared tower " << shared_ID << ", after this one there are " << shared_list.size() << " shared towers left " << std::endl;
+        std::cout << " -> looking at shared tower " << shared_ID << ", after this one there are " << shared_list.size() - ishared - 1 << " shared towers left " << std::endl;
       }
       // look through adjacent pseudoclusters, taking two with highest energies
-      std::vector<bool> pseudocluster_adjacency;
-      pseudocluster_adjacency.resize(local_maxima_ID.size(), false);
+      pseudocluster_adjacency.assign(local_maxima_ID.size(), false);
 
-      std::vector<int> adjacent_tower_IDs = get_adjacent_towers_by_ID(shared_ID);
+      AdjacentTowers adjacent_tower_IDs = get_adjacent_towers(shared_ID);
 
       for (int this_adjacent_tower_ID : adjacent_tower_IDs)
       {
@@ -1401,7 +1393,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
 
     if (Verbosity() > 100)
     {
-      for (int &original_tower : original_towers)
+      for (int original_tower : original_towers)
       {
         std::pair<int, int> the_pair = tower_ownership[original_tower];
         std::cout << " Debug Post-Split: tower_ownership[ " << original_tower << " ] = ( " << the_pair.first << ", " << the_pair.second << " ) ";
@@ -1409,7 +1401,7 @@ int RawClusterBuilderTopo::process_event(PHCompositeNode *topNode)
         std::cout << std::endl;
         if (the_pair.first == -1)
         {
-          std::vector<int> adjacent_tower_IDs = get_adjacent_towers_by_ID(original_tower);
+          AdjacentTowers adjacent_tower_IDs = get_adjacent_towers(original_tower);
 
           for (int this_adjacent_tower_ID : adjacent_tower_IDs)
           {
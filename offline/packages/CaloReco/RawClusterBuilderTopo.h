@@ -9,7 +9,6 @@
 
 #include <fun4all/SubsysReco.h>
 
-#include <map>
 #include <string>
 #include <utility>  // for pair
 #include <vector>
@@ -126,11 +125,29 @@ class RawClusterBuilderTopo : public SubsysReco
 
   std::vector<int> get_adjacent_towers_by_ID(int ID);
 
+  // fill the neighbor table of all towers, once the geometry is known
+  void build_adjacency_table();
+
+  // view on the precomputed neighbors of a tower
+  struct AdjacentTowers
+  {
+    const int *first;
+    const int *last;
+    const int *begin() const { return first; }
+    const int *end() const { return last; }
+  };
+
+  // same towers, in the same order, as get_adjacent_towers_by_ID, without allocation
+  AdjacentTowers get_adjacent_towers(int ID) const
+  {
+    return {_ADJACENT_IDS.data() + _ADJACENT_OFFSET_BY_ID[ID], _ADJACENT_IDS.data() + _ADJACENT_OFFSET_BY_ID[ID + 1]};
+  }
+
   static float calculate_dR(float, float, float, float);
 
   void export_single_cluster(const std::vector<int> &);
 
-  void export_clusters(const std::vector<int> &, std::map<int, std::pair<int, int> >, unsigned int, const std::vector<float> &, const std::vector<float> &, const std::vector<float> &);
+  void export_clusters(const std::vector<int> &, const std::vector<std::pair<int, int> > &, unsigned int, const std::vector<float> &, const std::vector<float> &, const std::vector<float> &);
 
   int get_ID(int ilayer, int ieta, int iphi)
   {
@@ -177,34 +194,19 @@ class RawClusterBuilderTopo : public SubsysReco
     }
   }
 
-  int get_status_from_ID(int ID)
+  int get_status_from_ID(int ID) const
   {
-    if (ID < _EMCAL_NPHI * _EMCAL_NETA)
-    {
-      return _TOWERMAP_STATUS_LAYER_ETA_PHI[get_ilayer_from_ID(ID)][get_ieta_from_ID(ID)][get_iphi_from_ID(ID)];
-    }
-    return _EMTOWERMAP_STATUS_ETA_PHI[get_ieta_from_ID(ID)][get_iphi_from_ID(ID)];
+    return _TOWERMAP_STATUS_BY_ID[ID];
   }
 
-  float get_E_from_ID(int ID)
+  float get_E_from_ID(int ID) const
   {
-    if (ID < _EMCAL_NPHI * _EMCAL_NETA)
-    {
-      return _TOWERMAP_E_LAYER_ETA_PHI[get_ilayer_from_ID(ID)][get_ieta_from_ID(ID)][get_iphi_from_ID(ID)];
-    }
-    return _EMTOWERMAP_E_ETA_PHI[get_ieta_from_ID(ID)][get_iphi_from_ID(ID)];
+    return _TOWERMAP_E_BY_ID[ID];
   }
 
   void set_status_by_ID(int ID, int status)
   {
-    if (ID < _EMCAL_NPHI * _EMCAL_NETA)
-    {
-      _TOWERMAP_STATUS_LAYER_ETA_PHI[get_ilayer_from_ID(ID)][get_ieta_from_ID(ID)][get_iphi_from_ID(ID)] = status;
-    }
-    else
-    {
-      _EMTOWERMAP_STATUS_ETA_PHI[get_ieta_from_ID(ID)][get_iphi_from_ID(ID)] = status;
-    }
+    _TOWERMAP_STATUS_BY_ID[ID] = status;
   }
 
   RawClusterContainer *_clusters {nullptr};
@@ -236,13 +238,19 @@ class RawClusterBuilderTopo : public SubsysReco
   bool _do_split {true};
   bool _only_good_towers {true};
 
-  std::vector<std::vector<std::vector<float> > > _TOWERMAP_E_LAYER_ETA_PHI;
-  std::vector<std::vector<std::vector<int> > > _TOWERMAP_KEY_LAYER_ETA_PHI;
-  std::vector<std::vector<std::vector<int> > > _TOWERMAP_STATUS_LAYER_ETA_PHI;
+  // tower state, indexed by tower ID. HCal towers use [0, 2 * _HCAL_NETA * _HCAL_NPHI),
+  // EMCal towers [_EMCAL_NETA * _EMCAL_NPHI, 2 * _EMCAL_NETA * _EMCAL_NPHI)
+  std::vector<float> _TOWERMAP_E_BY_ID;
+  std::vector<int> _TOWERMAP_KEY_BY_ID;
+  std::vector<int> _TOWERMAP_STATUS_BY_ID;
+
+  // neighbors of tower ID are _ADJACENT_IDS[_ADJACENT_OFFSET_BY_ID[ID] .. _ADJACENT_OFFSET_BY_ID[ID + 1])
+  std::vector<int> _ADJACENT_OFFSET_BY_ID;
+  std::vector<int> _ADJACENT_IDS;
 
-  std::vector<std::vector<float> > _EMTOWERMAP_E_ETA_PHI;
-  std::vector<std::vector<int> > _EMTOWERMAP_KEY_ETA_PHI;
-  std::vector<std::vector<int> > _EMTOWERMAP_STATUS_ETA_PHI;
+  // (first, second) pseudocluster owning each tower during splitting, indexed by tower ID.
+  // Only the entries of the towers of the cluster being split are meaningful
+  std::vector<std::pair<int, int> > _TOWER_OWNERSHIP_BY_ID;
 
   std::string _inputnodeprefix;
   std::string ClusterNodeName {"TOPOCLUSTER_HCAL"};
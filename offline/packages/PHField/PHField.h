@@ -3,6 +3,8 @@
 
 // units of this class. To convert internal value to Geant4/CLHEP units for fast access
 
+#include <cstddef>
+
 //! \brief transient object for field storage and access
 class PHField
 {
@@ -30,6 +32,19 @@ class PHField
       double *Bfield) const
   { return GetFieldValue( Point, Bfield ); }
 
+  //! batch field accessor
+  /* Points holds 4 values (x, y, z, t) and Bfield 3 values per point. By default, loops over GetFieldValue_nocache */
+  virtual void GetFieldValues(
+      const std::size_t n,
+      const double *Points,
+      double *Bfield) const
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      GetFieldValue_nocache(Points + 4 * i, Bfield + 3 * i);
+    }
+  }
+
   //! verbosity
   void Verbosity(const int i) { m_Verbosity = i; }
 
@@ -11,32 +11,41 @@
 
 #include <boost/stacktrace.hpp>
 
-#include <cassert>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
-#include <iterator>
 #include <set>
-#include <utility>
 
-PHField3DCartesian::PHField3DCartesian(const std::string &fname, const float magfield_rescale, const float innerradius, const float outerradius, const float size_z)
-  : filename(fname)
+namespace
 {
-  std::cout << "PHField3DCartesian::PHField3DCartesian" << std::endl;
-
-  for (int i = 0; i < 2; i++) // NOLINT (modernize-loop-convert)
+  //! index of the grid cell [vals[i], vals[i+1]] containing pos, and distance to vals[i] normalized to the step size
+  inline std::size_t locate(const std::vector<float> &vals, const double min, const double step, const double pos, double &fraction)
   {
-    for (int j = 0; j < 2; j++)
+    const std::size_t last = vals.size() - 2;
+    std::size_t i = std::min(static_cast<std::size_t>((pos - min) / step), last);
+
+    // the grid is only regular up to float rounding of the coordinates
+    if (i > 0 && pos < vals[i])
+    {
+      --i;
+    }
+    else if (i < last && pos > vals[i + 1])
     {
-      for (int k = 0; k < 2; k++)
-      {
-        for (int l = 0; l < 3; l++)
-        {
-          bf[i][j][k][l] = {std::numeric_limits<double>::quiet_NaN()};
-        }
-      }
+      ++i;
     }
+
+    fraction = (pos - vals[i]) / step;
+    return i;
   }
+}  // namespace
+
+PHField3DCartesian::PHField3DCartesian(const std::string &fname, const float magfield_rescale, const float innerradius, const float outerradius, const float size_z)
+  : filename(fname)
+{
+  std::cout << "PHField3DCartesian::PHField3DCartesian" << std::endl;
+
   std::cout << "\n================ Begin Construct Mag Field =====================" << std::endl;
   std::cout << "\n-----------------------------------------------------------"
             << "\n      Magnetic field Module - Verbosity:"
@@ -76,26 +85,27 @@ PHField3DCartesian::PHField3DCartesian(const std::string &fname, const float mag
   field_map->SetBranchAddress("bx", &ROOT_BX);
   field_map->SetBranchAddress("by", &ROOT_BY);
   field_map->SetBranchAddress("bz", &ROOT_BZ);
+
+  // first pass: grid coordinates
+  std::set<float> xset;
+  std::set<float> yset;
+  std::set<float> zset;
   for (int i = 0; i < field_map->GetEntries(); i++)
   {
     field_map->GetEntry(i);
-    trio coord_key(ROOT_X * cm, ROOT_Y * cm, ROOT_Z * cm);
-    trio field_val(ROOT_BX * tesla * magfield_rescale, ROOT_BY * tesla * magfield_rescale, ROOT_BZ * tesla * magfield_rescale);
-    xvals.insert(ROOT_X * cm);
-    yvals.insert(ROOT_Y * cm);
-    zvals.insert(ROOT_Z * cm);
-    if ((std::sqrt(ROOT_X * cm * ROOT_X * cm + ROOT_Y * cm * ROOT_Y * cm) >= innerradius &&
-         std::sqrt(ROOT_X * cm * ROOT_X * cm + ROOT_Y * cm * ROOT_Y * cm) <= outerradius) ||
-        std::abs(ROOT_Z * cm) > size_z)
-    {
-      fieldmap[coord_key] = field_val;
-    }
+    xset.insert(ROOT_X * cm);
+    yset.insert(ROOT_Y * cm);
+    zset.insert(ROOT_Z * cm);
   }
-  xmin = *(xvals.begin());
-  xmax = *(xvals.rbegin());
+  xvals.assign(xset.begin(), xset.end());
+  yvals.assign(yset.begin(), yset.end());
+  zvals.assign(zset.begin(), zset.end());
+
+  xmin = xvals.front();
+  xmax = xvals.back();
 
-  ymin = *(yvals.begin());
-  ymax = *(yvals.rbegin());
+  ymin = yvals.front();
+  ymax = yvals.back();
   if (ymin != xmin || ymax != xmax)
   {
     std::cout << "PHField3DCartesian: Compiler bug!!!!!!!! Do not use inlining!!!!!!" << std::endl;
@@ -103,35 +113,47 @@ PHField3DCartesian::PHField3DCartesian(const std::string &fname, const float mag
     exit(1);
   }
 
-  zmin = *(zvals.begin());
-  zmax = *(zvals.rbegin());
+  zmin = zvals.front();
+  zmax = zvals.back();
 
   xstepsize = (xmax - xmin) / (xvals.size() - 1);
   ystepsize = (ymax - ymin) / (yvals.size() - 1);
   zstepsize = (zmax - zmin) / (zvals.size() - 1);
 
+  // second pass: field values on the dense grid
+  const std::size_t gridsize = xvals.size() * yvals.size() * zvals.size();
+  fieldx.assign(gridsize, std::numeric_limits<float>::quiet_NaN());
+  fieldy.assign(gridsize, std::numeric_limits<float>::quiet_NaN());
+  fieldz.assign(gridsize, std::numeric_limits<float>::quiet_NaN());
+  for (int i = 0; i < field_map->GetEntries(); i++)
+  {
+    field_map->GetEntry(i);
+    if ((std::sqrt(ROOT_X * cm * ROOT_X * cm + ROOT_Y * cm * ROOT_Y * cm) >= innerradius &&
+         std::sqrt(ROOT_X * cm * ROOT_X * cm + ROOT_Y * cm * ROOT_Y * cm) <= outerradius) ||
+        std::abs(ROOT_Z * cm) > size_z)
+    {
+      const std::size_t ix = std::lower_bound(xvals.begin(), xvals.end(), static_cast<float>(ROOT_X * cm)) - xvals.begin();
+      const std::size_t iy = std::lower_bound(yvals.begin(), yvals.end(), static_cast<float>(ROOT_Y * cm)) - yvals.begin();
+      const std::size_t iz = std::lower_bound(zvals.begin(), zvals.end(), static_cast<float>(ROOT_Z * cm)) - zvals.begin();
+      const std::size_t index = (ix * yvals.size() + iy) * zvals.size() + iz;
+      fieldx[index] = ROOT_BX * tesla * magfield_rescale;
+      fieldy[index] = ROOT_BY * tesla * magfield_rescale;
+      fieldz[index] = ROOT_BZ * tesla * magfield_rescale;
+    }
+  }
+
   delete field_map;
   delete rootinput;
   std::cout << "\n================= End Construct Mag Field ======================\n"
             << std::endl;
 }
 
-PHField3DCartesian::~PHField3DCartesian()
-{
-  if (Verbosity() > 0)
-  {
-    std::cout << "PHField3DCartesian: cache hits: " << cache_hits
-              << " cache misses: " << cache_misses
-              << std::endl;
-  }
-}
-
 void PHField3DCartesian::GetFieldValue(const double point[4], double *Bfield) const
 {
-
-  static double xsav = -1000000.;
-  static double ysav = -1000000.;
-  static double zsav = -1000000.;
+  // last valid point, only used in the diagnostic below. Kept per thread so that concurrent calls do not race
+  thread_local double xsav = -1000000.;
+  thread_local double ysav = -1000000.;
+  thread_local double zsav = -1000000.;
 
   const double& x = point[0];
   const double& y = point[1];
@@ -142,8 +164,8 @@ void PHField3DCartesian::GetFieldValue(const double point[4], double *Bfield) co
   Bfield[2] = 0.0;
   if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z))
   {
-    static int ifirst = 0;
-    if (ifirst < 10)
+    static std::atomic<int> ifirst = 0;
+    if (ifirst < 10 && ifirst++ < 10)
     {
       std::cout << "PHField3DCartesian::GetFieldValue: "
         << "Invalid coordinates: "
@@ -160,7 +182,6 @@ void PHField3DCartesian::GetFieldValue(const double point[4], double *Bfield) co
       std::cout << "Here is the stacktrace: " << std::endl;
       std::cout << boost::stacktrace::stacktrace();
       std::cout << "This is not a segfault. Check the stacktrace for the guilty party (typically #2)" << std::endl;
-      ifirst++;
     }
     return;
   }
@@ -169,313 +190,83 @@ void PHField3DCartesian::GetFieldValue(const double point[4], double *Bfield) co
   ysav = y;
   zsav = z;
 
-  if (point[0] < xmin || point[0] > xmax ||
-      point[1] < ymin || point[1] > ymax ||
-      point[2] < zmin || point[2] > zmax)
-  {
-    return;
-  }
-
-  double xkey[2];
-  std::set<float>::const_iterator it = xvals.lower_bound(x);
-  xkey[0] = *it;
-  if (it == xvals.begin())
-  {
-    xkey[1] = *it;
-    if (x < xkey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! x too small - outside range: " << x / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    xkey[1] = *it;
-  }
-
-  double ykey[2];
-  it = yvals.lower_bound(y);
-  ykey[0] = *it;
-  if (it == yvals.begin())
-  {
-    ykey[1] = *it;
-    if (y < ykey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! y too small - outside range: " << y / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    ykey[1] = *it;
-  }
-  double zkey[2];
-  it = zvals.lower_bound(z);
-  zkey[0] = *it;
-  if (it == zvals.begin())
-  {
-    zkey[1] = *it;
-    if (z < zkey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! z too small - outside range: " << z / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    zkey[1] = *it;
-  }
-
-  if (xkey_save != xkey[0] ||
-      ykey_save != ykey[0] ||
-      zkey_save != zkey[0])
-  {
-    cache_misses++;
-    xkey_save = xkey[0];
-    ykey_save = ykey[0];
-    zkey_save = zkey[0];
-
-    std::map<std::tuple<float, float, float>, std::tuple<float, float, float> >::const_iterator magval;
-    trio key;
-    for (int i = 0; i < 2; i++)
-    {
-      for (int j = 0; j < 2; j++)
-      {
-        for (int k = 0; k < 2; k++)
-        {
-          key = std::make_tuple(xkey[i], ykey[j], zkey[k]);
-          magval = fieldmap.find(key);
-          if (magval == fieldmap.end())
-          {
-            std::cout << PHWHERE << " could not locate key in " << filename
-                      << " value: x: " << xkey[i] / cm
-                      << ", y: " << ykey[j] / cm
-                      << ", z: " << zkey[k] / cm << std::endl;
-            return;
-          }
-          bf[i][j][k][0] = std::get<0>(magval->second);
-          bf[i][j][k][1] = std::get<1>(magval->second);
-          bf[i][j][k][2] = std::get<2>(magval->second);
-          if (Verbosity() > 0)
-          {
-            const double x_loc = std::get<0>(magval->first);
-            const double y_loc = std::get<1>(magval->first);
-            const double z_loc = std::get<2>(magval->first);
-
-            std::cout << "read x/y/z: " << x_loc / cm << "/"
-              << y_loc / cm << "/"
-              << z_loc / cm << " bx/by/bz: "
-              << bf[i][j][k][0] / tesla << "/"
-              << bf[i][j][k][1] / tesla << "/"
-              << bf[i][j][k][2] / tesla << std::endl;
-          }
-        }
-      }
-    }
-  }
-  else
-  {
-    cache_hits++;
-  }
-
-  // how far are we away from the reference point
-  double xinblock = point[0] - xkey[1];
-  double yinblock = point[1] - ykey[1];
-  double zinblock = point[2] - zkey[1];
-  // normalize distance to step size
-  double fractionx = xinblock / xstepsize;
-  double fractiony = yinblock / ystepsize;
-  double fractionz = zinblock / zstepsize;
-  if (Verbosity() > 0)
-  {
-    std::cout << "x/y/z stepsize: " << xstepsize / cm << "/" << ystepsize / cm << "/" << zstepsize / cm << std::endl;
-    std::cout << "x/y/z inblock: " << xinblock / cm << "/" << yinblock / cm << "/" << zinblock / cm << std::endl;
-    std::cout << "x/y/z fraction: " << fractionx << "/" << fractiony << "/" << fractionz << std::endl;
-  }
-
-  // linear extrapolation in cube:
+  interpolate(point, Bfield);
+}
 
-  // Vxyz =
-  // V000 * x * y * z +
-  // V100 * (1 - x) * y * z +
-  // V010 * x * (1 - y) * z +
-  // V001 * x y * (1 - z) +
-  // V101 * (1 - x) * y * (1 - z) +
-  // V011 * x * (1 - y) * (1 - z) +
-  // V110 * (1 - x) * (1 - y) * z +
-  // V111 * (1 - x) * (1 - y) * (1 - z)
+//_____________________________________________________________
+void PHField3DCartesian::GetFieldValue_nocache(const double point[4], double *Bfield) const
+{
+  interpolate(point, Bfield);
+}
 
-  for (int i = 0; i < 3; i++)
+//_____________________________________________________________
+void PHField3DCartesian::GetFieldValues(const std::size_t n, const double *points, double *Bfield) const
+{
+  for (std::size_t i = 0; i < n; ++i)
   {
-    Bfield[i] = bf[0][0][0][i] * fractionx * fractiony * fractionz +
-                bf[1][0][0][i] * (1. - fractionx) * fractiony * fractionz +
-                bf[0][1][0][i] * fractionx * (1. - fractiony) * fractionz +
-                bf[0][0][1][i] * fractionx * fractiony * (1. - fractionz) +
-                bf[1][0][1][i] * (1. - fractionx) * fractiony * (1. - fractionz) +
-                bf[0][1][1][i] * fractionx * (1. - fractiony) * (1. - fractionz) +
-                bf[1][1][0][i] * (1. - fractionx) * (1. - fractiony) * fractionz +
-                bf[1][1][1][i] * (1. - fractionx) * (1. - fractiony) * (1. - fractionz);
+    interpolate(points + 4 * i, Bfield + 3 * i);
   }
-
-  return;
 }
 
 //_____________________________________________________________
-void PHField3DCartesian::GetFieldValue_nocache(const double point[4], double *Bfield) const
+void PHField3DCartesian::interpolate(const double point[4], double *Bfield) const
 {
-
-  const double& x = point[0];
-  const double& y = point[1];
-  const double& z = point[2];
-
   Bfield[0] = 0.0;
   Bfield[1] = 0.0;
   Bfield[2] = 0.0;
-  if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z))
-  { return; }
 
-  if (point[0] < xmin || point[0] > xmax ||
-      point[1] < ymin || point[1] > ymax ||
-      point[2] < zmin || point[2] > zmax)
-  { return; }
-
-  double xkey[2];
-  std::set<float>::const_iterator it = xvals.lower_bound(x);
-  xkey[0] = *it;
-  if (it == xvals.begin())
-  {
-    xkey[1] = *it;
-    if (x < xkey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! x too small - outside range: " << x / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    xkey[1] = *it;
-  }
-
-  double ykey[2];
-  it = yvals.lower_bound(y);
-  ykey[0] = *it;
-  if (it == yvals.begin())
+  // written so that NaN coordinates also fail
+  if (!(point[0] >= xmin && point[0] <= xmax &&
+        point[1] >= ymin && point[1] <= ymax &&
+        point[2] >= zmin && point[2] <= zmax))
   {
-    ykey[1] = *it;
-    if (y < ykey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! y too small - outside range: " << y / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    ykey[1] = *it;
-  }
-  double zkey[2];
-  it = zvals.lower_bound(z);
-  zkey[0] = *it;
-  if (it == zvals.begin())
-  {
-    zkey[1] = *it;
-    if (z < zkey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! z too small - outside range: " << z / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    zkey[1] = *it;
-  }
-
-  // local xyz and field
-  double bf_loc[2][2][2][3]{};
-
-  std::map<std::tuple<float, float, float>, std::tuple<float, float, float> >::const_iterator magval;
-  trio key;
-  for (int i = 0; i < 2; i++)
-  {
-    for (int j = 0; j < 2; j++)
-    {
-      for (int k = 0; k < 2; k++)
-      {
-        key = std::make_tuple(xkey[i], ykey[j], zkey[k]);
-        magval = fieldmap.find(key);
-        if (magval == fieldmap.end())
-        {
-          std::cout << PHWHERE << " could not locate key in " << filename
-            << " value: x: " << xkey[i] / cm
-            << ", y: " << ykey[j] / cm
-            << ", z: " << zkey[k] / cm << std::endl;
-          return;
-        }
-
-        bf_loc[i][j][k][0] = std::get<0>(magval->second);
-        bf_loc[i][j][k][1] = std::get<1>(magval->second);
-        bf_loc[i][j][k][2] = std::get<2>(magval->second);
-        if (Verbosity() > 0)
-        {
-
-          const double x_loc = std::get<0>(magval->first);
-          const double y_loc = std::get<1>(magval->first);
-          const double z_loc = std::get<2>(magval->first);
-
-          std::cout << "read x/y/z: " << x_loc / cm << "/"
-            << y_loc / cm << "/"
-            << z_loc / cm << " bx/by/bz: "
-            << bf_loc[i][j][k][0] / tesla << "/"
-            << bf_loc[i][j][k][1] / tesla << "/"
-            << bf_loc[i][j][k][2] / tesla << std::endl;
-        }
-      }
-    }
+    return;
   }
 
-  // how far are we away from the reference point
-  double xinblock = point[0] - xkey[1];
-  double yinblock = point[1] - ykey[1];
-  double zinblock = point[2] - zkey[1];
-  // normalize distance to step size
-  double fractionx = xinblock / xstepsize;
-  double fractiony = yinblock / ystepsize;
-  double fractionz = zinblock / zstepsize;
+  double fractionx = 0;
+  double fractiony = 0;
+  double fractionz = 0;
+  const std::size_t ix = locate(xvals, xmin, xstepsize, point[0], fractionx);
+  const std::size_t iy = locate(yvals, ymin, ystepsize, point[1], fractiony);
+  const std::size_t iz = locate(zvals, zmin, zstepsize, point[2], fractionz);
   if (Verbosity() > 0)
   {
     std::cout << "x/y/z stepsize: " << xstepsize / cm << "/" << ystepsize / cm << "/" << zstepsize / cm << std::endl;
-    std::cout << "x/y/z inblock: " << xinblock / cm << "/" << yinblock / cm << "/" << zinblock / cm << std::endl;
+    std::cout << "x/y/z cell: " << xvals[ix] / cm << "/" << yvals[iy] / cm << "/" << zvals[iz] / cm << std::endl;
     std::cout << "x/y/z fraction: " << fractionx << "/" << fractiony << "/" << fractionz << std::endl;
   }
 
-  // linear extrapolation in cube:
-
-  // Vxyz =
-  // V000 * x * y * z +
-  // V100 * (1 - x) * y * z +
-  // V010 * x * (1 - y) * z +
-  // V001 * x y * (1 - z) +
-  // V101 * (1 - x) * y * (1 - z) +
-  // V011 * x * (1 - y) * (1 - z) +
-  // V110 * (1 - x) * (1 - y) * z +
-  // V111 * (1 - x) * (1 - y) * (1 - z)
+  // linear interpolation in cube: corner (i,j,k) is weighted by the product of
+  // fraction (corner index 1) or 1 - fraction (corner index 0) along each axis
+  const std::size_t dy = zvals.size();
+  const std::size_t dx = yvals.size() * dy;
+  const std::size_t base = ix * dx + iy * dy + iz;
+  const std::size_t offset[8] = {0, 1, dy, dy + 1, dx, dx + 1, dx + dy, dx + dy + 1};
+  const double wx[2] = {1. - fractionx, fractionx};
+  const double wy[2] = {1. - fractiony, fractiony};
+  const double wz[2] = {1. - fractionz, fractionz};
+
+  double b[3] = {0, 0, 0};
+  for (int corner = 0; corner < 8; ++corner)
+  {
+    const std::size_t index = base + offset[corner];
+    const double weight = wx[corner >> 2] * wy[(corner >> 1) & 1] * wz[corner & 1];
+    b[0] += weight * fieldx[index];
+    b[1] += weight * fieldy[index];
+    b[2] += weight * fieldz[index];
+  }
 
-  for (int i = 0; i < 3; i++)
+  // missing grid points are stored as NaN
+  if (std::isnan(b[0]) || std::isnan(b[1]) || std::isnan(b[2]))
   {
-    Bfield[i] = bf_loc[0][0][0][i] * fractionx * fractiony * fractionz +
-                bf_loc[1][0][0][i] * (1. - fractionx) * fractiony * fractionz +
-                bf_loc[0][1][0][i] * fractionx * (1. - fractiony) * fractionz +
-                bf_loc[0][0][1][i] * fractionx * fractiony * (1. - fractionz) +
-                bf_loc[1][0][1][i] * (1. - fractionx) * fractiony * (1. - fractionz) +
-                bf_loc[0][1][1][i] * fractionx * (1. - fractiony) * (1. - fractionz) +
-                bf_loc[1][1][0][i] * (1. - fractionx) * (1. - fractiony) * fractionz +
-                bf_loc[1][1][1][i] * (1. - fractionx) * (1. - fractiony) * (1. - fractionz);
+    std::cout << PHWHERE << " could not locate cell in " << filename
+              << " value: x: " << xvals[ix] / cm
+              << ", y: " << yvals[iy] / cm
+              << ", z: " << zvals[iz] / cm << std::endl;
+    return;
   }
 
-  return;
+  Bfield[0] = b[0];
+  Bfield[1] = b[1];
+  Bfield[2] = b[2];
 }
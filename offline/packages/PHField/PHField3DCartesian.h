@@ -3,11 +3,10 @@
 
 #include "PHField.h"
 
+#include <cstddef>
 #include <limits>
-#include <map>
-#include <set>
 #include <string>
-#include <tuple>
+#include <vector>
 
 class PHField3DCartesian : public PHField
 {
@@ -17,7 +16,7 @@ class PHField3DCartesian : public PHField
   explicit PHField3DCartesian(const std::string &fname, const float magfield_rescale = 1.0, const float innerradius = 0, const float outerradius = 1.e10, const float size_z = 1.e10);
 
   //! destructor
-  ~PHField3DCartesian() override;
+  ~PHField3DCartesian() override = default;
 
   //! access field value
   //! Follow the convention of G4ElectroMagneticField
@@ -25,9 +24,21 @@ class PHField3DCartesian : public PHField
   //! @param[out] Bfield  field value. In the case of magnetic field, the order is Bx, By, Bz in in Geant4/CLHEP units
   void GetFieldValue(const double Point[4], double *Bfield) const override;
 
+  //! un-cached version of field accessor. Same as GetFieldValue, without the diagnostic for invalid coordinates
   void GetFieldValue_nocache(const double Point[4], double *Bfield) const override;
 
+  //! batch field accessor
+  //! @param[in]  n       number of points
+  //! @param[in]  Points  n space time coordinates, 4 consecutive values per point, as in GetFieldValue
+  //! @param[out] Bfield  n field values, 3 consecutive values per point
+  void GetFieldValues(const std::size_t n, const double *Points, double *Bfield) const override;
+
   private:
+
+  //! trilinear interpolation on the grid. Thread-safe
+  //! field is zero outside of the grid, or if one of the cell corners is missing from the fieldmap
+  void interpolate(const double Point[4], double *Bfield) const;
+
   std::string filename;
   double xmin {1000000};
   double xmax {-1000000};
@@ -39,20 +50,16 @@ class PHField3DCartesian : public PHField
   double ystepsize {std::numeric_limits<double>::quiet_NaN()};
   double zstepsize {std::numeric_limits<double>::quiet_NaN()};
 
-  // these are updated in a const method
-  // to cache previous values
-  mutable double bf[2][2][2][3]{};
-  mutable double xkey_save {std::numeric_limits<double>::quiet_NaN()};
-  mutable double ykey_save {std::numeric_limits<double>::quiet_NaN()};
-  mutable double zkey_save {std::numeric_limits<double>::quiet_NaN()};
-  mutable int cache_hits {0};
-  mutable int cache_misses {0};
-
-  typedef std::tuple<float, float, float> trio;
-  std::map<std::tuple<float, float, float>, std::tuple<float, float, float> > fieldmap;
-  std::set<float> xvals;
-  std::set<float> yvals;
-  std::set<float> zvals;
+  //! grid coordinates, sorted
+  std::vector<float> xvals;
+  std::vector<float> yvals;
+  std::vector<float> zvals;
+
+  //! field components on the grid, indexed by (ix*ny + iy)*nz + iz
+  //! NaN for grid points which are not in the fieldmap, so that any interpolation using them returns NaN
+  std::vector<float> fieldx;
+  std::vector<float> fieldy;
+  std::vector<float> fieldz;
 };
 
 #endif
@@ -26,19 +26,19 @@
 #include <phool/PHNode.h>
 #include <phool/PHNodeIterator.h>
 #include <phool/PHObject.h>  // for PHObject
+#include <phool/PHWorkerPool.h>
 #include <phool/getClass.h>
 #include <phool/phool.h>
 
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/connected_components.hpp>
-
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <memory>  // for unique_ptr, make_...
 #include <set>
+#include <type_traits>
 #include <vector>  // for vector
 
 namespace
@@ -50,53 +50,28 @@ namespace
   {
     return x * x;
   }
-}  // namespace
 
-bool InttClusterizer::ladder_are_adjacent(const std::pair<TrkrDefs::hitkey, TrkrHit*>& lhs, const std::pair<TrkrDefs::hitkey, TrkrHit*>& rhs, const int layer) const
-{
-  if (get_z_clustering(layer))
+  // strip (column, row) and adc of TrkrHitSet and RawHitSet hits
+  InttStripClusterFinder::strip get_strip(const std::pair<TrkrDefs::hitkey, TrkrHit*>& hit)
   {
-    if (std::abs(InttDefs::getCol(lhs.first) - InttDefs::getCol(rhs.first)) <= 1)
-    {
-      if (std::abs(InttDefs::getRow(lhs.first) - InttDefs::getRow(rhs.first)) <= 1)
-      {
-        return true;
-      }
-    }
+    return {InttDefs::getCol(hit.first), InttDefs::getRow(hit.first)};
   }
-  else if (std::abs(InttDefs::getCol(lhs.first) - InttDefs::getCol(rhs.first)) == 0)
+
+  InttStripClusterFinder::strip get_strip(RawHit* hit)
   {
-    if (std::abs(InttDefs::getRow(lhs.first) - InttDefs::getRow(rhs.first)) <= 1)
-    {
-      return true;
-    }
+    return {static_cast<int>(hit->getPhiBin()), static_cast<int>(hit->getTBin())};
   }
 
-  return false;
-}
-
-bool InttClusterizer::ladder_are_adjacent(RawHit* lhs, RawHit* rhs, const int layer) const
-{
-  if (get_z_clustering(layer))
+  unsigned int get_adc(const std::pair<TrkrDefs::hitkey, TrkrHit*>& hit)
   {
-    if (std::abs((int) (lhs->getPhiBin()) - (int) (rhs->getPhiBin())) <= 1)  // col
-    {
-      if (std::abs((int) (lhs->getTBin()) - (int) (rhs->getTBin())) <= 1)  // Row
-      {
-        return true;
-      }
-    }
+    return hit.second->getAdc();
   }
-  else if (std::abs((int) (lhs->getPhiBin()) - (int)(rhs->getPhiBin())) <= 1)
+
+  unsigned int get_adc(RawHit* hit)
   {
-    if (std::abs((int) (lhs->getTBin()) - (int) (rhs->getTBin())) == 0)
-    {
-      return true;
-    }
+    return hit->getAdc();
   }
-
-  return false;
-}
+}  // namespace
 
 InttClusterizer::InttClusterizer(const std::string& name,
                                  unsigned int /*min_layer*/,
@@ -105,6 +80,9 @@ InttClusterizer::InttClusterizer(const std::string& name,
 {
 }
 
+// out of line so that PHWorkerPool can stay an incomplete type in the header
+InttClusterizer::~InttClusterizer() = default;
+
 int InttClusterizer::InitRun(PHCompositeNode* topNode)
 {
   /*
@@ -190,6 +168,16 @@ int InttClusterizer::InitRun(PHCompositeNode* topNode)
 
   CalculateLadderThresholds(topNode);
 
+  // persistent worker pool, reused for all events. With a single thread the sensors are processed on the calling thread
+  if (m_nthreads > 1 && !m_workerpool)
+  {
+    m_workerpool = std::make_unique<PHWorkerPool>(m_nthreads);
+    if (Verbosity() > 0)
+    {
+      std::cout << "InttClusterizer::InitRun - using " << m_workerpool->size() << " worker threads" << std::endl;
+    }
+  }
+
   //----------------
   // Report Settings
   //----------------
@@ -336,253 +324,245 @@ void InttClusterizer::CalculateLadderThresholds(PHCompositeNode* topNode)
   return;
 }
 
-void InttClusterizer::ClusterLadderCells(PHCompositeNode* topNode)
+template <class Hit>
+void InttClusterizer::ClusterLadder(const LadderHits<Hit>& ladder, InttStripClusterFinder& finder, LadderClusters& output) const
 {
-  if (Verbosity() > 0)
-  {
-    std::cout << "Entering InttClusterizer::ClusterLadderCells " << std::endl;
-  }
+  constexpr bool is_raw = std::is_same_v<Hit, RawHit*>;
 
-  //----------
-  // Get Nodes
-  //----------
+  output.hitsetkey = ladder.hitsetkey;
+  output.clusters.clear();
+  output.hitassocs.clear();
+  output.phihits.clear();
+  output.zhits.clear();
 
-  // get the geometry node
-  PHG4CylinderGeomContainer* geom_container = findNode::getClass<PHG4CylinderGeomContainer>(topNode, "CYLINDERGEOM_INTT");
-  if (!geom_container)
-  {
-    return;
-  }
+  const auto& hitvec = ladder.hits;
+  CylinderGeomIntt* geom = ladder.geom;
 
-  //-----------
-  // Clustering
-  //-----------
+  // we have a single hitset, get the info that identifies the sensor
+  int layer = TrkrDefs::getLayer(ladder.hitsetkey);
+  int ladder_z_index = InttDefs::getLadderZId(ladder.hitsetkey);
+  int type = (ladder_z_index == 0 || ladder_z_index == 2) ? 0 : 1; // ladder ID 0 and 2 are type-A (1.6 cm), ladder ID 1 and 3 are type-B (2.0 cm)
 
-  // loop over the InttHitSet objects
-  TrkrHitSetContainer::ConstRange hitsetrange =
-      m_hits->getHitSets(TrkrDefs::TrkrId::inttId);
-  for (TrkrHitSetContainer::ConstIterator hitsetitr = hitsetrange.first;
-       hitsetitr != hitsetrange.second;
-       ++hitsetitr)
-  {
-    // Each hitset contains only hits that are clusterizable - i.e. belong to a single sensor
-    TrkrHitSet* hitset = hitsetitr->second;
+  float pitch = geom->get_strip_y_spacing();
+  float length = geom->get_strip_z_spacing(type);
+  const bool make_e_weights = get_energy_weighting(layer);
 
-    if (Verbosity() > 1)
+  // without z clustering hits are adjacent along the row for TrkrHits, along the column for RawHits
+  int max_dcol = 1;
+  int max_drow = 1;
+  if (!get_z_clustering(layer))
+  {
+    if constexpr (is_raw)
     {
-      std::cout << "InttClusterizer found hitsetkey " << hitsetitr->first << std::endl;
+      max_drow = 0;
     }
-    if (Verbosity() > 2)
+    else
     {
-      hitset->identify();
+      max_dcol = 0;
     }
+  }
 
-    // we have a single hitset, get the info that identifies the sensor
-    int layer = TrkrDefs::getLayer(hitsetitr->first);
-    int ladder_z_index = InttDefs::getLadderZId(hitsetitr->first);
-    int type = (ladder_z_index == 0 || ladder_z_index == 2) ? 0 : 1; // ladder ID 0 and 2 are type-A (1.6 cm), ladder ID 1 and 3 are type-B (2.0 cm)
+  const unsigned int nclusters = finder.find_clusters(hitvec, [](const Hit& hit)
+                                                      { return get_strip(hit); }, max_dcol, max_drow);
 
-    // we will need the geometry object for this layer to get the global position
-    CylinderGeomIntt* geom = dynamic_cast<CylinderGeomIntt*>(geom_container->GetLayerGeom(layer));
-    float pitch = geom->get_strip_y_spacing();
-    float length = geom->get_strip_z_spacing(type);
-
-    // fill a vector of hits to make things easier - gets every hit in the hitset
-    std::vector<std::pair<TrkrDefs::hitkey, TrkrHit*>> hitvec;
-    TrkrHitSet::ConstRange hitrangei = hitset->getHits();
-    for (TrkrHitSet::ConstIterator hitr = hitrangei.first;
-         hitr != hitrangei.second;
-         ++hitr)
-    {
-      hitvec.emplace_back(hitr->first, hitr->second);
-    }
+  // loop over the cluster ID's and make the clusters from the connected hits
+  for (unsigned int clusid = 0; clusid < nclusters; ++clusid)
+  {
     if (Verbosity() > 2)
     {
-      std::cout << "hitvec.size(): " << hitvec.size() << std::endl;
-    }
-
-    using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
-    Graph G;
-
-    // Find adjacent strips
-    for (unsigned int i = 0; i < hitvec.size(); i++)
-    {
-      for (unsigned int j = i + 1; j < hitvec.size(); j++)
-      {
-        if (ladder_are_adjacent(hitvec[i], hitvec[j], layer))
-        {
-          add_edge(i, j, G);
-        }
-      }
-
-      add_edge(i, i, G);
+      std::cout << "Filling cluster with key " << TrkrDefs::genClusKey(ladder.hitsetkey, clusid) << std::endl;
     }
 
-    // Find the connections between the vertices of the graph (vertices are the rawhits,
-    // connections are made when they are adjacent to one another)
-    std::vector<int> component(num_vertices(G));
+    // determine the size of the cluster in phi and z, useful for track fitting the cluster
+    std::set<int> phibins;
+    std::set<int> zbins;
 
-    // this is the actual clustering, performed by boost
-    connected_components(G, component.data());
+    // determine the cluster position...
+    double xlocalsum = 0.0;
+    double ylocalsum = 0.0;
+    double zlocalsum = 0.0;
+    unsigned int clus_adc = 0.0;
+    unsigned int clus_maxadc = 0.0;
+    unsigned nhits = 0;
 
-    // Loop over the components(hit cells) compiling a list of the
-    // unique connected groups (ie. clusters).
-    std::set<int> cluster_ids;  // unique components
+    std::map<int, unsigned int> m_phi;
+    std::map<int, unsigned int> m_z;  // hold data for
 
-    std::multimap<int, std::pair<TrkrDefs::hitkey, TrkrHit*>> clusters;
-    for (unsigned int i = 0; i < component.size(); i++)
+    // get all hits for this cluster ID only
+    const auto clusrange = finder.cluster(clusid);
+    for (auto ihit = clusrange.first; ihit != clusrange.second; ++ihit)
     {
-      cluster_ids.insert(component[i]);                          // one entry per unique cluster id
-      clusters.insert(std::make_pair(component[i], hitvec[i]));  // multiple entries per unique cluster id
-    }
-
-    // loop over the cluster ID's and make the clusters from the connected hits
-    for (int clusid : cluster_ids)
-    {
-      // std::cout << " intt clustering: add cluster number " << clusid << std::endl;
-
-      // make the cluster directly in the node tree
-      TrkrDefs::cluskey ckey = TrkrDefs::genClusKey(hitset->getHitSetKey(), clusid);
-
-      if (Verbosity() > 2)
-      {
-        std::cout << "Filling cluster with key " << ckey << std::endl;
-      }
-
-      // get the bunch crossing number from the hitsetkey
-      short int crossing = InttDefs::getTimeBucketId(hitset->getHitSetKey());
+      const auto& hit = hitvec[*ihit];
+      const auto [col, row] = get_strip(hit);
+      zbins.insert(col);
+      phibins.insert(row);
 
-      // Add clusterkey/bunch crossing to mmap
-      m_clustercrossingassoc->addAssoc(ckey, crossing);
+      unsigned int hit_adc = get_adc(hit);
 
-      // determine the size of the cluster in phi and z, useful for track fitting the cluster
-      std::set<int> phibins;
-      std::set<int> zbins;
-
-      // determine the cluster position...
-      double xlocalsum = 0.0;
-      double ylocalsum = 0.0;
-      double zlocalsum = 0.0;
-      unsigned int clus_adc = 0.0;
-      unsigned int clus_maxadc = 0.0;
-      unsigned nhits = 0;
-      // std::cout << PHWHERE << " ckey " << ckey << ":" << std::endl;
-
-      // get all hits for this cluster ID only
-      const auto clusrange = clusters.equal_range(clusid);
-      for (auto mapiter = clusrange.first; mapiter != clusrange.second; ++mapiter)
+      if (mClusHitsVerbose)
       {
-        // mapiter->second.first  is the hit key
-        // std::cout << " adding hitkey " << mapiter->second.first << std::endl;
-        int col = InttDefs::getCol((mapiter->second).first);
-        int row = InttDefs::getRow((mapiter->second).first);
-        zbins.insert(col);
-        phibins.insert(row);
-
-        // mapiter->second.second is the hit
-        unsigned int hit_adc = (mapiter->second).second->getAdc();
-
-        // now get the positions from the geometry
-        double local_hit_location[3] = {0., 0., 0.};
-
-	// NOLINTNEXTLINE(readability-suspicious-call-argument)
-        geom->find_strip_center_localcoords(ladder_z_index,
-                                            row, col,
-                                            local_hit_location);
-
-        if (_make_e_weights[layer])
+        auto pnew = m_phi.try_emplace(row, hit_adc);
+        if (!pnew.second)
         {
-          xlocalsum += local_hit_location[0] * (double) hit_adc;
-          ylocalsum += local_hit_location[1] * (double) hit_adc;
-          zlocalsum += local_hit_location[2] * (double) hit_adc;
+          pnew.first->second += hit_adc;
         }
-        else
-        {
-          xlocalsum += local_hit_location[0];
-          ylocalsum += local_hit_location[1];
-          zlocalsum += local_hit_location[2];
-        }
-        clus_maxadc = std::max(hit_adc, clus_maxadc);
-        clus_adc += hit_adc;
-        ++nhits;
-
-        // add this cluster-hit association to the association map of (clusterkey,hitkey)
-        m_clusterhitassoc->addAssoc(ckey, mapiter->second.first);
 
-        if (Verbosity() > 2)
+        pnew = m_z.try_emplace(col, hit_adc);
+        if (!pnew.second)
         {
-          std::cout << "     nhits = " << nhits << std::endl;
-        }
-        if (Verbosity() > 2)
-        {
-          std::cout << "  From  geometry object: hit x " << local_hit_location[0] << " hit y " << local_hit_location[1] << " hit z " << local_hit_location[2] << std::endl;
-          std::cout << "     nhits " << nhits << " clusx  = " << xlocalsum / nhits << " clusy " << ylocalsum / nhits << " clusz " << zlocalsum / nhits << " hit_adc " << hit_adc << std::endl;
+          pnew.first->second += hit_adc;
         }
       }
 
-      static const float invsqrt12 = 1. / sqrt(12);
-
-      // scale factors (phi direction)
-      /*
-        they corresponds to clusters of size 1 and 2 in phi
-        other clusters, which are very few and pathological, get a scale factor of 1
-        These scale factors are applied to produce cluster pulls with width unity
-      */
+      // now get the positions from the geometry
+      double local_hit_location[3] = {0., 0., 0.};
 
-      float phierror = pitch * invsqrt12;
+      // NOLINTNEXTLINE(readability-suspicious-call-argument)
+      geom->find_strip_center_localcoords(ladder_z_index,
+                                          row, col,
+                                          local_hit_location);
 
-      static constexpr std::array<double, 3> scalefactors_phi = {{0.85, 0.4, 0.33}};
-      if (phibins.size() == 1 && layer < 5)
+      if (make_e_weights)
       {
-        phierror *= scalefactors_phi[0];
+        xlocalsum += local_hit_location[0] * (double) hit_adc;
+        ylocalsum += local_hit_location[1] * (double) hit_adc;
+        zlocalsum += local_hit_location[2] * (double) hit_adc;
       }
-      else if (phibins.size() == 2 && layer < 5)
+      else
       {
-        phierror *= scalefactors_phi[1];
+        xlocalsum += local_hit_location[0];
+        ylocalsum += local_hit_location[1];
+        zlocalsum += local_hit_location[2];
       }
-      else if (phibins.size() == 2 && layer > 4)
+      clus_maxadc = std::max(hit_adc, clus_maxadc);
+      clus_adc += hit_adc;
+      ++nhits;
+
+      // raw hits have no hit key, hence no cluster-hit association
+      if constexpr (!is_raw)
       {
-        phierror *= scalefactors_phi[2];
+        output.hitassocs.emplace_back(clusid, hit.first);
       }
-      // z error.
-      const float zerror = zbins.size() * length * invsqrt12;
 
-      double cluslocaly = std::numeric_limits<double>::quiet_NaN();
-      double cluslocalz = std::numeric_limits<double>::quiet_NaN();
-
-      if (_make_e_weights[layer])
+      if (Verbosity() > 2)
       {
-        cluslocaly = ylocalsum / (double) clus_adc;
-        cluslocalz = zlocalsum / (double) clus_adc;
+        std::cout << "     nhits = " << nhits << std::endl;
+        std::cout << "  From  geometry object: hit x " << local_hit_location[0] << " hit y " << local_hit_location[1] << " hit z " << local_hit_location[2] << std::endl;
+        std::cout << "     nhits " << nhits << " clusx  = " << xlocalsum / nhits << " clusy " << ylocalsum / nhits << " clusz " << zlocalsum / nhits << " hit_adc " << hit_adc << std::endl;
       }
-      else
+    }
+
+    if (mClusHitsVerbose)
+    {
+      if (Verbosity() > 10)
       {
-        cluslocaly = ylocalsum / nhits;
-        cluslocalz = zlocalsum / nhits;
+        for (auto const& hit : m_phi)
+        {
+          std::cout << " m_phi(" << hit.first << " : " << hit.second << ") " << std::endl;
+        }
       }
+      output.phihits.emplace_back(m_phi.begin(), m_phi.end());
+      output.zhits.emplace_back(m_z.begin(), m_z.end());
+    }
+
+    static const float invsqrt12 = 1. / sqrt(12);
+
+    // scale factors (phi direction)
+    /*
+      they corresponds to clusters of size 1 and 2 in phi
+      other clusters, which are very few and pathological, get a scale factor of 1
+      These scale factors are applied to produce cluster pulls with width unity
+    */
+
+    float phierror = pitch * invsqrt12;
+
+    static constexpr std::array<double, 3> scalefactors_phi = {{0.85, 0.4, 0.33}};
+    if (phibins.size() == 1 && layer < 5)
+    {
+      phierror *= scalefactors_phi[0];
+    }
+    else if (phibins.size() == 2 && layer < 5)
+    {
+      phierror *= scalefactors_phi[1];
+    }
+    else if (phibins.size() == 2 && layer > 4)
+    {
+      phierror *= scalefactors_phi[2];
+    }
+    // z error.
+    const float zerror = zbins.size() * length * invsqrt12;
+
+    double cluslocaly = std::numeric_limits<double>::quiet_NaN();
+    double cluslocalz = std::numeric_limits<double>::quiet_NaN();
+
+    if (make_e_weights)
+    {
+      cluslocaly = ylocalsum / (double) clus_adc;
+      cluslocalz = zlocalsum / (double) clus_adc;
+    }
+    else
+    {
+      cluslocaly = ylocalsum / nhits;
+      cluslocalz = zlocalsum / nhits;
+    }
 
-      auto clus = std::make_unique<TrkrClusterv5>();
-      clus->setAdc(clus_adc);
+    auto clus = std::make_unique<TrkrClusterv5>();
+    clus->setAdc(clus_adc);
+    // the max adc has never been filled for raw hits
+    if constexpr (!is_raw)
+    {
       clus->setMaxAdc(clus_maxadc);
-      clus->setLocalX(cluslocaly);
-      clus->setLocalY(cluslocalz);
-      clus->setPhiError(phierror);
-      clus->setZError(zerror);
-      clus->setPhiSize(phibins.size());
-      clus->setZSize(zbins.size());
-      // All silicon surfaces have a 1-1 map to hitsetkey.
-      // So set subsurface key to 0
-      clus->setSubSurfKey(0);
+    }
+    clus->setLocalX(cluslocaly);
+    clus->setLocalY(cluslocalz);
+    clus->setPhiError(phierror);
+    clus->setZError(zerror);
+    clus->setPhiSize(phibins.size());
+    clus->setZSize(zbins.size());
+    // All silicon surfaces have a 1-1 map to hitsetkey.
+    // So set subsurface key to 0
+    clus->setSubSurfKey(0);
 
-      if (Verbosity() > 2)
-      {
-        clus->identify();
-      }
+    if (Verbosity() > 2)
+    {
+      clus->identify();
+    }
+
+    output.clusters.push_back(std::move(clus));
+  }  // end loop over cluster ID's
+}
 
-      m_clusterlist->addClusterSpecifyKey(ckey, clus.release());
+template <class Hit>
+void InttClusterizer::ClusterLadders(const std::vector<LadderHits<Hit>>& ladders)
+{
+  if (m_ladder_clusters.size() < ladders.size())
+  {
+    m_ladder_clusters.resize(ladders.size());
+  }
+  if (m_finders.size() < m_nthreads)
+  {
+    m_finders.resize(m_nthreads);
+  }
+
+  if (m_workerpool && ladders.size() > 1)
+  {
+    // ladders are independent, each worker has its own cluster finder and each ladder its own output buffers
+    m_workerpool->run(ladders.size(), [&](unsigned int worker, std::size_t iladder)
+                      { ClusterLadder(ladders[iladder], m_finders[worker], m_ladder_clusters[iladder]); });
+  }
+  else
+  {
+    for (std::size_t iladder = 0; iladder < ladders.size(); ++iladder)
+    {
+      ClusterLadder(ladders[iladder], m_finders[0], m_ladder_clusters[iladder]);
+    }
+  }
 
-    }  // end loop over cluster ID's
-  }    // end loop over hitsets
+  // store in the node tree in hitset order
+  for (std::size_t iladder = 0; iladder < ladders.size(); ++iladder)
+  {
+    StoreLadderClusters(m_ladder_clusters[iladder]);
+  }
 
   if (Verbosity() > 2)
   {
@@ -596,10 +576,46 @@ void InttClusterizer::ClusterLadderCells(PHCompositeNode* topNode)
     std::cout << " Cluster-crossing associations are:" << std::endl;
     m_clustercrossingassoc->identify();
   }
+}
 
-  return;
+void InttClusterizer::StoreLadderClusters(LadderClusters& ladder)
+{
+  // get the bunch crossing number from the hitsetkey
+  short int crossing = InttDefs::getTimeBucketId(ladder.hitsetkey);
+
+  auto hitassoc = ladder.hitassocs.cbegin();
+  for (unsigned int clusid = 0; clusid < ladder.clusters.size(); ++clusid)
+  {
+    TrkrDefs::cluskey ckey = TrkrDefs::genClusKey(ladder.hitsetkey, clusid);
+
+    // Add clusterkey/bunch crossing to mmap
+    m_clustercrossingassoc->addAssoc(ckey, crossing);
+
+    // add the cluster-hit associations to the association map of (clusterkey,hitkey)
+    for (; hitassoc != ladder.hitassocs.cend() && hitassoc->first == clusid; ++hitassoc)
+    {
+      m_clusterhitassoc->addAssoc(ckey, hitassoc->second);
+    }
+
+    if (mClusHitsVerbose)
+    {
+      for (const auto& hit : ladder.phihits[clusid])
+      {
+        mClusHitsVerbose->addPhiHit(hit.first, (float) hit.second);
+      }
+      for (const auto& hit : ladder.zhits[clusid])
+      {
+        mClusHitsVerbose->addZHit(hit.first, (float) hit.second);
+      }
+      mClusHitsVerbose->push_hits(ckey);
+    }
+
+    m_clusterlist->addClusterSpecifyKey(ckey, ladder.clusters[clusid].release());
+  }
+  ladder.clusters.clear();
 }
-void InttClusterizer::ClusterLadderCellsRaw(PHCompositeNode* topNode)
+
+void InttClusterizer::ClusterLadderCells(PHCompositeNode* topNode)
 {
   if (Verbosity() > 0)
   {
@@ -622,14 +638,15 @@ void InttClusterizer::ClusterLadderCellsRaw(PHCompositeNode* topNode)
   //-----------
 
   // loop over the InttHitSet objects
-  RawHitSetContainer::ConstRange hitsetrange =
-      m_rawhits->getHitSets(TrkrDefs::TrkrId::inttId);
-  for (RawHitSetContainer::ConstIterator hitsetitr = hitsetrange.first;
+  std::vector<LadderHits<hit_pair>> ladders;
+  TrkrHitSetContainer::ConstRange hitsetrange =
+      m_hits->getHitSets(TrkrDefs::TrkrId::inttId);
+  for (TrkrHitSetContainer::ConstIterator hitsetitr = hitsetrange.first;
        hitsetitr != hitsetrange.second;
        ++hitsetitr)
   {
     // Each hitset contains only hits that are clusterizable - i.e. belong to a single sensor
-    RawHitSet* hitset = hitsetitr->second;
+    TrkrHitSet* hitset = hitsetitr->second;
 
     if (Verbosity() > 1)
     {
@@ -640,270 +657,92 @@ void InttClusterizer::ClusterLadderCellsRaw(PHCompositeNode* topNode)
       hitset->identify();
     }
 
-    // we have a single hitset, get the info that identifies the sensor
-    int layer = TrkrDefs::getLayer(hitsetitr->first);
-    int ladder_z_index = InttDefs::getLadderZId(hitsetitr->first);
-    int type = (ladder_z_index == 0 || ladder_z_index == 2) ? 0 : 1; // ladder ID 0 and 2 are type-A (1.6 cm), ladder ID 1 and 3 are type-B (2.0 cm)
-
     // we will need the geometry object for this layer to get the global position
-    CylinderGeomIntt* geom = dynamic_cast<CylinderGeomIntt*>(geom_container->GetLayerGeom(layer));
-    float pitch = geom->get_strip_y_spacing();
-    float length = geom->get_strip_z_spacing(type);
+    int layer = TrkrDefs::getLayer(hitsetitr->first);
+    auto& ladder = ladders.emplace_back();
+    ladder.hitsetkey = hitset->getHitSetKey();
+    ladder.geom = dynamic_cast<CylinderGeomIntt*>(geom_container->GetLayerGeom(layer));
 
     // fill a vector of hits to make things easier - gets every hit in the hitset
-    std::vector<RawHit*> hitvec;
-    // int sector = InttDefs::getLadderPhiId(hitsetitr->first);
-    // int side = InttDefs::getLadderZId(hitsetitr->first);
-
-    RawHitSet::ConstRange hitrangei = hitset->getHits();
-    for (RawHitSet::ConstIterator hitr = hitrangei.first;
+    TrkrHitSet::ConstRange hitrangei = hitset->getHits();
+    for (TrkrHitSet::ConstIterator hitr = hitrangei.first;
          hitr != hitrangei.second;
          ++hitr)
     {
-      // unsigned short iphi = (*hitr)->getPhiBin();
-      // unsigned short it = (*hitr)->getTBin();
-      //	std::cout << " intt layer " << layer << " sector: " << sector << " side " << side << " col: " << iphi << " row " << it << std::endl;
-      hitvec.push_back((*hitr));
+      ladder.hits.emplace_back(hitr->first, hitr->second);
     }
     if (Verbosity() > 2)
     {
-      std::cout << "hitvec.size(): " << hitvec.size() << std::endl;
+      std::cout << "hitvec.size(): " << ladder.hits.size() << std::endl;
     }
+  }
 
-    using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
-    Graph G;
+  ClusterLadders(ladders);
+}
 
-    // Find adjacent strips
-    for (unsigned int i = 0; i < hitvec.size(); i++)
-    {
-      for (unsigned int j = i + 1; j < hitvec.size(); j++)
-      {
-        if (ladder_are_adjacent(hitvec[i], hitvec[j], layer))
-        {
-          add_edge(i, j, G);
-        }
-      }
+void InttClusterizer::ClusterLadderCellsRaw(PHCompositeNode* topNode)
+{
+  if (Verbosity() > 0)
+  {
+    std::cout << "Entering InttClusterizer::ClusterLadderCells " << std::endl;
+  }
 
-      add_edge(i, i, G);
-    }
+  //----------
+  // Get Nodes
+  //----------
 
-    // Find the connections between the vertices of the graph (vertices are the rawhits,
-    // connections are made when they are adjacent to one another)
-    std::vector<int> component(num_vertices(G));
+  // get the geometry node
+  PHG4CylinderGeomContainer* geom_container = findNode::getClass<PHG4CylinderGeomContainer>(topNode, "CYLINDERGEOM_INTT");
+  if (!geom_container)
+  {
+    return;
+  }
 
-    // this is the actual clustering, performed by boost
-    connected_components(G, component.data());
+  //-----------
+  // Clustering
+  //-----------
 
-    // Loop over the components(hit cells) compiling a list of the
-    // unique connected groups (ie. clusters).
-    std::set<int> cluster_ids;  // unique components
+  // loop over the InttHitSet objects
+  std::vector<LadderHits<RawHit*>> ladders;
+  RawHitSetContainer::ConstRange hitsetrange =
+      m_rawhits->getHitSets(TrkrDefs::TrkrId::inttId);
+  for (RawHitSetContainer::ConstIterator hitsetitr = hitsetrange.first;
+       hitsetitr != hitsetrange.second;
+       ++hitsetitr)
+  {
+    // Each hitset contains only hits that are clusterizable - i.e. belong to a single sensor
+    RawHitSet* hitset = hitsetitr->second;
 
-    std::multimap<int, RawHit*> clusters;
-    for (unsigned int i = 0; i < component.size(); i++)
+    if (Verbosity() > 1)
     {
-      cluster_ids.insert(component[i]);                          // one entry per unique cluster id
-      clusters.insert(std::make_pair(component[i], hitvec[i]));  // multiple entries per unique cluster id
+      std::cout << "InttClusterizer found hitsetkey " << hitsetitr->first << std::endl;
     }
-
-    // loop over the cluster ID's and make the clusters from the connected hits
-    for (int clusid : cluster_ids)
+    if (Verbosity() > 2)
     {
-      // std::cout << " intt clustering: add cluster number " << clusid << std::endl;
-      // make the cluster directly in the node tree
-      TrkrDefs::cluskey ckey = TrkrDefs::genClusKey(hitset->getHitSetKey(), clusid);
-
-      if (Verbosity() > 2)
-      {
-        std::cout << "Filling cluster with key " << ckey << std::endl;
-      }
-
-      // get the bunch crossing number from the hitsetkey
-      short int crossing = InttDefs::getTimeBucketId(hitset->getHitSetKey());
-
-      // Add clusterkey/bunch crossing to mmap
-      m_clustercrossingassoc->addAssoc(ckey, crossing);
-
-      // determine the size of the cluster in phi and z, useful for track fitting the cluster
-      std::set<int> phibins;
-      std::set<int> zbins;
-
-      // determine the cluster position...
-      double xlocalsum = 0.0;
-      double ylocalsum = 0.0;
-      double zlocalsum = 0.0;
-      unsigned int clus_adc = 0.0;
-      unsigned nhits = 0;
-
-      // std::cout << PHWHERE << " ckey " << ckey << ":" << std::endl;
-      std::map<int, unsigned int> m_phi;
-      std::map<int, unsigned int> m_z;  // hold data for
-
-      // get all hits for this cluster ID only
-      const auto clusrange = clusters.equal_range(clusid);
-      for (auto mapiter = clusrange.first; mapiter != clusrange.second; ++mapiter)
-      {
-        // mapiter->second.first  is the hit key
-        // std::cout << " adding hitkey " << mapiter->second.first << std::endl;
-        const auto energy = (mapiter->second)->getAdc();
-        int col = (mapiter->second)->getPhiBin();
-        int row = (mapiter->second)->getTBin();
-        //	    std::cout << " found Tbin(row) " << row << " Phibin(col) " << col << std::endl;
-        zbins.insert(col);
-        phibins.insert(row);
-
-        if (mClusHitsVerbose)
-        {
-          auto pnew = m_phi.try_emplace(row, energy);
-          if (!pnew.second)
-          {
-            pnew.first->second += energy;
-          }
-
-          pnew = m_z.try_emplace(col, energy);
-          if (!pnew.second)
-          {
-            pnew.first->second += energy;
-          }
-        }
-
-        // mapiter->second.second is the hit
-        unsigned int hit_adc = (mapiter->second)->getAdc();
-
-        // now get the positions from the geometry
-        double local_hit_location[3] = {0., 0., 0.};
-
-	// NOLINTNEXTLINE(readability-suspicious-call-argument)
-        geom->find_strip_center_localcoords(ladder_z_index,
-                                            row, col,
-                                            local_hit_location);
-
-        if (_make_e_weights[layer])
-        {
-          xlocalsum += local_hit_location[0] * (double) hit_adc;
-          ylocalsum += local_hit_location[1] * (double) hit_adc;
-          zlocalsum += local_hit_location[2] * (double) hit_adc;
-        }
-        else
-        {
-          xlocalsum += local_hit_location[0];
-          ylocalsum += local_hit_location[1];
-          zlocalsum += local_hit_location[2];
-        }
-
-        clus_adc += hit_adc;
-        ++nhits;
-
-        // add this cluster-hit association to the association map of (clusterkey,hitkey)
-        //	    m_clusterhitassoc->addAssoc(ckey, mapiter->second.first);
-
-        if (Verbosity() > 2)
-        {
-          std::cout << "     nhits = " << nhits << std::endl;
-        }
-        if (Verbosity() > 2)
-        {
-          std::cout << "  From  geometry object: hit x " << local_hit_location[0] << " hit y " << local_hit_location[1] << " hit z " << local_hit_location[2] << std::endl;
-          std::cout << "     nhits " << nhits << " clusx  = " << xlocalsum / nhits << " clusy " << ylocalsum / nhits << " clusz " << zlocalsum / nhits << " hit_adc " << hit_adc << std::endl;
-        }
-      }
-
-      if (mClusHitsVerbose)
-      {
-        if (Verbosity() > 10)
-        {
-          for (auto const& hit : m_phi)
-          {
-            std::cout << " m_phi(" << hit.first << " : " << hit.second << ") " << std::endl;
-          }
-        }
-        for (auto& hit : m_phi)
-        {
-          mClusHitsVerbose->addPhiHit(hit.first, (float) hit.second);
-        }
-        for (auto& hit : m_z)
-        {
-          mClusHitsVerbose->addZHit(hit.first, (float) hit.second);
-        }
-        mClusHitsVerbose->push_hits(ckey);
-      }
-
-      static const float invsqrt12 = 1. / sqrt(12);
-
-      // scale factors (phi direction)
-      /*
-        they corresponds to clusters of size 1 and 2 in phi
-        other clusters, which are very few and pathological, get a scale factor of 1
-        These scale factors are applied to produce cluster pulls with width unity
-      */
-
-      float phierror = pitch * invsqrt12;
-
-      static constexpr std::array<double, 3> scalefactors_phi = {{0.85, 0.4, 0.33}};
-      if (phibins.size() == 1 && layer < 5)
-      {
-        phierror *= scalefactors_phi[0];
-      }
-      else if (phibins.size() == 2 && layer < 5)
-      {
-        phierror *= scalefactors_phi[1];
-      }
-      else if (phibins.size() == 2 && layer > 4)
-      {
-        phierror *= scalefactors_phi[2];
-      }
-      // z error.
-      const float zerror = zbins.size() * length * invsqrt12;
-
-      double cluslocaly = std::numeric_limits<double>::quiet_NaN();
-      double cluslocalz = std::numeric_limits<double>::quiet_NaN();
-
-      if (_make_e_weights[layer])
-      {
-        cluslocaly = ylocalsum / (double) clus_adc;
-        cluslocalz = zlocalsum / (double) clus_adc;
-      }
-      else
-      {
-        cluslocaly = ylocalsum / nhits;
-        cluslocalz = zlocalsum / nhits;
-      }
-
-      auto clus = std::make_unique<TrkrClusterv5>();
-      clus->setAdc(clus_adc);
-      clus->setLocalX(cluslocaly);
-      clus->setLocalY(cluslocalz);
-      clus->setPhiError(phierror);
-      clus->setZError(zerror);
-      clus->setPhiSize(phibins.size());
-      clus->setZSize(zbins.size());
-      // All silicon surfaces have a 1-1 map to hitsetkey.
-      // So set subsurface key to 0
-      clus->setSubSurfKey(0);
-
-      if (Verbosity() > 2)
-      {
-        clus->identify();
-      }
-
-      m_clusterlist->addClusterSpecifyKey(ckey, clus.release());
-
-    }  // end loop over cluster ID's
-  }    // end loop over hitsets
+      hitset->identify();
+    }
 
-  if (Verbosity() > 2)
-  {
-    // check that the associations were written correctly
-    std::cout << "After InttClusterizer, cluster-hit associations are:" << std::endl;
-    m_clusterhitassoc->identify();
-  }
+    // we will need the geometry object for this layer to get the global position
+    int layer = TrkrDefs::getLayer(hitsetitr->first);
+    auto& ladder = ladders.emplace_back();
+    ladder.hitsetkey = hitset->getHitSetKey();
+    ladder.geom = dynamic_cast<CylinderGeomIntt*>(geom_container->GetLayerGeom(layer));
 
-  if (Verbosity() > 0)
-  {
-    std::cout << " Cluster-crossing associations are:" << std::endl;
-    m_clustercrossingassoc->identify();
+    // fill a vector of hits to make things easier - gets every hit in the hitset
+    RawHitSet::ConstRange hitrangei = hitset->getHits();
+    for (RawHitSet::ConstIterator hitr = hitrangei.first;
+         hitr != hitrangei.second;
+         ++hitr)
+    {
+      ladder.hits.push_back((*hitr));
+    }
+    if (Verbosity() > 2)
+    {
+      std::cout << "hitvec.size(): " << ladder.hits.size() << std::endl;
+    }
   }
 
-  return;
+  ClusterLadders(ladders);
 }
 
 void InttClusterizer::PrintClusters(PHCompositeNode* topNode)
@@ -1,17 +1,25 @@
 #ifndef INTT_INTTCLUSTERIZER_H
 #define INTT_INTTCLUSTERIZER_H
 
+#include "InttStripClusterFinder.h"
+
 #include <fun4all/SubsysReco.h>
 
+#include <trackbase/TrkrClusterv5.h>
 #include <trackbase/TrkrDefs.h>
 
+#include <algorithm>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 class ClusHitsVerbosev1;
+class CylinderGeomIntt;
 class PHCompositeNode;
+class PHWorkerPool;
 class TrkrHitSetContainer;
 class TrkrClusterContainer;
 class TrkrClusterHitAssoc;
@@ -25,7 +33,7 @@ class InttClusterizer : public SubsysReco
  public:
   InttClusterizer(const std::string &name = "InttClusterizer",
                   unsigned int min_layer = 0, unsigned int max_layer =  std::numeric_limits<unsigned int>::max());
-  ~InttClusterizer() override {}
+  ~InttClusterizer() override;
 
   //! run initialization
   int InitRun(PHCompositeNode *topNode) override;
@@ -69,6 +77,9 @@ class InttClusterizer : public SubsysReco
     return _make_e_weights.find(layer)->second;
   }
 
+  //! number of threads clustering the sensors of an event (1: no additional thread). Must be set before InitRun
+  void set_num_threads(const unsigned int nthreads) { m_nthreads = std::max(nthreads, 1U); }
+
   void set_do_hit_association(bool do_assoc) { do_hit_assoc = do_assoc; }
   void set_read_raw(bool read_raw) { do_read_raw = read_raw; }
 
@@ -78,12 +89,44 @@ class InttClusterizer : public SubsysReco
 
  private:
   bool record_ClusHitsVerbose{false};
-  bool ladder_are_adjacent(const std::pair<TrkrDefs::hitkey, TrkrHit *> &lhs, const std::pair<TrkrDefs::hitkey, TrkrHit *> &rhs, const int layer) const;
-  bool ladder_are_adjacent(RawHit *lhs, RawHit *rhs, const int layer) const;
+
+  using hit_pair = std::pair<TrkrDefs::hitkey, TrkrHit *>;
+
+  //! hits of a single sensor
+  template <class Hit>
+  struct LadderHits
+  {
+    TrkrDefs::hitsetkey hitsetkey{0};
+    CylinderGeomIntt *geom{nullptr};
+    std::vector<Hit> hits;
+  };
+
+  //! clusters of a single sensor, indexed by cluster id. They are filled independently
+  //! for each sensor and moved to the node tree in hitset order
+  struct LadderClusters
+  {
+    TrkrDefs::hitsetkey hitsetkey{0};
+    std::vector<std::unique_ptr<TrkrClusterv5>> clusters;
+    //! cluster id, hit key. Sorted by cluster id
+    std::vector<std::pair<unsigned int, TrkrDefs::hitkey>> hitassocs;
+    //! per cluster phi and z bins with their summed adc, only filled for ClusHitsVerbose
+    std::vector<std::vector<std::pair<int, unsigned int>>> phihits;
+    std::vector<std::vector<std::pair<int, unsigned int>>> zhits;
+  };
 
   void CalculateLadderThresholds(PHCompositeNode *topNode);
   void ClusterLadderCells(PHCompositeNode *topNode);
   void ClusterLadderCellsRaw(PHCompositeNode *topNode);
+
+  //! cluster all sensors, serially or on the worker pool, and store the clusters
+  template <class Hit>
+  void ClusterLadders(const std::vector<LadderHits<Hit>> &ladders);
+
+  //! cluster a single sensor, does not modify the clusterizer nor the node tree
+  template <class Hit>
+  void ClusterLadder(const LadderHits<Hit> &ladder, InttStripClusterFinder &finder, LadderClusters &output) const;
+
+  void StoreLadderClusters(LadderClusters &ladder);
   void PrintClusters(PHCompositeNode *topNode);
 
   // node tree storage pointers
@@ -100,6 +143,13 @@ class InttClusterizer : public SubsysReco
   std::map<int, bool> _make_e_weights;        // layer->energy_weighting_option
   bool do_hit_assoc = true;
   bool do_read_raw = false;
+
+  unsigned int m_nthreads = 1;
+  //! persistent worker pool, created at InitRun when more than one thread is requested
+  std::unique_ptr<PHWorkerPool> m_workerpool;
+  //! one cluster finder per worker
+  std::vector<InttStripClusterFinder> m_finders;
+  std::vector<LadderClusters> m_ladder_clusters;
 };
 
 #endif
@@ -0,0 +1,67 @@
+#include "InttStripClusterFinder.h"
+
+#include <algorithm>
+#include <numeric>
+
+unsigned int InttStripClusterFinder::find_clusters(int max_dcol, int max_drow)
+{
+  const auto nhits = static_cast<unsigned int>(m_strips.size());
+
+  m_unionfind.reset(nhits);
+
+  m_sorted.resize(nhits);
+  std::iota(m_sorted.begin(), m_sorted.end(), 0);
+  std::sort(m_sorted.begin(), m_sorted.end(), [this](unsigned int lhs, unsigned int rhs)
+            { return m_strips[lhs] < m_strips[rhs]; });
+
+  // sweep. [prev_begin, prev_end) is the range of the previous column in m_sorted,
+  // prev_first is the first strip of that column not yet too far below the current row
+  std::size_t column_begin = 0;
+  std::size_t prev_begin = 0;
+  std::size_t prev_end = 0;
+  std::size_t prev_first = 0;
+  for (std::size_t k = 0; k < nhits; ++k)
+  {
+    const unsigned int ihit = m_sorted[k];
+    const auto &[col, row] = m_strips[ihit];
+
+    if (k > 0 && m_strips[m_sorted[k - 1]].first != col)
+    {
+      // new column
+      if (max_dcol > 0 && m_strips[m_sorted[k - 1]].first + 1 == col)
+      {
+        prev_begin = column_begin;
+        prev_end = k;
+      }
+      else
+      {
+        prev_begin = prev_end = k;
+      }
+      prev_first = prev_begin;
+      column_begin = k;
+    }
+
+    // same column, rows are sorted so only the last strips can be adjacent
+    for (std::size_t j = k; j > column_begin; --j)
+    {
+      const unsigned int jhit = m_sorted[j - 1];
+      if (m_strips[jhit].second + max_drow < row)
+      {
+        break;
+      }
+      m_unionfind.unite(ihit, jhit);
+    }
+
+    // previous column
+    while (prev_first < prev_end && m_strips[m_sorted[prev_first]].second + max_drow < row)
+    {
+      ++prev_first;
+    }
+    for (std::size_t j = prev_first; j < prev_end && m_strips[m_sorted[j]].second <= row + max_drow; ++j)
+    {
+      m_unionfind.unite(ihit, m_sorted[j]);
+    }
+  }
+
+  return m_unionfind.make_clusters();
+}
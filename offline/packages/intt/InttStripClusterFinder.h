@@ -0,0 +1,65 @@
+#ifndef INTT_INTTSTRIPCLUSTERFINDER_H
+#define INTT_INTTSTRIPCLUSTERFINDER_H
+
+#include <trackbase/TrkrHitUnionFind.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * Groups the strips of an INTT sensor into clusters of adjacent strips.
+ *
+ * Strips are sorted by (column, row) and swept once: each strip is merged,
+ * through a TrkrHitUnionFind, with the earlier strips of its own column within
+ * max_drow rows and, if max_dcol is 1, with the strips of the previous column
+ * within max_drow rows. The cost is O(n log n) per sensor.
+ *
+ * Clusters are numbered in order of their first hit and list their hits in
+ * input order, which is the numbering of boost::connected_components on the
+ * hit adjacency graph. Buffers are kept from one sensor to the next; one
+ * finder must be used per thread.
+ */
+class InttStripClusterFinder
+{
+ public:
+  //! column, row
+  using strip = std::pair<int, int>;
+
+  /**
+   * find clusters in a vector of hits of any type. get_strip(hit) returns the (column, row) of a hit.
+   * Two hits are adjacent if their columns differ by at most max_dcol and their rows by at most max_drow.
+   * Returns the number of clusters
+   */
+  template <class Hit, class GetStrip>
+  unsigned int find_clusters(const std::vector<Hit> &hits, GetStrip get_strip, int max_dcol, int max_drow)
+  {
+    m_strips.clear();
+    for (const auto &hit : hits)
+    {
+      m_strips.push_back(get_strip(hit));
+    }
+    return find_clusters(max_dcol, max_drow);
+  }
+
+  //! number of clusters found by the last call to find_clusters
+  unsigned int nclusters() const { return m_unionfind.nclusters(); }
+
+  //! indices in the input vector of the hits of a given cluster
+  std::pair<const unsigned int *, const unsigned int *> cluster(unsigned int clusid) const
+  {
+    return m_unionfind.cluster(clusid);
+  }
+
+ private:
+  unsigned int find_clusters(int max_dcol, int max_drow);
+
+  std::vector<strip> m_strips;
+
+  //! hit indices sorted by strip
+  std::vector<unsigned int> m_sorted;
+
+  TrkrHitUnionFind m_unionfind;
+};
+
+#endif
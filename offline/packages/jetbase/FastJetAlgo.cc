@@ -27,12 +27,14 @@
 #include <boost/format.hpp>
 
 // standard includes
+#include <algorithm>
 #include <cassert>
 #include <cmath>  // for isfinite
 #include <fstream>
 #include <iostream>
 #include <map>      // for _Rb_tree_iterator
 #include <memory>   // for allocator_traits<>::value_type
+#include <sstream>
 #include <string>   // for operator<<
 #include <utility>  // for pair
 #include <vector>
@@ -159,9 +161,10 @@ float FastJetAlgo::calc_rhomeddens(std::vector<fastjet::PseudoJet>& constituents
 }
 
 std::vector<fastjet::PseudoJet>
-FastJetAlgo::jets_to_pseudojets(std::vector<Jet*>& particles) const
+FastJetAlgo::make_pseudojets(std::vector<Jet*>& particles, float min_E)
 {
   std::vector<fastjet::PseudoJet> pseudojets;
+  pseudojets.reserve(particles.size());
   for (unsigned int ipart = 0; ipart < particles.size(); ++ipart)
   {
     // fastjet performs strangely with exactly (px,py,pz,E) =
@@ -170,7 +173,7 @@ FastJetAlgo::jets_to_pseudojets(std::vector<Jet*>& particles) const
 
     // Ignore particles with negative/small energies
 
-    if (particles[ipart]->get_e() < m_opt.constituent_min_E)
+    if (particles[ipart]->get_e() < min_E)
     {
       continue;
     }
@@ -190,16 +193,26 @@ FastJetAlgo::jets_to_pseudojets(std::vector<Jet*>& particles) const
                                  particles[ipart]->get_py(),
                                  particles[ipart]->get_pz(),
                                  particles[ipart]->get_e());
-    if (m_opt.use_constituent_min_pt && pseudojet.perp() < m_opt.constituent_min_pt)
-    {
-      continue;
-    }
     pseudojet.set_user_index(ipart);
     pseudojets.push_back(pseudojet);
   }
   return pseudojets;
 }
 
+std::vector<fastjet::PseudoJet>
+FastJetAlgo::jets_to_pseudojets(std::vector<Jet*>& particles) const
+{
+  std::vector<fastjet::PseudoJet> pseudojets = make_pseudojets(particles, m_opt.constituent_min_E);
+  if (m_opt.use_constituent_min_pt)
+  {
+    pseudojets.erase(std::remove_if(pseudojets.begin(), pseudojets.end(),
+                                    [this](const fastjet::PseudoJet& pseudojet)
+                                    { return pseudojet.perp() < m_opt.constituent_min_pt; }),
+                     pseudojets.end());
+  }
+  return pseudojets;
+}
+
 void FastJetAlgo::first_call_init(JetContainer* jetcont)
 {
   m_first_cluster_call = false;
@@ -252,11 +265,8 @@ void FastJetAlgo::first_call_init(JetContainer* jetcont)
 
 void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* jetcont)
 {
-  if (m_first_cluster_call)
-  {
-    first_call_init(jetcont);
-  }
   // initalize the properties in JetContainer
+  init_container(jetcont);
 
   if (m_opt.verbosity > 1)
   {
@@ -269,13 +279,56 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
 
   // translate input jets to input fastjets
   auto pseudojets = jets_to_pseudojets(particles);
+  cluster_pseudojets(pseudojets);
+  fill_container(particles, jetcont);
+}
+
+void FastJetAlgo::init_container(JetContainer* jetcont)
+{
+  if (m_first_cluster_call)
+  {
+    first_call_init(jetcont);
+  }
+}
+
+void FastJetAlgo::cluster(const std::vector<fastjet::PseudoJet>& shared_pseudojets)
+{
+  if (m_opt.verbosity > 1)
+  {
+    m_cluster_messages << "   Verbosity>1 FastJetAlgo::cluster -- entered" << std::endl;
+  }
+
+  // same selection as jets_to_pseudojets, the shared pseudojets may have a looser energy cut
+  std::vector<fastjet::PseudoJet> pseudojets;
+  pseudojets.reserve(shared_pseudojets.size());
+  for (const auto& pseudojet : shared_pseudojets)
+  {
+    if (pseudojet.e() < m_opt.constituent_min_E)
+    {
+      continue;
+    }
+    if (m_opt.use_constituent_min_pt && pseudojet.perp() < m_opt.constituent_min_pt)
+    {
+      continue;
+    }
+    pseudojets.push_back(pseudojet);
+  }
+  if (m_opt.verbosity > 8)
+  {
+    m_cluster_messages << "   Verbosity>8 #input pseudojets: " << pseudojets.size() << std::endl;
+  }
+
+  cluster_pseudojets(pseudojets);
+}
 
+void FastJetAlgo::cluster_pseudojets(std::vector<fastjet::PseudoJet>& pseudojets)
+{
   // if using constituent subtraction, oberve maximum eta and subtract the constituents
   if (m_opt.cs_calc_constsub)
   {
     if (m_opt.verbosity > 100)
     {
-      std::cout << " Before Constituent Subtraction: " << std::endl;
+      m_cluster_messages << " Before Constituent Subtraction: " << std::endl;
       int i = 0;
       double sumpt = 0.;
       for (const auto& c : pseudojets)
@@ -283,12 +336,12 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
         sumpt += c.perp();
         if (i < 100)
         {
-          std::cout << (boost::format(" jet[%2i] %8.4f  sum %8.4f") % i % c.perp() % sumpt).str() << std::endl;
+          m_cluster_messages << (boost::format(" jet[%2i] %8.4f  sum %8.4f") % i % c.perp() % sumpt).str() << std::endl;
         }
         i++;
       }
       auto _c = pseudojets.back();
-      std::cout << (boost::format(" jet[%2i] %8.4f  sum %8.4f") % i++ % _c.perp() % sumpt).str() << std::endl
+      m_cluster_messages << (boost::format(" jet[%2i] %8.4f  sum %8.4f") % i++ % _c.perp() % sumpt).str() << std::endl
                 << std::endl;
     }
 
@@ -299,7 +352,7 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
 
     if (m_opt.verbosity > 100)
     {
-      std::cout << " After Constituent Subtraction: " << std::endl;
+      m_cluster_messages << " After Constituent Subtraction: " << std::endl;
       int i = 0;
       double sumpt = 0.;
       for (const auto& c : pseudojets)
@@ -307,45 +360,58 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
         sumpt += c.perp();
         if (i < 100)
         {
-          std::cout << (boost::format(" jet[%2i] %8.4f  sum %8.4f") % i % c.perp() % sumpt).str() << std::endl;
+          m_cluster_messages << (boost::format(" jet[%2i] %8.4f  sum %8.4f") % i % c.perp() % sumpt).str() << std::endl;
         }
         i++;
       }
       auto _c = pseudojets.back();
-      std::cout << (boost::format(" jet[%2i] %8.4f  sum %8.4f") % i++ % _c.perp() % sumpt).str() << std::endl
+      m_cluster_messages << (boost::format(" jet[%2i] %8.4f  sum %8.4f") % i++ % _c.perp() % sumpt).str() << std::endl
                 << std::endl;
     }
   }
 
   if (m_opt.calc_jetmedbkgdens)
   {
-    jetcont->set_rho_median(calc_rhomeddens(pseudojets));
+    m_rho_median = calc_rhomeddens(pseudojets);
   }
 
-  auto fastjets = (m_opt.calc_area ? cluster_area_jets(pseudojets) : cluster_jets(pseudojets));
+  m_fastjets = (m_opt.calc_area ? cluster_area_jets(pseudojets) : cluster_jets(pseudojets));
 
   if (m_opt.verbosity > 8)
   {
-    std::cout << "   Verbosity>8 fastjets: " << fastjets.size() << std::endl;
+    m_cluster_messages << "   Verbosity>8 fastjets: " << m_fastjets.size() << std::endl;
   }
-  for (unsigned int ijet = 0; ijet < fastjets.size(); ++ijet)
+}
+
+void FastJetAlgo::fill_container(std::vector<Jet*>& particles, JetContainer* jetcont)
+{
+  // messages from cluster(), which may have run on another thread
+  std::cout << m_cluster_messages.str();
+  m_cluster_messages.str("");
+
+  if (m_opt.calc_jetmedbkgdens)
+  {
+    jetcont->set_rho_median(m_rho_median);
+  }
+
+  for (unsigned int ijet = 0; ijet < m_fastjets.size(); ++ijet)
   {
     auto* jet = jetcont->add_jet();  // put a new Jetv2 into the TClonesArray
-    jet->set_px(fastjets[ijet].px());
-    jet->set_py(fastjets[ijet].py());
-    jet->set_pz(fastjets[ijet].pz());
-    jet->set_e(fastjets[ijet].e());
+    jet->set_px(m_fastjets[ijet].px());
+    jet->set_py(m_fastjets[ijet].py());
+    jet->set_pz(m_fastjets[ijet].pz());
+    jet->set_e(m_fastjets[ijet].e());
     jet->set_id(ijet);
 
     if (m_opt.calc_area)
     {
-      jet->set_property(m_area_index, fastjets[ijet].area());
+      jet->set_property(m_area_index, m_fastjets[ijet].area());
     }
 
     // if SoftDrop enabled, and jets have > 5 GeV (do not waste time
     // on very low-pT jets), run SD and pack output into jet properties
     // remove jets that have negative energies
-    if (m_opt.doSoftDrop && fastjets[ijet].perp() > 5)
+    if (m_opt.doSoftDrop && m_fastjets[ijet].perp() > 5)
     {
       fastjet::contrib::SoftDrop sd(m_opt.SD_beta, m_opt.SD_zcut);
       if (m_opt.verbosity > 5)
@@ -354,13 +420,13 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
                   << sd.description() << std::endl;
       }
 
-      fastjet::PseudoJet sd_jet = sd(fastjets[ijet]);
+      fastjet::PseudoJet sd_jet = sd(m_fastjets[ijet]);
 
       if (m_opt.verbosity > 5)
       {
-        std::cout << "original    jet: pt / eta / phi / m = " << fastjets[ijet].perp()
-                  << " / " << fastjets[ijet].eta() << " / " << fastjets[ijet].phi() << " / "
-                  << fastjets[ijet].m() << std::endl;
+        std::cout << "original    jet: pt / eta / phi / m = " << m_fastjets[ijet].perp()
+                  << " / " << m_fastjets[ijet].eta() << " / " << m_fastjets[ijet].phi() << " / "
+                  << m_fastjets[ijet].m() << std::endl;
         std::cout << "SoftDropped jet: pt / eta / phi / m = " << sd_jet.perp() << " / "
                   << sd_jet.eta() << " / " << sd_jet.phi() << " / " << sd_jet.m() << std::endl;
 
@@ -377,7 +443,7 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
 
     // Count clustered components. If desired, put original components into the output jet.
     //    int n_clustered = 0;
-    std::vector<fastjet::PseudoJet> constituents = fastjets[ijet].constituents();
+    std::vector<fastjet::PseudoJet> constituents = m_fastjets[ijet].constituents();
     if (m_opt.calc_area)
     {
       for (auto& comp : constituents)
@@ -411,6 +477,7 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
     std::cout << "FastJetAlgo::process_event -- exited" << std::endl;
   }
   delete (m_opt.calc_area ? m_cluseqarea : m_cluseq);  // if (m_cluseq) delete m_cluseq;
+  m_fastjets.clear();
 }
 
 std::vector<Jet*> FastJetAlgo::get_jets(std::vector<Jet*> particles)
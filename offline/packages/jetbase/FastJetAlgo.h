@@ -9,6 +9,7 @@
 #include <fastjet/PseudoJet.hh>
 
 #include <iostream>  // for cout, ostream
+#include <sstream>
 #include <vector>    // for vector
 
 namespace fastjet
@@ -49,6 +50,20 @@ class FastJetAlgo : public JetAlgo
   std::vector<Jet*> get_jets(std::vector<Jet*> particles) override;
   void cluster_and_fill(std::vector<Jet*>& particles, JetContainer* jetcont) override;
 
+  //----------------------------------------------------------------------
+  //  cluster_and_fill in three steps, used by JetReco to convert the input
+  //  particles once for all its algorithms. cluster() only uses this
+  //  algorithm, so that different algorithms can run it on different
+  //  threads; init_container() and fill_container() write to the
+  //  JetContainer and must be called from the event thread.
+  //----------------------------------------------------------------------
+  //! pseudojets for all particles with E >= min_E, with the particle index as user index
+  static std::vector<fastjet::PseudoJet> make_pseudojets(std::vector<Jet*>& particles, float min_E);
+  float get_constituent_min_E() const { return m_opt.constituent_min_E; }
+  void init_container(JetContainer* jetcont);
+  void cluster(const std::vector<fastjet::PseudoJet>& shared_pseudojets);
+  void fill_container(std::vector<Jet*>& particles, JetContainer* jetcont);
+
  private:
   FastJetOptions m_opt{};
   bool m_first_cluster_call{true};
@@ -61,6 +76,7 @@ class FastJetAlgo : public JetAlgo
 
   // Internal processes
   std::vector<fastjet::PseudoJet> jets_to_pseudojets(std::vector<Jet*>& particles) const;
+  void cluster_pseudojets(std::vector<fastjet::PseudoJet>& pseudojets);
   std::vector<fastjet::PseudoJet> cluster_jets(std::vector<fastjet::PseudoJet>& pseudojets);
   std::vector<fastjet::PseudoJet> cluster_area_jets(std::vector<fastjet::PseudoJet>& pseudojets);
   float calc_rhomeddens(std::vector<fastjet::PseudoJet>& constituents) const;
@@ -75,6 +91,12 @@ class FastJetAlgo : public JetAlgo
 
   fastjet::ClusterSequence* m_cluseq{nullptr};
   fastjet::ClusterSequence* m_cluseqarea{nullptr};
+
+  // output of cluster_pseudojets, kept until fill_container
+  std::vector<fastjet::PseudoJet> m_fastjets;
+  float m_rho_median{0};
+  // verbose output of cluster, printed from fill_container on the event thread
+  std::ostringstream m_cluster_messages;
 };
 
 #endif
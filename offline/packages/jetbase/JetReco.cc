@@ -1,6 +1,7 @@
 
 #include "JetReco.h"
 
+#include "FastJetAlgo.h"
 #include "Jet.h"
 #include "JetAlgo.h"
 #include "JetContainer.h"
@@ -19,15 +20,19 @@
 #include <phool/PHNodeIterator.h>
 #include <phool/PHObject.h>  // for PHObject
 #include <phool/PHTypedNodeIterator.h>
+#include <phool/PHWorkerPool.h>
 #include <phool/getClass.h>
 #include <phool/phool.h>  // for PHWHERE
 
 #include <boost/format.hpp>
 
 // standard includes
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>  // for exit
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>  // for allocator_traits<>::value_type
 #include <vector>
 
@@ -79,6 +84,32 @@ int JetReco::InitRun(PHCompositeNode *topNode)
     std::cout << "===========================================================================" << std::endl;
   }
 
+  _fastjet_algos.clear();
+  if (_shared_input)
+  {
+    for (auto &_algo : _algos)
+    {
+      auto *fastjet_algo = dynamic_cast<FastJetAlgo *>(_algo);
+      if (!fastjet_algo)
+      {
+        std::cout << PHWHERE << " " << Name() << ": shared input needs FastJetAlgo's only, running the algorithms one by one" << std::endl;
+        _fastjet_algos.clear();
+        break;
+      }
+      _fastjet_algos.push_back(fastjet_algo);
+    }
+    const unsigned int nthreads = std::min<std::size_t>(_nthreads, _fastjet_algos.size());
+    if (nthreads > 1 && !_workerpool)
+    {
+      _workerpool = std::make_unique<PHWorkerPool>(nthreads);
+    }
+    if (Verbosity() > 0 && !_fastjet_algos.empty())
+    {
+      std::cout << Name() << ": shared input for " << _fastjet_algos.size() << " algorithms, "
+                << (_workerpool ? _workerpool->size() : 1) << " threads" << std::endl;
+    }
+  }
+
   return CreateNodes(topNode);
 }
 
@@ -94,6 +125,8 @@ int JetReco::process_event(PHCompositeNode *topNode)
   // Get Objects off of the Node Tree
   //------------------------------------------------------------------
 
+  const auto start = std::chrono::steady_clock::now();
+
   std::vector<Jet *> inputs;  // owns memory
   for (auto &_input : _inputs)
   {
@@ -105,14 +138,20 @@ int JetReco::process_event(PHCompositeNode *topNode)
     }
   }
 
+  const auto input_done = std::chrono::steady_clock::now();
+
   //---------------------------
   // Run the jet reconstruction
   //---------------------------
+  if (use_jetcon && !_fastjet_algos.empty())
+  {
+    FillJetContainers(topNode, inputs);
+  }
   for (unsigned int ialgo = 0; ialgo < _algos.size(); ++ialgo)
   {
     // send the output somewhere on the DST
     /* if (_fill_JetContainer) { */
-    if (use_jetcon)
+    if (use_jetcon && _fastjet_algos.empty())
     {
       if (Verbosity() > 5)
       {
@@ -188,6 +227,11 @@ int JetReco::process_event(PHCompositeNode *topNode)
     }
   }
 
+  const auto algo_done = std::chrono::steady_clock::now();
+  ++_nevents;
+  _input_time += std::chrono::duration<double>(input_done - start).count();
+  _algo_time += std::chrono::duration<double>(algo_done - input_done).count();
+
   // clean up input vector
   // <- another place where TClonesArray's would make this more efficient
   for (auto &input : inputs)
@@ -204,6 +248,19 @@ int JetReco::process_event(PHCompositeNode *topNode)
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
+int JetReco::End(PHCompositeNode * /*topNode*/)
+{
+  if (Verbosity() > 0 && _nevents > 0)
+  {
+    std::cout << Name() << ": " << _nevents << " events, inputs "
+              << 1e3 * _input_time / _nevents << " ms/event, jet finding "
+              << 1e3 * _algo_time / _nevents << " ms/event for "
+              << _algos.size() << " algorithms" << std::endl;
+  }
+  _workerpool.reset();
+  return Fun4AllReturnCodes::EVENT_OK;
+}
+
 int JetReco::CreateNodes(PHCompositeNode *topNode)
 {
   PHNodeIterator iter(topNode);
@@ -307,6 +364,61 @@ void JetReco::FillJetContainer(PHCompositeNode *topNode, int ipos, std::vector<J
   return;
 }
 
+void JetReco::FillJetContainers(PHCompositeNode *topNode, std::vector<Jet *> &inputs)
+{
+  std::vector<JetContainer *> jetconns;
+  float min_E = std::numeric_limits<float>::max();
+  for (unsigned int ialgo = 0; ialgo < _fastjet_algos.size(); ++ialgo)
+  {
+    JetContainer *jetconn = findNode::getClass<JetContainer>(topNode, JC_name(_outputs[ialgo]));
+    if (!jetconn)
+    {
+      std::cout << PHWHERE << " ERROR: Can't find JetContainer: " << _outputs[ialgo] << std::endl;
+      exit(-1);
+    }
+    jetconn->Reset();
+    _fastjet_algos[ialgo]->init_container(jetconn);
+    jetconns.push_back(jetconn);
+    min_E = std::min(min_E, _fastjet_algos[ialgo]->get_constituent_min_E());
+  }
+
+  // one set of pseudojets for all algorithms, each applies its own constituent cuts
+  const std::vector<fastjet::PseudoJet> pseudojets = FastJetAlgo::make_pseudojets(inputs, min_E);
+
+  // the algorithms are independent, the containers are filled afterwards on this thread
+  if (_workerpool)
+  {
+    _workerpool->run(_fastjet_algos.size(), [&](unsigned int /*worker*/, std::size_t ialgo)
+                     { _fastjet_algos[ialgo]->cluster(pseudojets); });
+  }
+  else
+  {
+    for (auto *algo : _fastjet_algos)
+    {
+      algo->cluster(pseudojets);
+    }
+  }
+
+  for (unsigned int ialgo = 0; ialgo < _fastjet_algos.size(); ++ialgo)
+  {
+    if (Verbosity() > 5)
+    {
+      std::cout << " Verbosity>5:: filling JetContainter for " << JC_name(_outputs[ialgo]) << std::endl;
+    }
+    _fastjet_algos[ialgo]->fill_container(inputs, jetconns[ialgo]);
+    for (auto &_input : _inputs)
+    {
+      jetconns[ialgo]->insert_src(_input->get_src());
+    }
+
+    if (Verbosity() > 7)
+    {
+      std::cout << " Verbosity()>7:: jets in container " << _outputs[ialgo] << std::endl;
+      jetconns[ialgo]->print_jets();
+    }
+  }
+}
+
 JetAlgo *JetReco::get_algo(unsigned int which_algo)
 {
   if (_algos.empty())
@@ -11,14 +11,17 @@
 #include <fun4all/SubsysReco.h>
 
 // standard includes
+#include <memory>
 #include <string>  // for string
 #include <vector>
 
 // forward declarations
+class FastJetAlgo;
 class Jet;
 class JetAlgo;
 class JetInput;
 class PHCompositeNode;
+class PHWorkerPool;
 
 /// \class JetReco
 ///
@@ -44,6 +47,7 @@ class JetReco : public SubsysReco
 
   int InitRun(PHCompositeNode *topNode) override;
   int process_event(PHCompositeNode *topNode) override;
+  int End(PHCompositeNode *topNode) override;
 
   void add_input(JetInput *input) { _inputs.push_back(input); }
   void add_algo(JetAlgo *algo, const std::string &output)
@@ -56,12 +60,20 @@ class JetReco : public SubsysReco
   void set_input_node(const std::string &inputnode) { _inputnode = inputnode; }
   /* void set_fill_JetContainer(bool b) { _fill_JetContainer = b; } */
 
+  /// convert the inputs to pseudojets once per event for all the algorithms
+  /// filling JetContainers (all algorithms must be FastJetAlgo's)
+  void set_shared_input(bool b) { _shared_input = b; }
+  /// with shared input, cluster the algorithms on n threads, started at InitRun.
+  /// Needs FastJet built with thread safety
+  void set_nthreads(unsigned int n) { _nthreads = n; }
+
   JetAlgo *get_algo(unsigned int which_algo = 0);
 
  private:
   int CreateNodes(PHCompositeNode *topNode);
   void FillJetNode(PHCompositeNode *topNode, int ipos, const std::vector<Jet *> &jets);
   void FillJetContainer(PHCompositeNode *topNode, int ipos, std::vector<Jet *> &inputs);
+  void FillJetContainers(PHCompositeNode *topNode, std::vector<Jet *> &inputs);
 
   std::vector<JetInput *> _inputs;
   std::vector<JetAlgo *> _algos;
@@ -69,6 +81,18 @@ class JetReco : public SubsysReco
   std::string _inputnode;
   std::vector<std::string> _outputs;
 
+  bool _shared_input{false};
+  unsigned int _nthreads{1};
+  // _algos, if running with shared input
+  std::vector<FastJetAlgo *> _fastjet_algos;
+  // threads clustering _fastjet_algos, reused for all events
+  std::unique_ptr<PHWorkerPool> _workerpool;
+
+  // time spent in getting the inputs and in the algorithms
+  unsigned long _nevents{0};
+  double _input_time{0};
+  double _algo_time{0};
+
   // transition functions, while moving from JetMap to JetContainer.
   // May be removed after transition is made, depending on state of
   // functions
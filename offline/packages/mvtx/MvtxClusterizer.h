@@ -7,12 +7,15 @@
 #ifndef MVTX_MVTXCLUSTERIZER_H
 #define MVTX_MVTXCLUSTERIZER_H
 
+#include "MvtxPixelClusterFinder.h"
+
 #include <fun4all/SubsysReco.h>
 #include <trackbase/TrkrCluster.h>
 #include <trackbase/TrkrDefs.h>
 
 #include <string>  // for string
 #include <utility>
+#include <vector>
 
 class ClusHitsVerbose;
 class PHCompositeNode;
@@ -63,10 +66,7 @@ class MvtxClusterizer : public SubsysReco
   ClusHitsVerbose *mClusHitsVerbose{nullptr};
 
  private:
-  // bool are_adjacent(const pixel lhs, const pixel rhs);
   bool record_ClusHitsVerbose{false};
-  bool are_adjacent(const std::pair<TrkrDefs::hitkey, TrkrHit *> &lhs, const std::pair<TrkrDefs::hitkey, TrkrHit *> &rhs) const;
-  bool are_adjacent(RawHit *lhs, RawHit *rhs) const;
 
   void ClusterMvtx(PHCompositeNode *topNode);
   void ClusterMvtxRaw(PHCompositeNode *topNode);
@@ -79,6 +79,10 @@ class MvtxClusterizer : public SubsysReco
 
   TrkrClusterHitAssoc *m_clusterhitassoc {nullptr};
 
+  // clustering of the hits of a chip, buffers are reused from one chip to the next
+  MvtxPixelClusterFinder m_clusterfinder;
+  std::vector<pixel> m_pixels;
+
   // settings
   bool m_makeZClustering {true};  // z_clustering_option
   bool do_hit_assoc {true};
@@ -0,0 +1,70 @@
+#include "MvtxPixelClusterFinder.h"
+
+#include <algorithm>
+
+unsigned int MvtxPixelClusterFinder::find_clusters(const std::vector<pixel> &pixels, bool zclustering)
+{
+  const auto npixels = static_cast<unsigned int>(pixels.size());
+
+  m_unionfind.reset(npixels);
+
+  // grid dimensions, with one spare cell on each side so that neighbours need no bound check
+  unsigned int maxcol = 0;
+  unsigned int maxrow = 0;
+  for (const auto &[col, row] : pixels)
+  {
+    maxcol = std::max(maxcol, col);
+    maxrow = std::max(maxrow, row);
+  }
+  const std::size_t stride = maxrow + 3;
+  const std::size_t ncells = (maxcol + 3) * stride;
+  if (m_grid.size() < ncells)
+  {
+    m_grid.resize(ncells, 0);
+  }
+
+  auto cell = [stride](const pixel &pix)
+  { return (pix.first + 1) * stride + pix.second + 1; };
+
+  for (unsigned int i = 0; i < npixels; ++i)
+  {
+    const std::size_t index = cell(pixels[i]);
+
+    // the same pixel given twice belongs to the same cluster
+    if (m_grid[index])
+    {
+      m_unionfind.unite(i, m_grid[index] - 1);
+    }
+    else
+    {
+      m_grid[index] = i + 1;
+    }
+
+    // only neighbours already on the grid are checked, the others will find this pixel
+    for (const std::size_t neighbour : {index - 1, index + 1})
+    {
+      if (m_grid[neighbour])
+      {
+        m_unionfind.unite(i, m_grid[neighbour] - 1);
+      }
+    }
+    if (zclustering)
+    {
+      for (const std::size_t neighbour : {index - stride - 1, index - stride, index - stride + 1,
+                                          index + stride - 1, index + stride, index + stride + 1})
+      {
+        if (m_grid[neighbour])
+        {
+          m_unionfind.unite(i, m_grid[neighbour] - 1);
+        }
+      }
+    }
+  }
+
+  for (const auto &pix : pixels)
+  {
+    m_grid[cell(pix)] = 0;
+  }
+
+  return m_unionfind.make_clusters();
+}
@@ -0,0 +1,57 @@
+/**
+ * @file mvtx/MvtxPixelClusterFinder.h
+ * @brief Connected pixel search on the ALPIDE grid
+ */
+#ifndef MVTX_MVTXPIXELCLUSTERFINDER_H
+#define MVTX_MVTXPIXELCLUSTERFINDER_H
+
+#include <trackbase/TrkrHitUnionFind.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Groups the fired pixels of a chip into clusters of adjacent pixels
+ *
+ * Pixels are dropped on a (column, row) grid of pixel indices and merged
+ * with their fired neighbours through a TrkrHitUnionFind, so the cost is linear
+ * in the number of pixels. Pixels are adjacent if they share an edge or a corner,
+ * or only if they are in the same column and neighbouring rows without z clustering.
+ *
+ * Clusters are numbered in order of their first pixel and list their pixels
+ * in input order, which is the numbering of boost::connected_components on
+ * the pixel adjacency graph.
+ *
+ * All buffers, including the grid, are kept from one chip to the next.
+ */
+class MvtxPixelClusterFinder
+{
+ public:
+  //! column, row
+  using pixel = std::pair<unsigned int, unsigned int>;
+
+  //! find clusters. Returns the number of clusters
+  unsigned int find_clusters(const std::vector<pixel> &pixels, bool zclustering);
+
+  //! number of clusters found by the last call to find_clusters
+  unsigned int nclusters() const { return m_unionfind.nclusters(); }
+
+  //! indices in the input vector of the pixels of a given cluster
+  std::pair<const unsigned int *, const unsigned int *> cluster(unsigned int clusid) const
+  {
+    return m_unionfind.cluster(clusid);
+  }
+
+  //! cluster of each input pixel
+  const std::vector<unsigned int> &cluster_ids() const { return m_unionfind.cluster_ids(); }
+
+ private:
+  //! pixel index + 1 per grid cell, 0 for empty cells. Only the cells of the
+  //! current chip are set, they are cleared once the chip is processed
+  std::vector<unsigned int> m_grid;
+
+  TrkrHitUnionFind m_unionfind;
+};
+
+#endif  // MVTX_MVTXPIXELCLUSTERFINDER_H
@@ -43,6 +43,7 @@
 #include <phool/PHNode.h>        // for PHNode
 #include <phool/PHNodeIterator.h>
 #include <phool/PHObject.h>  // for PHObject
+#include <phool/PHWorkerPool.h>
 #include <phool/getClass.h>
 #include <phool/phool.h>  // for PHWHERE
 
@@ -55,16 +56,17 @@
 #include <memory>
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>  // for sqrt, cos, sin
+#include <iomanip>
 #include <iostream>
 #include <limits>
 #include <map>  // for _Rb_tree_cons...
 #include <string>
+#include <thread>
 #include <utility>  // for pair
 #include <vector>
 #include <unordered_set>
-// Terra incognita....
-#include <pthread.h>
 
 namespace
 {
@@ -137,9 +139,26 @@ namespace
     bool fillClusHitsVerbose = false;
     vec_dVerbose phivec_ClusHitsVerbose;  // only fill if fillClusHitsVerbose
     vec_dVerbose zvec_ClusHitsVerbose;    // only fill if fillClusHitsVerbose
+
+    // filled by the worker processing this sector
+    unsigned int worker = 0;
+    double processing_time = 0;  // ms
+  };
+
+  // per thread scratch buffers, reused from one sector (and event) to the next
+  struct sector_scratch
+  {
+    std::vector<std::vector<unsigned short>> adcval;
+    std::multimap<unsigned short, ihit> all_hit_map;
+    std::vector<ihit> ihit_list;
   };
 
-  pthread_mutex_t mythreadlock;
+  sector_scratch &get_sector_scratch()
+  {
+    // worker threads are persistent, so are their scratch buffers
+    thread_local sector_scratch scratch;
+    return scratch;
+  }
 
   void remove_hit(double adc, int phibin, int tbin, int edge, std::multimap<unsigned short, ihit> &all_hit_map, std::vector<std::vector<unsigned short>> &adcval)
   {
@@ -827,10 +846,18 @@ namespace
     const auto &maxz = my_data->tGeometry->get_max_driftlength() + my_data->tGeometry->get_CM_halfwidth();
     const auto &layer = my_data->layer;
     //    int nhits = 0;
-    // for convenience, create a 2D vector to store adc values in and initialize to zero
-    std::vector<std::vector<unsigned short>> adcval(phibins, std::vector<unsigned short>(tbins, 0));
-    std::multimap<unsigned short, ihit> all_hit_map;
-    std::vector<ihit> hit_vect;
+    // for convenience, use a 2D vector to store adc values in and initialize to zero
+    // the buffers are owned by the calling thread and keep their capacity across sectors
+    auto &scratch = get_sector_scratch();
+    auto &adcval = scratch.adcval;
+    adcval.resize(phibins);
+    for (auto &row : adcval)
+    {
+      row.assign(tbins, 0);
+    }
+    auto &all_hit_map = scratch.all_hit_map;
+    all_hit_map.clear();
+    auto &ihit_list = scratch.ihit_list;
 
     int tbinmax = tbins;
     int tbinmin = 0;
@@ -1063,7 +1090,7 @@ namespace
       // put all hits in the all_hit_map (sorted by adc)
       // start with highest adc hit
       //  -> cluster around it and get vector of hits
-      std::vector<ihit> ihit_list;
+      ihit_list.clear();
       int ntouch = 0;
       int nedge = 0;
       get_cluster(iphi, it, *my_data, adcval, ihit_list, ntouch, nedge);
@@ -1132,14 +1159,14 @@ namespace
                 << std::endl;
     }
     */
-    // pthread_exit(nullptr);
   }
 
-  void *ProcessSector(void *threadarg)
+  void ProcessSector(thread_data &my_data, unsigned int worker)
   {
-    auto *my_data = static_cast<thread_data *>(threadarg);
-    ProcessSectorData(my_data);
-    pthread_exit(nullptr);
+    const auto start = std::chrono::steady_clock::now();
+    ProcessSectorData(&my_data);
+    my_data.processing_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    my_data.worker = worker;
   }
 }  // namespace
 
@@ -1149,6 +1176,9 @@ TpcClusterizer::TpcClusterizer(const std::string &name)
 {
 }
 
+// out of line so that PHWorkerPool can stay an incomplete type in the header
+TpcClusterizer::~TpcClusterizer() = default;
+
 bool TpcClusterizer::is_in_sector_boundary(int phibin, int sector, PHG4TpcGeom *layergeom) const
 {
   bool reject_it = false;
@@ -1319,6 +1349,26 @@ int TpcClusterizer::InitRun(PHCompositeNode *topNode)
     makeChannelMask(m_hotChannelMap, m_hotChannelMapName, "TotalHotChannels");
   }
 
+  // persistent worker pool, reused for all events. With a single thread the sectors are processed on the calling thread
+  unsigned int nthreads = m_num_threads;
+  if (nthreads == 0)
+  {
+    nthreads = std::max(1U, std::thread::hardware_concurrency());
+  }
+  if (!do_sequential && nthreads > 1 && !m_workerpool)
+  {
+    m_workerpool = std::make_unique<PHWorkerPool>(nthreads);
+    m_worker_busy_time.assign(m_workerpool->size(), 0);
+    if (Verbosity() > 0)
+    {
+      std::cout << "TpcClusterizer::InitRun - using " << m_workerpool->size() << " worker threads" << std::endl;
+    }
+  }
+  if (m_worker_busy_time.empty())
+  {
+    m_worker_busy_time.assign(1, 0);
+  }
+
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
@@ -1441,27 +1491,12 @@ int TpcClusterizer::process_event(PHCompositeNode *topNode)
       rawhitsetrange = m_rawhits->getHitSets(TrkrDefs::TrkrId::tpcId);
       num_hitsets = std::distance(rawhitsetrange.first, rawhitsetrange.second);
     }
-  // create structure to store given thread and associated data
-  struct thread_pair_t
-  {
-    pthread_t thread{};
-    thread_data data;
-  };
-
-  // create vector of thread pairs and reserve the right size upfront to avoid reallocation
-  std::vector<thread_pair_t> threads;
-  threads.reserve(num_hitsets);
+  const auto event_start = std::chrono::steady_clock::now();
 
-  pthread_attr_t attr;
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+  // one work item per hitset, reserve the right size upfront to avoid reallocation
+  std::vector<thread_data> sector_jobs;
+  sector_jobs.reserve(num_hitsets);
 
-  if (pthread_mutex_init(&mythreadlock, nullptr) != 0)
-  {
-    std::cout << std::endl
-              << " mutex init failed" << std::endl;
-    return 1;
-  }
 //  int count = 0;
 
   if (!do_read_raw)
@@ -1477,40 +1512,40 @@ int TpcClusterizer::process_event(PHCompositeNode *topNode)
       unsigned int sector = TpcDefs::getSectorId(hitsetitr->first);
       PHG4TpcGeom *layergeom = geom_container->GetLayerCellGeom(layer);
 
-      // instanciate new thread pair, at the end of thread vector
-      thread_pair_t &thread_pair = threads.emplace_back();
+      // instanciate new work item, at the end of job vector
+      thread_data &job = sector_jobs.emplace_back();
       if (mClusHitsVerbose)
       {
-        thread_pair.data.fillClusHitsVerbose = true;
+        job.fillClusHitsVerbose = true;
       };
 
-      thread_pair.data.layergeom = layergeom;
-      thread_pair.data.hitset = hitset;
-      thread_pair.data.rawhitset = nullptr;
-      thread_pair.data.layer = layer;
-      thread_pair.data.pedestal = pedestal;
-      thread_pair.data.seed_threshold = seed_threshold;
-      thread_pair.data.edge_threshold = edge_threshold;
-      thread_pair.data.sector = sector;
-      thread_pair.data.side = side;
-      thread_pair.data.do_assoc = do_hit_assoc;
-      thread_pair.data.do_wedge_emulation = do_wedge_emulation;
-      thread_pair.data.do_singles = do_singles;
-      thread_pair.data.tGeometry = m_tGeometry;
-      thread_pair.data.maxHalfSizeT = MaxClusterHalfSizeT;
-      thread_pair.data.maxHalfSizePhi = MaxClusterHalfSizePhi;
-      thread_pair.data.verbosity = Verbosity();
-      thread_pair.data.do_split = do_split;
-      thread_pair.data.FixedWindow = do_fixed_window;
-      thread_pair.data.min_err_squared = min_err_squared;
-      thread_pair.data.min_clus_size = min_clus_size;
-      thread_pair.data.min_adc_sum = min_adc_sum;
+      job.layergeom = layergeom;
+      job.hitset = hitset;
+      job.rawhitset = nullptr;
+      job.layer = layer;
+      job.pedestal = pedestal;
+      job.seed_threshold = seed_threshold;
+      job.edge_threshold = edge_threshold;
+      job.sector = sector;
+      job.side = side;
+      job.do_assoc = do_hit_assoc;
+      job.do_wedge_emulation = do_wedge_emulation;
+      job.do_singles = do_singles;
+      job.tGeometry = m_tGeometry;
+      job.maxHalfSizeT = MaxClusterHalfSizeT;
+      job.maxHalfSizePhi = MaxClusterHalfSizePhi;
+      job.verbosity = Verbosity();
+      job.do_split = do_split;
+      job.FixedWindow = do_fixed_window;
+      job.min_err_squared = min_err_squared;
+      job.min_clus_size = min_clus_size;
+      job.min_adc_sum = min_adc_sum;
 
       // --- pass dead/hot map info ---
-      thread_pair.data.deadMap  = &m_deadChannelMap;
-      thread_pair.data.hotMap   = &m_hotChannelMap;
-      thread_pair.data.maskDead = m_maskDeadChannels;
-      thread_pair.data.maskHot  = m_maskHotChannels;
+      job.deadMap  = &m_deadChannelMap;
+      job.hotMap   = &m_hotChannelMap;
+      job.maskDead = m_maskDeadChannels;
+      job.maskHot  = m_maskHotChannels;
 
       unsigned short NPhiBins = (unsigned short) layergeom->get_phibins();
       unsigned short NPhiBinsSector = NPhiBins / 12;
@@ -1530,73 +1565,17 @@ int TpcClusterizer::process_event(PHCompositeNode *topNode)
 
       m_tdriftmax = layergeom->get_max_driftlength() / m_tGeometry->get_drift_velocity(); 
       //  std::cout << "     m_tdriftmax " << m_tdriftmax << " drift velocity reco " << m_tGeometry->get_drift_velocity() << std::endl;
-      thread_pair.data.m_tdriftmax = m_tdriftmax;
+      job.m_tdriftmax = m_tdriftmax;
 
-      thread_pair.data.phibins = NPhiBinsSector;
-      thread_pair.data.phioffset = PhiOffset;
-      thread_pair.data.tbins = NTBinsSide;
-      thread_pair.data.toffset = TOffset;
+      job.phibins = NPhiBinsSector;
+      job.phioffset = PhiOffset;
+      job.tbins = NTBinsSide;
+      job.toffset = TOffset;
 
-      thread_pair.data.radius = layergeom->get_radius();
-      thread_pair.data.drift_velocity = m_tGeometry->get_drift_velocity();
-      thread_pair.data.pads_per_sector = 0;
-      thread_pair.data.phistep = 0;
-      int rc;
-      rc = pthread_create(&thread_pair.thread, &attr, ProcessSector, (void *) &thread_pair.data);
-
-      if (rc)
-      {
-        std::cout << "Error:unable to create thread," << rc << std::endl;
-      }
-      if (do_sequential)
-      {
-        int rc2 = pthread_join(thread_pair.thread, nullptr);
-        if (rc2)
-        {
-          std::cout << "Error:unable to join," << rc2 << std::endl;
-        }
-
-        // get the hitsetkey from thread data
-        const auto &data(thread_pair.data);
-        const auto hitsetkey = TpcDefs::genHitSetKey(data.layer, data.sector, data.side);
-
-        // copy clusters to map
-        for (uint32_t index = 0; index < data.cluster_vector.size(); ++index)
-        {
-          // generate cluster key
-          const auto ckey = TrkrDefs::genClusKey(hitsetkey, index);
-
-          // get cluster
-          auto *cluster = data.cluster_vector[index];
-
-          // insert in map
-          m_clusterlist->addClusterSpecifyKey(ckey, cluster);
-
-          if (mClusHitsVerbose)
-          {
-            for (const auto &hit : data.phivec_ClusHitsVerbose[index])
-            {
-              mClusHitsVerbose->addPhiHit(hit.first, hit.second);
-            }
-            for (const auto &hit : data.zvec_ClusHitsVerbose[index])
-            {
-              mClusHitsVerbose->addZHit(hit.first, hit.second);
-            }
-            mClusHitsVerbose->push_hits(ckey);
-          }
-        }
-
-        // copy hit associations to map
-        for (const auto &[index, hkey] : thread_pair.data.association_vector)
-        {
-          // generate cluster key
-          const auto ckey = TrkrDefs::genClusKey(hitsetkey, index);
-
-          // add to association table
-          m_clusterhitassoc->addAssoc(ckey, hkey);
-        }
-      }
-//      count++;
+      job.radius = layergeom->get_radius();
+      job.drift_velocity = m_tGeometry->get_drift_velocity();
+      job.pads_per_sector = 0;
+      job.phistep = 0;
     }
   }
   else
@@ -1615,28 +1594,28 @@ int TpcClusterizer::process_event(PHCompositeNode *topNode)
       unsigned int sector = TpcDefs::getSectorId(hitsetitr->first);
       PHG4TpcGeom *layergeom = geom_container->GetLayerCellGeom(layer);
 
-      // instanciate new thread pair, at the end of thread vector
-      thread_pair_t &thread_pair = threads.emplace_back();
-
-      thread_pair.data.layergeom = layergeom;
-      thread_pair.data.hitset = nullptr;
-      thread_pair.data.rawhitset = hitset;
-      thread_pair.data.layer = layer;
-      thread_pair.data.pedestal = pedestal;
-      thread_pair.data.sector = sector;
-      thread_pair.data.side = side;
-      thread_pair.data.do_assoc = do_hit_assoc;
-      thread_pair.data.do_wedge_emulation = do_wedge_emulation;
-      thread_pair.data.tGeometry = m_tGeometry;
-      thread_pair.data.maxHalfSizeT = MaxClusterHalfSizeT;
-      thread_pair.data.maxHalfSizePhi = MaxClusterHalfSizePhi;
-      thread_pair.data.verbosity = Verbosity();
+      // instanciate new work item, at the end of job vector
+      thread_data &job = sector_jobs.emplace_back();
+
+      job.layergeom = layergeom;
+      job.hitset = nullptr;
+      job.rawhitset = hitset;
+      job.layer = layer;
+      job.pedestal = pedestal;
+      job.sector = sector;
+      job.side = side;
+      job.do_assoc = do_hit_assoc;
+      job.do_wedge_emulation = do_wedge_emulation;
+      job.tGeometry = m_tGeometry;
+      job.maxHalfSizeT = MaxClusterHalfSizeT;
+      job.maxHalfSizePhi = MaxClusterHalfSizePhi;
+      job.verbosity = Verbosity();
 
       // --- pass dead/hot map info ---
-      thread_pair.data.deadMap  = &m_deadChannelMap;
-      thread_pair.data.hotMap   = &m_hotChannelMap;
-      thread_pair.data.maskDead = m_maskDeadChannels;
-      thread_pair.data.maskHot  = m_maskHotChannels;
+      job.deadMap  = &m_deadChannelMap;
+      job.hotMap   = &m_hotChannelMap;
+      job.maskDead = m_maskDeadChannels;
+      job.maskHot  = m_maskHotChannels;
 
       unsigned short NPhiBins = (unsigned short) layergeom->get_phibins();
       unsigned short NPhiBinsSector = NPhiBins / 12;
@@ -1648,12 +1627,12 @@ int TpcClusterizer::process_event(PHCompositeNode *topNode)
 
       m_tdriftmax = layergeom->get_max_driftlength() / m_tGeometry->get_drift_velocity(); 
       //      std::cout << "     m_tdriftmax " << m_tdriftmax << " drift velocity reco " << m_tGeometry->get_drift_velocity() << std::endl;
-      thread_pair.data.m_tdriftmax = m_tdriftmax;
+      job.m_tdriftmax = m_tdriftmax;
 
-      thread_pair.data.phibins = NPhiBinsSector;
-      thread_pair.data.phioffset = PhiOffset;
-      thread_pair.data.tbins = NTBinsSide;
-      thread_pair.data.toffset = TOffset;
+      job.phibins = NPhiBinsSector;
+      job.phioffset = PhiOffset;
+      job.tbins = NTBinsSide;
+      job.toffset = TOffset;
       
       /*
       PHG4TpcGeom *testlayergeom = geom_container->GetLayerCellGeom(32);
@@ -1678,121 +1657,92 @@ int TpcClusterizer::process_event(PHCompositeNode *topNode)
       }
       continue;
       */
-      int rc = 0;
-      //      if(layer==32)
-      rc = pthread_create(&thread_pair.thread, &attr, ProcessSector, (void *) &thread_pair.data);
-      //      else
-      // continue;
-
-      if (rc)
-      {
-        std::cout << "Error:unable to create thread," << rc << std::endl;
-      }
-
-      if (do_sequential)
-      {
-        int rc2 = pthread_join(thread_pair.thread, nullptr);
-        if (rc2)
-        {
-          std::cout << "Error:unable to join," << rc2 << std::endl;
-        }
-
-        // get the hitsetkey from thread data
-        const auto &data(thread_pair.data);
-        const auto hitsetkey = TpcDefs::genHitSetKey(data.layer, data.sector, data.side);
-
-        // copy clusters to map
-        for (uint32_t index = 0; index < data.cluster_vector.size(); ++index)
-        {
-          // generate cluster key
-          const auto ckey = TrkrDefs::genClusKey(hitsetkey, index);
-
-          // get cluster
-          auto *cluster = data.cluster_vector[index];
-
-          // insert in map
-          m_clusterlist->addClusterSpecifyKey(ckey, cluster);
-        }
-
-        // copy hit associations to map
-        for (const auto &[index, hkey] : thread_pair.data.association_vector)
-        {
-          // generate cluster key
-          const auto ckey = TrkrDefs::genClusKey(hitsetkey, index);
-
-          // add to association table
-          m_clusterhitassoc->addAssoc(ckey, hkey);
-        }
-      }
-//      count++;
     }
   }
 
-  pthread_attr_destroy(&attr);
-//  count = 0;
-  // wait for completion of all threads
-  if (!do_sequential)
+  // process the sectors, either on the calling thread or on the worker pool
+  if (do_sequential || !m_workerpool)
   {
-    for (const auto &thread_pair : threads)
+    for (auto &job : sector_jobs)
     {
-      int rc2 = pthread_join(thread_pair.thread, nullptr);
-      if (rc2)
-      {
-        std::cout << "Error:unable to join," << rc2 << std::endl;
-      }
+      ProcessSector(job, 0);
+    }
+  }
+  else
+  {
+    m_workerpool->run(sector_jobs.size(), [&sector_jobs](unsigned int worker, std::size_t index)
+                      { ProcessSector(sector_jobs[index], worker); });
+  }
 
-      // get the hitsetkey from thread data
-      const auto &data(thread_pair.data);
-      const auto hitsetkey = TpcDefs::genHitSetKey(data.layer, data.sector, data.side);
+  // copy the results to the node tree, in hitset order
+  for (const auto &data : sector_jobs)
+  {
+    // get the hitsetkey from thread data
+    const auto hitsetkey = TpcDefs::genHitSetKey(data.layer, data.sector, data.side);
 
-      // copy clusters to map
-      for (uint32_t index = 0; index < data.cluster_vector.size(); ++index)
-      {
-        // generate cluster key
-        const auto ckey = TrkrDefs::genClusKey(hitsetkey, index);
+    // copy clusters to map
+    for (uint32_t index = 0; index < data.cluster_vector.size(); ++index)
+    {
+      // generate cluster key
+      const auto ckey = TrkrDefs::genClusKey(hitsetkey, index);
 
-        // get cluster
-        auto *cluster = data.cluster_vector[index];
+      // get cluster
+      auto *cluster = data.cluster_vector[index];
 
-        // insert in map
-        // std::cout << "X: " << cluster->getLocalX() << "Y: " << cluster->getLocalY() << std::endl;
-        m_clusterlist->addClusterSpecifyKey(ckey, cluster);
+      // insert in map
+      // std::cout << "X: " << cluster->getLocalX() << "Y: " << cluster->getLocalY() << std::endl;
+      m_clusterlist->addClusterSpecifyKey(ckey, cluster);
 
-        if (mClusHitsVerbose)
+      if (mClusHitsVerbose)
+      {
+        for (const auto &hit : data.phivec_ClusHitsVerbose[index])
         {
-          for (const auto &hit : data.phivec_ClusHitsVerbose[index])
-          {
-            mClusHitsVerbose->addPhiHit(hit.first, (float) hit.second);
-          }
-          for (const auto &hit : data.zvec_ClusHitsVerbose[index])
-          {
-            mClusHitsVerbose->addZHit(hit.first, (float) hit.second);
-          }
-          mClusHitsVerbose->push_hits(ckey);
+          mClusHitsVerbose->addPhiHit(hit.first, (float) hit.second);
+        }
+        for (const auto &hit : data.zvec_ClusHitsVerbose[index])
+        {
+          mClusHitsVerbose->addZHit(hit.first, (float) hit.second);
         }
+        mClusHitsVerbose->push_hits(ckey);
       }
+    }
 
-      // copy hit associations to map
-      for (const auto &[index, hkey] : thread_pair.data.association_vector)
-      {
-        // generate cluster key
-        const auto ckey = TrkrDefs::genClusKey(hitsetkey, index);
+    // copy hit associations to map
+    for (const auto &[index, hkey] : data.association_vector)
+    {
+      // generate cluster key
+      const auto ckey = TrkrDefs::genClusKey(hitsetkey, index);
 
-        // add to association table
-        m_clusterhitassoc->addAssoc(ckey, hkey);
-      }
+      // add to association table
+      m_clusterhitassoc->addAssoc(ckey, hkey);
+    }
 
-      for (auto *v_hit : thread_pair.data.v_hits)
+    for (auto *v_hit : data.v_hits)
+    {
+      if (_store_hits)
       {
-        if (_store_hits)
-        {
-          m_training->v_hits.emplace_back(*v_hit);
-        }
-        delete v_hit;
+        m_training->v_hits.emplace_back(*v_hit);
       }
+      delete v_hit;
+    }
+
+    // per sector timing
+    const unsigned int isector = data.side * 12 + data.sector;
+    if (isector < m_sector_time.size())
+    {
+      m_sector_time[isector] += data.processing_time;
+      m_sector_time_max[isector] = std::max(m_sector_time_max[isector], data.processing_time);
+      ++m_sector_calls[isector];
+    }
+    if (data.worker < m_worker_busy_time.size())
+    {
+      m_worker_busy_time[data.worker] += data.processing_time;
     }
   }
 
+  m_event_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - event_start).count();
+  ++m_nevents_timed;
+
   // set the flag to use alignment transformations, needed by the rest of reconstruction
   alignmentTransformationContainer::use_alignment = true;
 
@@ -1821,6 +1771,34 @@ int TpcClusterizer::process_event(PHCompositeNode *topNode)
 
 int TpcClusterizer::End(PHCompositeNode * /*topNode*/)
 {
+  if (Verbosity() > 0 && m_nevents_timed > 0 && m_event_time > 0)
+  {
+    std::cout << "TpcClusterizer::End - timing for " << m_nevents_timed << " events" << std::endl;
+    std::cout << "  mean wall time per event: " << m_event_time / m_nevents_timed << " ms" << std::endl;
+    for (unsigned int isector = 0; isector < m_sector_time.size(); ++isector)
+    {
+      if (m_sector_calls[isector] == 0)
+      {
+        continue;
+      }
+      std::cout << "  side " << isector / 12 << " sector " << std::setw(2) << isector % 12
+                << " hitsets: " << m_sector_calls[isector]
+                << " mean: " << m_sector_time[isector] / m_sector_calls[isector] << " ms"
+                << " max: " << m_sector_time_max[isector] << " ms"
+                << std::endl;
+    }
+
+    // busy fraction per worker, to help sizing the pool
+    for (unsigned int worker = 0; worker < m_worker_busy_time.size(); ++worker)
+    {
+      std::cout << "  worker " << worker
+                << " busy: " << m_worker_busy_time[worker] / m_nevents_timed << " ms/event"
+                << " (" << 100. * m_worker_busy_time[worker] / m_event_time << "%)"
+                << std::endl;
+    }
+  }
+
+  m_workerpool.reset();
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
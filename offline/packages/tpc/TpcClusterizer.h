@@ -6,9 +6,12 @@
 #include <trackbase/TrkrCluster.h>
 #include <trackbase/TrkrDefs.h>
 
+#include <array>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 typedef std::map<TrkrDefs::hitsetkey, std::unordered_set<TrkrDefs::hitkey>> hitMaskTpcSet;
 
@@ -19,6 +22,7 @@ class TrkrHitSetContainer;
 class TrkrClusterContainer;
 class TrkrClusterHitAssoc;
 class TrainingHitsContainer;
+class PHWorkerPool;
 class PHG4TpcGeom;
 class PHG4TpcGeomContainer;
 class RawHitSetContainer;
@@ -30,7 +34,7 @@ public:
   typedef std::pair<unsigned short, iphiz> ihit;
 
   TpcClusterizer(const std::string &name = "TpcClusterizer");
-  ~TpcClusterizer() override = default;
+  ~TpcClusterizer() override;
 
   int InitRun(PHCompositeNode *topNode) override;
   int process_event(PHCompositeNode *topNode) override;
@@ -42,6 +46,8 @@ public:
   void set_do_hit_association(bool do_assoc) { do_hit_assoc = do_assoc; }
   void set_do_wedge_emulation(bool do_wedge) { do_wedge_emulation = do_wedge; }
   void set_do_sequential(bool do_seq) { do_sequential = do_seq; }
+  //! number of persistent worker threads processing the sectors. 0 (default) means one per hardware thread, 1 runs on the calling thread
+  void set_num_threads(unsigned int nthreads) { m_num_threads = nthreads; }
   void set_do_split(bool split) { do_split = split; }
   void set_fixed_window(int fixed) { do_fixed_window = fixed; }
   void set_pedestal(float val) { pedestal = val; }
@@ -137,6 +143,18 @@ public:
   bool m_maskFromFile {false};
   std::string m_deadChannelMapName; 
   std::string m_hotChannelMapName;
+
+  //! worker pool, created in InitRun and destroyed in End
+  unsigned int m_num_threads = 0;
+  std::unique_ptr<PHWorkerPool> m_workerpool;
+
+  //! timing statistics, indexed by side*12+sector, in ms
+  std::array<double, 24> m_sector_time{};
+  std::array<double, 24> m_sector_time_max{};
+  std::array<unsigned long, 24> m_sector_calls{};
+  std::vector<double> m_worker_busy_time;
+  double m_event_time = 0;
+  unsigned long m_nevents_timed = 0;
 };
 
 #endif
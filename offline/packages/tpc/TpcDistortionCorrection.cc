@@ -8,6 +8,8 @@
 #include "TpcDistortionCorrectionContainer.h"
 
 #include <TH1.h>
+
+#include <array>
 #include <cmath>
 
 #include <iostream>
@@ -82,8 +84,33 @@ Acts::Vector3 TpcDistortionCorrection::get_corrected_position(const Acts::Vector
   dr=0;
   dz=0;
   
-  //get the corrections from the histograms
-  if (dcc->m_dimensions == 3)
+  //get the corrections from the dense grid if any, from the histograms otherwise
+  const auto& grid = dcc->m_grid[index];
+  if (!grid.empty())
+  {
+    std::array<double, 3> corrections{};
+    if (grid.interpolate(phi, r, z, corrections))
+    {
+      double zterm = 1.0;
+      if (grid.dimensions() == 2 && dcc->m_interpolate_z)
+      {
+        zterm = (1. - std::abs(z) / 102.605);
+      }
+      if (mask & COORD_PHI)
+      {
+        dphi = corrections[0] * zterm / divisor;
+      }
+      if (mask & COORD_R)
+      {
+        dr = corrections[1] * zterm;
+      }
+      if (mask & COORD_Z)
+      {
+        dz = corrections[2] * zterm;
+      }
+    }
+  }
+  else if (dcc->m_dimensions == 3)
   {
     if (dcc->m_hDPint[index] && (mask & COORD_PHI) && check_boundaries(dcc->m_hDPint[index], phi, r, z))
     {
@@ -138,3 +165,12 @@ if(dcc->m_use_scalefactor)
 
   return {x_new, y_new, z_new};
 }
+
+//________________________________________________________
+void TpcDistortionCorrection::get_corrected_positions(std::vector<Acts::Vector3>& positions, const TpcDistortionCorrectionContainer* dcc, unsigned int mask) const
+{
+  for (auto& position : positions)
+  {
+    position = get_corrected_position(position, dcc, mask);
+  }
+}
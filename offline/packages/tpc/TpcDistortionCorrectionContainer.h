@@ -7,6 +7,8 @@
  * \author Hugo Pereira Da Costa <hugo.pereira-da-costa@cea.fr>
  */
 
+#include "TpcDistortionCorrectionGrid.h"
+
 #include <array>
 
 class TH1;
@@ -41,6 +43,14 @@ class TpcDistortionCorrectionContainer
    */
   std::array<TH1*, 2> m_hentries = {{nullptr, nullptr}};
   //@}
+
+  /// dense copy of the distortion histograms, one per side
+  /**
+   * used instead of the histograms to apply corrections when not empty.
+   * It is built when loading the corrections, and must be rebuilt, or cleared,
+   * if the histograms are changed afterwards
+   */
+  std::array<TpcDistortionCorrectionGrid, 2> m_grid;
 };
 
 #endif
@@ -0,0 +1,113 @@
+/*!
+ * \file TpcDistortionCorrectionGrid.cc
+ * \brief dense copy of the distortion correction histograms of one TPC side, for fast interpolation
+ */
+
+#include "TpcDistortionCorrectionGrid.h"
+
+#include <TAxis.h>
+#include <TH1.h>
+
+#include <iostream>
+
+//________________________________________________________
+TpcDistortionCorrectionGrid::Axis::Axis(const TAxis* axis)
+  : nbins(axis->GetNbins())
+  , min(axis->GetXmin())
+  , max(axis->GetXmax())
+  , width((max - min) / nbins)
+{
+}
+
+//________________________________________________________
+void TpcDistortionCorrectionGrid::clear()
+{
+  m_dimensions = 0;
+  m_axes = {};
+  std::vector<float>().swap(m_data);
+}
+
+//________________________________________________________
+bool TpcDistortionCorrectionGrid::build(const TH1* hdphi, const TH1* hdr, const TH1* hdz)
+{
+  clear();
+
+  const std::array<const TH1*, 3> histograms = {{hdphi, hdr, hdz}};
+
+  // reference histogram
+  const TH1* reference = nullptr;
+  for (const auto* h : histograms)
+  {
+    if (h)
+    {
+      reference = h;
+      break;
+    }
+  }
+
+  if (!reference || (reference->GetDimension() != 2 && reference->GetDimension() != 3))
+  {
+    return false;
+  }
+
+  const int dimensions = reference->GetDimension();
+  std::array<Axis, 3> axes;
+  for (int i = 0; i < dimensions; ++i)
+  {
+    const TAxis* axis = i == 0 ? reference->GetXaxis() : (i == 1 ? reference->GetYaxis() : reference->GetZaxis());
+    if (axis->IsVariableBinSize() || axis->GetNbins() < 1)
+    {
+      std::cout << "TpcDistortionCorrectionGrid::build - " << reference->GetName() << " has variable bin sizes" << std::endl;
+      return false;
+    }
+    axes[i] = Axis(axis);
+  }
+
+  // all histograms must have the same binning
+  for (const auto* h : histograms)
+  {
+    if (!h)
+    {
+      continue;
+    }
+    if (h->GetDimension() != dimensions ||
+        !(Axis(h->GetXaxis()) == axes[0]) ||
+        !(Axis(h->GetYaxis()) == axes[1]) ||
+        (dimensions == 3 && !(Axis(h->GetZaxis()) == axes[2])))
+    {
+      std::cout << "TpcDistortionCorrectionGrid::build - " << h->GetName() << " binning differs from " << reference->GetName() << std::endl;
+      return false;
+    }
+  }
+
+  // copy
+  const int nphi = axes[0].nbins;
+  const int nr = axes[1].nbins;
+  const int nz = axes[2].nbins;
+  std::vector<float> data(3 * nphi * nr * nz, 0);
+  for (int i = 0; i < 3; ++i)
+  {
+    const auto* h = histograms[i];
+    if (!h)
+    {
+      continue;
+    }
+
+    auto iter = data.begin() + i;
+    for (int iphi = 0; iphi < nphi; ++iphi)
+    {
+      for (int ir = 0; ir < nr; ++ir)
+      {
+        for (int iz = 0; iz < nz; ++iz, iter += 3)
+        {
+          *iter = dimensions == 3 ? h->GetBinContent(iphi + 1, ir + 1, iz + 1) : h->GetBinContent(iphi + 1, ir + 1);
+        }
+      }
+    }
+  }
+
+  m_dimensions = dimensions;
+  m_axes = axes;
+  m_data.swap(data);
+  return true;
+}
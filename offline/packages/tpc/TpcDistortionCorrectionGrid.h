@@ -0,0 +1,163 @@
+#ifndef TPC_TPCDISTORTIONCORRECTIONGRID_H
+#define TPC_TPCDISTORTIONCORRECTIONGRID_H
+
+/*!
+ * \file TpcDistortionCorrectionGrid.h
+ * \brief dense copy of the distortion correction histograms of one TPC side, for fast interpolation
+ */
+
+#include <array>
+#include <vector>
+
+class TAxis;
+class TH1;
+
+/**
+ * Stores the content of the phi, r and z distortion histograms of one TPC side
+ * in a single array, with the three corrections of a bin next to each other,
+ * so that one interpolation reads all three from the same 8 (3D) or 4 (2D) bins.
+ *
+ * Bin finding and interpolation follow TH3::Interpolate and TH2::Interpolate,
+ * including the rejection of positions in the first and last bin of any axis
+ * done in TpcDistortionCorrection. Corrected positions differ from the ones
+ * obtained from the histograms by less than 1e-13 cm, from the rounding of
+ * the bin width, and the same positions are rejected. Only histograms with fixed bin sizes and
+ * identical axes can be converted. The grid is a copy: it must be rebuilt if
+ * the histograms are modified.
+ */
+class TpcDistortionCorrectionGrid
+{
+ public:
+  //! constructor
+  TpcDistortionCorrectionGrid() = default;
+
+  /**
+   * copy the phi, r and z distortion histograms. Missing histograms give no correction.
+   * returns false, and leaves the grid empty, if the histograms cannot be converted
+   */
+  bool build(const TH1* hdphi, const TH1* hdr, const TH1* hdz);
+
+  //! clear
+  void clear();
+
+  //! true if the grid is not built
+  bool empty() const { return m_data.empty(); }
+
+  //! histogram dimensions
+  int dimensions() const { return m_dimensions; }
+
+  /**
+   * interpolated (dphi, dr, dz) corrections at a given position. z is ignored for 2D histograms.
+   * returns false if the position is outside of the interpolation range
+   */
+  bool interpolate(double phi, double r, double z, std::array<double, 3>& corrections) const
+  {
+    int iphi = 0;
+    int ir = 0;
+    double fphi = 0;
+    double fr = 0;
+    if (!m_axes[0].find(phi, iphi, fphi) || !m_axes[1].find(r, ir, fr))
+    {
+      return false;
+    }
+
+    if (m_dimensions == 2)
+    {
+      const float* v00 = &m_data[3 * (iphi * m_axes[1].nbins + ir)];
+      const float* v01 = v00 + 3;
+      const float* v10 = v00 + 3 * m_axes[1].nbins;
+      const float* v11 = v10 + 3;
+      for (int i = 0; i < 3; ++i)
+      {
+        const double w0 = v00[i] * (1 - fr) + v01[i] * fr;
+        const double w1 = v10[i] * (1 - fr) + v11[i] * fr;
+        corrections[i] = w0 * (1 - fphi) + w1 * fphi;
+      }
+      return true;
+    }
+
+    int iz = 0;
+    double fz = 0;
+    if (!m_axes[2].find(z, iz, fz))
+    {
+      return false;
+    }
+
+    // same order of operations as TH3::Interpolate
+    const int stride_r = 3 * m_axes[2].nbins;
+    const int stride_phi = stride_r * m_axes[1].nbins;
+    const float* v000 = &m_data[3 * ((iphi * m_axes[1].nbins + ir) * m_axes[2].nbins + iz)];
+    const float* v010 = v000 + stride_r;
+    const float* v100 = v000 + stride_phi;
+    const float* v110 = v100 + stride_r;
+    for (int i = 0; i < 3; ++i)
+    {
+      const double i1 = v000[i] * (1 - fz) + v000[i + 3] * fz;
+      const double i2 = v010[i] * (1 - fz) + v010[i + 3] * fz;
+      const double j1 = v100[i] * (1 - fz) + v100[i + 3] * fz;
+      const double j2 = v110[i] * (1 - fz) + v110[i + 3] * fz;
+      const double w1 = i1 * (1 - fr) + i2 * fr;
+      const double w2 = j1 * (1 - fr) + j2 * fr;
+      corrections[i] = w1 * (1 - fphi) + w2 * fphi;
+    }
+    return true;
+  }
+
+ private:
+  //! fixed size axis
+  class Axis
+  {
+   public:
+    Axis() = default;
+
+    explicit Axis(const TAxis*);
+
+    bool operator==(const Axis& other) const
+    {
+      return nbins == other.nbins && min == other.min && max == other.max;
+    }
+
+    /**
+     * lower interpolation bin, counted from zero, and fraction of the way to the next bin center.
+     * false if the value is in the underflow, overflow, first or last bin
+     */
+    bool find(double x, int& lower, double& fraction) const
+    {
+      // same as TAxis::FindFixBin
+      if (x < min || !(x < max))
+      {
+        return false;
+      }
+      int bin = 1 + static_cast<int>(nbins * (x - min) / (max - min));
+      if (bin < 2 || bin >= nbins)
+      {
+        return false;
+      }
+
+      // same as TAxis::GetBinCenter
+      if (x < min + (bin - 1) * width + 0.5 * width)
+      {
+        --bin;
+      }
+      lower = bin - 1;
+      fraction = (x - (min + (bin - 1) * width + 0.5 * width)) / width;
+      return true;
+    }
+
+    int nbins = 1;
+    double min = 0;
+    double max = 1;
+    double width = 1;
+  };
+
+  //! number of dimensions
+  int m_dimensions = 0;
+
+  //! phi, r and z axes
+  std::array<Axis, 3> m_axes;
+
+  //! dphi, dr and dz in each bin, phi major, z minor. Underflow and overflow bins are not stored
+  std::vector<float> m_data;
+};
+
+#endif
@@ -11,9 +11,14 @@
 
 #include <phool/getClass.h>
 #include <phool/PHCompositeNode.h>
+#include <phool/PHDataNode.h>
+#include <phool/PHNodeIterator.h>
 #include <trackbase/ActsGeometry.h>
 #include <trackbase/TpcDefs.h>
 #include <trackbase/TrkrCluster.h>
+#include <trackbase/TrkrClusterGlobalPositionCache.h>
+
+#include <climits>
 
 //____________________________________________________________________________________________________________________
 void TpcGlobalPositionWrapper::loadNodes( PHCompositeNode* topNode )
@@ -43,6 +48,19 @@ void TpcGlobalPositionWrapper::loadNodes( PHCompositeNode* topNode )
   {
     std::cout << "TpcGlobalPositionWrapper::loadNodes - found fluctuation TPC distortion correction container" << std::endl;
   }
+
+  // cluster position cache, shared by all modules. It is created on the DST node so that it gets reset at the end of each event
+  m_cache = findNode::getClass<TrkrClusterGlobalPositionCache>(topNode, "TRKR_CLUSTER_GLOBAL_POSITION_CACHE");
+  if (!m_cache)
+  {
+    PHNodeIterator iter(topNode);
+    auto dstNode = dynamic_cast<PHCompositeNode*>(iter.findFirst("PHCompositeNode", "DST"));
+    if (dstNode)
+    {
+      m_cache = new TrkrClusterGlobalPositionCache;
+      dstNode->addNode(new PHDataNode<PHObject>(m_cache, "TRKR_CLUSTER_GLOBAL_POSITION_CACHE", "PHObject"));
+    }
+  }
 }
 
 //____________________________________________________________________________________________________________________
@@ -72,8 +90,135 @@ Acts::Vector3 TpcGlobalPositionWrapper::applyDistortionCorrections(Acts::Vector3
   return global;
 }
 
+//____________________________________________________________________________________________________________________
+void TpcGlobalPositionWrapper::applyDistortionCorrections(std::vector<Acts::Vector3>& positions) const
+{
+  // apply distortion corrections
+  if (m_enable_module_edge_corr && m_dcc_module_edge)
+  {
+    m_distortionCorrection.get_corrected_positions(positions, m_dcc_module_edge);
+  }
+
+  if (m_enable_static_corr && m_dcc_static)
+  {
+    m_distortionCorrection.get_corrected_positions(positions, m_dcc_static);
+  }
+
+  if (m_enable_average_corr && m_dcc_average)
+  {
+    m_distortionCorrection.get_corrected_positions(positions, m_dcc_average);
+  }
+
+  if (m_enable_fluctuation_corr && m_dcc_fluctuation)
+  {
+    m_distortionCorrection.get_corrected_positions(positions, m_dcc_fluctuation);
+  }
+}
+
+//____________________________________________________________________________________________________________________
+uint8_t TpcGlobalPositionWrapper::correctionTag() const
+{
+  return (m_enable_module_edge_corr && m_dcc_module_edge) |
+         (m_enable_static_corr && m_dcc_static) << 1 |
+         (m_enable_average_corr && m_dcc_average) << 2 |
+         (m_enable_fluctuation_corr && m_dcc_fluctuation) << 3;
+}
+
 //____________________________________________________________________________________________________________________
 Acts::Vector3 TpcGlobalPositionWrapper::getGlobalPositionDistortionCorrected(const TrkrDefs::cluskey& key, TrkrCluster* cluster, short int crossing ) const
+{
+  if (!(m_use_cache && m_cache && m_tGeometry))
+  {
+    return computeGlobalPositionDistortionCorrected(key, cluster, crossing);
+  }
+
+  // only TPC positions depend on the crossing and on the distortion corrections
+  const bool is_tpc = TrkrDefs::getTrkrId(key) == TrkrDefs::TrkrId::tpcId;
+  if (is_tpc && crossing == SHRT_MAX)
+  {
+    return computeGlobalPositionDistortionCorrected(key, cluster, crossing);
+  }
+
+  const short int cache_crossing = is_tpc ? crossing : 0;
+  const uint8_t cache_tag = is_tpc ? correctionTag() : 0;
+  if (const auto* position = m_cache->find(key, cluster, cache_crossing, cache_tag))
+  {
+    return *position;
+  }
+
+  const auto global = computeGlobalPositionDistortionCorrected(key, cluster, crossing);
+  if (m_cache_read_only)
+  {
+    return global;
+  }
+  m_cache->insert(key, cluster, cache_crossing, cache_tag, global);
+  return global;
+}
+
+//____________________________________________________________________________________________________________________
+void TpcGlobalPositionWrapper::getGlobalPositionsDistortionCorrected(const ClusterList& clusters, short int crossing, std::vector<Acts::Vector3>& positions) const
+{
+  positions.resize(clusters.size());
+
+  // missing geometry and invalid crossing are reported by the single position method
+  if (!m_tGeometry || crossing == SHRT_MAX)
+  {
+    for (size_t i = 0; i < clusters.size(); ++i)
+    {
+      positions[i] = getGlobalPositionDistortionCorrected(clusters[i].first, clusters[i].second, crossing);
+    }
+    return;
+  }
+
+  const bool use_cache = m_use_cache && m_cache;
+  const uint8_t cache_tag = correctionTag();
+
+  // crossing corrected positions of the TPC clusters missing from the cache, and their index in the list
+  std::vector<Acts::Vector3> pending;
+  std::vector<size_t> pending_index;
+  pending.reserve(clusters.size());
+  pending_index.reserve(clusters.size());
+
+  for (size_t i = 0; i < clusters.size(); ++i)
+  {
+    const auto& [key, cluster] = clusters[i];
+    if (TrkrDefs::getTrkrId(key) != TrkrDefs::TrkrId::tpcId)
+    {
+      positions[i] = getGlobalPositionDistortionCorrected(key, cluster, crossing);
+      continue;
+    }
+
+    if (use_cache)
+    {
+      if (const auto* position = m_cache->find(key, cluster, crossing, cache_tag))
+      {
+        positions[i] = *position;
+        continue;
+      }
+    }
+
+    Acts::Vector3 global = m_tGeometry->getGlobalPosition(key, cluster);
+    global.z() = TpcClusterZCrossingCorrection::correctZ(global.z(), TpcDefs::getSide(key), crossing);
+    pending.push_back(global);
+    pending_index.push_back(i);
+  }
+
+  // apply distortion corrections
+  applyDistortionCorrections(pending);
+
+  for (size_t j = 0; j < pending.size(); ++j)
+  {
+    const auto i = pending_index[j];
+    positions[i] = pending[j];
+    if (use_cache && !m_cache_read_only)
+    {
+      m_cache->insert(clusters[i].first, clusters[i].second, crossing, cache_tag, pending[j]);
+    }
+  }
+}
+
+//____________________________________________________________________________________________________________________
+Acts::Vector3 TpcGlobalPositionWrapper::computeGlobalPositionDistortionCorrected(const TrkrDefs::cluskey& key, TrkrCluster* cluster, short int crossing ) const
 {
 
   if( !m_tGeometry )
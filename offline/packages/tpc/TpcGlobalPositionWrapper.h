@@ -10,11 +10,16 @@
 
 #include <trackbase/TrkrDefs.h>
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 
 class ActsGeometry;
 class PHCompositeNode;
 class TpcDistortionCorrectionContainer;
 class TrkrCluster;
+class TrkrClusterGlobalPositionCache;
 
 class TpcGlobalPositionWrapper
 {
@@ -48,9 +53,21 @@ class TpcGlobalPositionWrapper
   void set_enable_average_corr(bool flag) { m_enable_average_corr = flag; }
   void set_enable_fluctuation_corr(bool flag) { m_enable_fluctuation_corr = flag; }
 
+  //! use the per event cluster position cache shared between modules. True by default
+  /** must be disabled when positions are requested from several threads */
+  void set_use_cache(bool flag) { m_use_cache = flag; }
+
+  //! only read positions from the cache, without storing new ones
+  /** positions can then be requested from several threads, as long as no other wrapper updates the cache meanwhile */
+  void set_cache_read_only(bool flag) { m_cache_read_only = flag; }
+
   //! apply all loaded distortion corrections to a given position
   Acts::Vector3 applyDistortionCorrections( Acts::Vector3 /*source*/ ) const;
 
+  //! apply all loaded distortion corrections to a set of positions, in place
+  /** each correction is applied to all positions before the next one, which keeps its distortion map in cache */
+  void applyDistortionCorrections( std::vector<Acts::Vector3>& /*positions*/ ) const;
+
   //! get distortion corrected global position from cluster
   /**
    * first converts cluster position local coordinate to global coordinates
@@ -58,8 +75,24 @@ class TpcGlobalPositionWrapper
    */
   Acts::Vector3 getGlobalPositionDistortionCorrected(const TrkrDefs::cluskey&, TrkrCluster*, short int /*crossing*/ ) const;
 
+  //! list of clusters, typically from one hitset
+  using ClusterList = std::vector<std::pair<TrkrDefs::cluskey, TrkrCluster*>>;
+
+  //! get distortion corrected global positions of a list of clusters with the same crossing
+  /**
+   * same as getGlobalPositionDistortionCorrected, except that the distortion corrections
+   * of all TPC positions missing from the cache are applied at once
+   */
+  void getGlobalPositionsDistortionCorrected(const ClusterList& /*clusters*/, short int /*crossing*/, std::vector<Acts::Vector3>& /*positions*/ ) const;
+
   private:
 
+  //! same as getGlobalPositionDistortionCorrected, without the cache
+  Acts::Vector3 computeGlobalPositionDistortionCorrected(const TrkrDefs::cluskey&, TrkrCluster*, short int /*crossing*/ ) const;
+
+  //! identifies the set of distortion corrections applied, for the cache
+  uint8_t correctionTag() const;
+
   //! verbosity
   unsigned int m_verbosity = 0;
 
@@ -71,6 +104,11 @@ class TpcGlobalPositionWrapper
   //! acts geometry
   ActsGeometry* m_tGeometry = nullptr;
 
+  //! per event cluster position cache
+  TrkrClusterGlobalPositionCache* m_cache = nullptr;
+  bool m_use_cache = true;
+  bool m_cache_read_only = false;
+
   //! module edge distortion correction container
   TpcDistortionCorrectionContainer* m_dcc_module_edge{nullptr};
   bool m_enable_module_edge_corr = true;
@@ -119,6 +119,18 @@ int TpcLoadDistortionCorrection::InitRun(PHCompositeNode* topNode)
     distortion_correction_object->m_scalefactor = m_scalefactor[i];
 
 
+    // copy the histograms into dense grids for faster interpolation
+    for (int j = 0; j < 2; ++j)
+    {
+      if (!distortion_correction_object->m_grid[j].build(
+              distortion_correction_object->m_hDPint[j],
+              distortion_correction_object->m_hDRint[j],
+              distortion_correction_object->m_hDZint[j]))
+      {
+        std::cout << "TpcLoadDistortionCorrection::InitRun - cannot build grid for " << m_node_name[i] << ", using histograms" << std::endl;
+      }
+    }
+
     if (Verbosity())
     {
       for (const auto& h : {
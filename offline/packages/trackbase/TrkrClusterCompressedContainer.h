@@ -0,0 +1,49 @@
+/**
+ * @file trackbase/TrkrClusterCompressedContainer.h
+ * @brief Base class for clusters stored with compressed fields
+ */
+#ifndef TRACKBASE_TRKRCLUSTERCOMPRESSEDCONTAINER_H
+#define TRACKBASE_TRKRCLUSTERCOMPRESSEDCONTAINER_H
+
+#include <phool/PHObject.h>
+
+#include <cstddef>
+
+class TrkrClusterCompressionDict;
+class TrkrClusterContainer;
+
+/**
+ * @brief Base class for clusters stored with compressed fields
+ *
+ * Lossy DST representation of a TrkrClusterContainer. Positions and errors
+ * are stored as codes of a TrkrClusterCompressionDict, which is needed both
+ * to fill and to read the container. It is the on file content of TrkrClusterContainerv6.
+ */
+class TrkrClusterCompressedContainer : public PHObject
+{
+ public:
+  ~TrkrClusterCompressedContainer() override = default;
+
+  //! compress all the clusters of a container
+  virtual void compress(TrkrClusterContainer*, const TrkrClusterCompressionDict*) {}
+
+  //! add the decompressed clusters to a container
+  virtual void decompress(TrkrClusterContainer*, const TrkrClusterCompressionDict*) const {}
+
+  //! number of clusters
+  virtual unsigned int size() const { return 0; }
+
+  //! number of fields stored uncompressed
+  virtual unsigned int get_nescaped() const { return 0; }
+
+  //! size of the stored data, in bytes
+  virtual std::size_t get_data_size() const { return 0; }
+
+ protected:
+  TrkrClusterCompressedContainer() = default;
+
+ private:
+  ClassDefOverride(TrkrClusterCompressedContainer, 1);
+};
+
+#endif  // TRACKBASE_TRKRCLUSTERCOMPRESSEDCONTAINER_H
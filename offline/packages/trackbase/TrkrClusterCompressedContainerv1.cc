@@ -0,0 +1,144 @@
+/**
+ * @file trackbase/TrkrClusterCompressedContainerv1.cc
+ * @brief Implementation of TrkrClusterCompressedContainerv1
+ */
+
+#include "TrkrClusterCompressedContainerv1.h"
+
+#include "TrkrCluster.h"
+#include "TrkrClusterCompressionDict.h"
+#include "TrkrClusterContainer.h"
+#include "TrkrClusterContainerv5.h"
+#include "TrkrClusterv5.h"
+
+#include <array>
+#include <iterator>
+
+//_________________________________________________________________________
+void TrkrClusterCompressedContainerv1::Reset()
+{
+  // keep the capacity, the arrays are refilled with similar sizes every event
+  m_hitsetkeys.clear();
+  m_nclusters.clear();
+  m_clusindex.clear();
+  m_subsurfkeys.clear();
+  m_adc.clear();
+  m_maxadc.clear();
+  m_shape.clear();
+  m_codes.clear();
+  m_escaped.clear();
+}
+
+//_________________________________________________________________________
+void TrkrClusterCompressedContainerv1::identify(std::ostream& os) const
+{
+  os << "-----TrkrClusterCompressedContainerv1-----" << std::endl;
+  os << "Number of clusters: " << size() << std::endl;
+  os << "Number of uncompressed fields: " << get_nescaped() << std::endl;
+  os << "Data size: " << get_data_size() << " bytes" << std::endl;
+  os << "------------------------------" << std::endl;
+}
+
+//_________________________________________________________________________
+std::size_t TrkrClusterCompressedContainerv1::get_data_size() const
+{
+  return m_hitsetkeys.size() * sizeof(TrkrDefs::hitsetkey) +
+         (m_nclusters.size() + m_clusindex.size()) * sizeof(uint32_t) +
+         m_subsurfkeys.size() * sizeof(TrkrDefs::subsurfkey) +
+         (m_adc.size() + m_maxadc.size() + m_codes.size()) * sizeof(uint16_t) +
+         m_shape.size() * sizeof(char) +
+         m_escaped.size() * sizeof(float);
+}
+
+//_________________________________________________________________________
+void TrkrClusterCompressedContainerv1::compress(TrkrClusterContainer* clusters, const TrkrClusterCompressionDict* dict)
+{
+  Reset();
+
+  const auto nclusters = clusters->size();
+  m_clusindex.reserve(nclusters);
+  m_subsurfkeys.reserve(nclusters);
+  m_adc.reserve(nclusters);
+  m_maxadc.reserve(nclusters);
+  m_shape.reserve(4 * nclusters);
+  m_codes.reserve(TrkrClusterCompressionDict::NFields * nclusters);
+
+  for (const auto& hitsetkey : clusters->getHitSetKeys())
+  {
+    const auto trkrid = static_cast<TrkrDefs::TrkrId>(TrkrDefs::getTrkrId(hitsetkey));
+    const auto range = clusters->getClusters(hitsetkey);
+    if (range.first == range.second)
+    {
+      continue;
+    }
+
+    m_hitsetkeys.push_back(hitsetkey);
+    m_nclusters.push_back(std::distance(range.first, range.second));
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      const auto& [ckey, cluster] = *iter;
+      m_clusindex.push_back(TrkrDefs::getClusIndex(ckey));
+      m_subsurfkeys.push_back(cluster->getSubSurfKey());
+      m_adc.push_back(cluster->getAdc());
+      m_maxadc.push_back(cluster->getMaxAdc());
+      m_shape.push_back(static_cast<char>(cluster->getPhiSize()));
+      m_shape.push_back(static_cast<char>(cluster->getZSize()));
+      m_shape.push_back(cluster->getOverlap());
+      m_shape.push_back(cluster->getEdge());
+
+      const std::array<float, TrkrClusterCompressionDict::NFields> values = {
+          cluster->getLocalX(), cluster->getLocalY(), cluster->getRPhiError(), cluster->getZError()};
+      for (unsigned int field = 0; field < values.size(); ++field)
+      {
+        const auto code = dict->encode(trkrid, static_cast<TrkrClusterCompressionDict::Field>(field), values[field]);
+        m_codes.push_back(code);
+        if (code == TrkrClusterCompressionDict::kEscape)
+        {
+          m_escaped.push_back(values[field]);
+        }
+      }
+    }
+  }
+}
+
+//_________________________________________________________________________
+void TrkrClusterCompressedContainerv1::decompress(TrkrClusterContainer* clusters, const TrkrClusterCompressionDict* dict) const
+{
+  // TrkrClusterContainerv5 provides the clusters from its arena
+  auto* arena_clusters = dynamic_cast<TrkrClusterContainerv5*>(clusters);
+
+  auto escaped = m_escaped.begin();
+  std::size_t i = 0;
+  for (std::size_t ihitset = 0; ihitset < m_hitsetkeys.size(); ++ihitset)
+  {
+    const auto hitsetkey = m_hitsetkeys[ihitset];
+    const auto trkrid = static_cast<TrkrDefs::TrkrId>(TrkrDefs::getTrkrId(hitsetkey));
+    for (const auto last = i + m_nclusters[ihitset]; i < last; ++i)
+    {
+      std::array<float, TrkrClusterCompressionDict::NFields> values{};
+      for (unsigned int field = 0; field < values.size(); ++field)
+      {
+        const auto code = m_codes[i * TrkrClusterCompressionDict::NFields + field];
+        values[field] = (code == TrkrClusterCompressionDict::kEscape) ? *escaped++ : dict->decode(trkrid, static_cast<TrkrClusterCompressionDict::Field>(field), code);
+      }
+
+      const auto key = TrkrDefs::genClusKey(hitsetkey, m_clusindex[i]);
+      auto* cluster = arena_clusters ? arena_clusters->newClusterSpecifyKey(key) : new TrkrClusterv5;
+      cluster->setLocalX(values[TrkrClusterCompressionDict::LocalX]);
+      cluster->setLocalY(values[TrkrClusterCompressionDict::LocalY]);
+      cluster->setPhiError(values[TrkrClusterCompressionDict::RPhiError]);
+      cluster->setZError(values[TrkrClusterCompressionDict::ZError]);
+      cluster->setSubSurfKey(m_subsurfkeys[i]);
+      cluster->setAdc(m_adc[i]);
+      cluster->setMaxAdc(m_maxadc[i]);
+      cluster->setPhiSize(m_shape[4 * i]);
+      cluster->setZSize(m_shape[4 * i + 1]);
+      cluster->setOverlap(m_shape[4 * i + 2]);
+      cluster->setEdge(m_shape[4 * i + 3]);
+      if (!arena_clusters)
+      {
+        clusters->addClusterSpecifyKey(key, cluster);
+      }
+    }
+  }
+}
@@ -0,0 +1,66 @@
+/**
+ * @file trackbase/TrkrClusterCompressedContainerv1.h
+ * @brief Version 1 of clusters stored with compressed fields
+ */
+#ifndef TRACKBASE_TRKRCLUSTERCOMPRESSEDCONTAINERV1_H
+#define TRACKBASE_TRKRCLUSTERCOMPRESSEDCONTAINERV1_H
+
+#include "TrkrClusterCompressedContainer.h"
+#include "TrkrDefs.h"
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief Version 1 of clusters stored with compressed fields
+ *
+ * Clusters are stored as flat arrays, one entry per cluster, grouped by
+ * hitset, and decompress to TrkrClusterv5. Local positions and errors are
+ * 16 bit dictionary codes. Fields with an escape code are stored
+ * uncompressed, in cluster order.
+ */
+class TrkrClusterCompressedContainerv1 : public TrkrClusterCompressedContainer
+{
+ public:
+  TrkrClusterCompressedContainerv1() = default;
+
+  void Reset() override;
+
+  void identify(std::ostream& os = std::cout) const override;
+
+  void compress(TrkrClusterContainer*, const TrkrClusterCompressionDict*) override;
+
+  void decompress(TrkrClusterContainer*, const TrkrClusterCompressionDict*) const override;
+
+  unsigned int size() const override { return m_clusindex.size(); }
+
+  unsigned int get_nescaped() const override { return m_escaped.size(); }
+
+  std::size_t get_data_size() const override;
+
+ private:
+  //! hitset keys, and number of clusters in each hitset
+  std::vector<TrkrDefs::hitsetkey> m_hitsetkeys;
+  std::vector<uint32_t> m_nclusters;
+
+  //! cluster index in its hitset, see TrkrDefs::getClusIndex
+  std::vector<uint32_t> m_clusindex;
+
+  std::vector<TrkrDefs::subsurfkey> m_subsurfkeys;
+  std::vector<uint16_t> m_adc;
+  std::vector<uint16_t> m_maxadc;
+
+  //! phi size, z size, overlap and edge of each cluster
+  std::vector<char> m_shape;
+
+  //! TrkrClusterCompressionDict::NFields codes per cluster
+  std::vector<uint16_t> m_codes;
+
+  //! values of the fields with an escape code
+  std::vector<float> m_escaped;
+
+  ClassDefOverride(TrkrClusterCompressedContainerv1, 1);
+};
+
+#endif  // TRACKBASE_TRKRCLUSTERCOMPRESSEDCONTAINERV1_H
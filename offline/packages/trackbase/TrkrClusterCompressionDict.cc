@@ -0,0 +1,40 @@
+/**
+ * @file trackbase/TrkrClusterCompressionDict.cc
+ * @brief Implementation of TrkrClusterCompressionDict
+ */
+
+#include "TrkrClusterCompressionDict.h"
+
+#include <algorithm>
+
+namespace
+{
+  //! dictionaries in memory, in creation order
+  std::vector<const TrkrClusterCompressionDict*>& registry()
+  {
+    static std::vector<const TrkrClusterCompressionDict*> dicts;
+    return dicts;
+  }
+}  // namespace
+
+//_________________________________________________________________________
+TrkrClusterCompressionDict::TrkrClusterCompressionDict()
+{
+  registry().push_back(this);
+}
+
+//_________________________________________________________________________
+TrkrClusterCompressionDict::~TrkrClusterCompressionDict()
+{
+  auto& dicts = registry();
+  dicts.erase(std::remove(dicts.begin(), dicts.end(), this), dicts.end());
+}
+
+//_________________________________________________________________________
+const TrkrClusterCompressionDict* TrkrClusterCompressionDict::get_current()
+{
+  const auto& dicts = registry();
+  const auto iter = std::find_if(dicts.rbegin(), dicts.rend(), [](const TrkrClusterCompressionDict* dict)
+                                 { return dict->isValid(); });
+  return iter == dicts.rend() ? nullptr : *iter;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file trackbase/TrkrClusterCompressionDict.h
+ * @brief Base class for the dictionaries used to store cluster fields as 16 bit codes
+ */
+#ifndef TRACKBASE_TRKRCLUSTERCOMPRESSIONDICT_H
+#define TRACKBASE_TRKRCLUSTERCOMPRESSIONDICT_H
+
+#include "TrkrDefs.h"
+
+#include <phool/PHObject.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Base class for the dictionaries used to store cluster fields as 16 bit codes
+ *
+ * One dictionary is kept per detector and per compressed field. A value is
+ * replaced by the code of the closest dictionary entry, provided it is
+ * within the maximum absolute error of the field. Values with no such entry
+ * get the escape code and must be stored uncompressed.
+ *
+ * The dictionaries of each detector are built once per run and stored on the RUN node.
+ * Dictionaries register themselves on creation, so that clusters read from a DST can
+ * find the dictionary read from the RUN node of the same file, see get_current.
+ */
+class TrkrClusterCompressionDict : public PHObject
+{
+ public:
+  //! compressed cluster fields
+  enum Field
+  {
+    LocalX = 0,
+    LocalY,
+    RPhiError,
+    ZError,
+    NFields
+  };
+
+  //! number of detectors
+  static constexpr unsigned int NDetectors = TrkrDefs::micromegasId + 1;
+
+  //! code of the values stored uncompressed
+  static constexpr uint16_t kEscape = 0xFFFF;
+
+  ~TrkrClusterCompressionDict() override;
+
+  /**
+   * @brief the most recently created valid dictionary, nullptr if none.
+   * When reading a DST this is the dictionary of the RUN node of the current file
+   */
+  static const TrkrClusterCompressionDict* get_current();
+
+  /**
+   * @brief set the dictionary of a field
+   * @param[in] entries sorted dictionary entries, at most kEscape
+   * @param[in] max_error maximum absolute difference between a value and its compressed value
+   */
+  virtual void set_dict(TrkrDefs::TrkrId, Field, const std::vector<float>& /*entries*/, float /*max_error*/) {}
+
+  //! maximum absolute error of a field
+  virtual float get_max_error(TrkrDefs::TrkrId, Field) const { return 0; }
+
+  //! number of entries in the dictionary of a field
+  virtual std::size_t get_size(TrkrDefs::TrkrId, Field) const { return 0; }
+
+  //! code of a value. kEscape if no entry is within the maximum error
+  virtual uint16_t encode(TrkrDefs::TrkrId, Field, float) const { return kEscape; }
+
+  //! value of a code
+  virtual float decode(TrkrDefs::TrkrId, Field, uint16_t) const { return NAN; }
+
+ protected:
+  TrkrClusterCompressionDict();
+
+ private:
+  ClassDefOverride(TrkrClusterCompressionDict, 1);
+};
+
+#endif  // TRACKBASE_TRKRCLUSTERCOMPRESSIONDICT_H
@@ -0,0 +1,107 @@
+/**
+ * @file trackbase/TrkrClusterCompressionDictv1.cc
+ * @brief Implementation of TrkrClusterCompressionDictv1
+ */
+
+#include "TrkrClusterCompressionDictv1.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+TrkrClusterCompressionDictv1::TrkrClusterCompressionDictv1()
+  : m_dict(NDetectors * NFields)
+  , m_max_error(NDetectors * NFields, 0)
+{
+}
+
+//_________________________________________________________________________
+void TrkrClusterCompressionDictv1::Reset()
+{
+  for (auto& dict : m_dict)
+  {
+    std::vector<float>().swap(dict);
+  }
+  std::fill(m_max_error.begin(), m_max_error.end(), 0);
+}
+
+//_________________________________________________________________________
+void TrkrClusterCompressionDictv1::identify(std::ostream& os) const
+{
+  os << "-----TrkrClusterCompressionDictv1-----" << std::endl;
+  for (unsigned int trkrid = 0; trkrid < NDetectors; ++trkrid)
+  {
+    for (unsigned int field = 0; field < NFields; ++field)
+    {
+      const auto& dict = m_dict[trkrid * NFields + field];
+      os << "detector " << trkrid << " field " << field
+         << " entries: " << dict.size()
+         << " max error: " << m_max_error[trkrid * NFields + field];
+      if (!dict.empty())
+      {
+        os << " range: [" << dict.front() << ", " << dict.back() << "]";
+      }
+      os << std::endl;
+    }
+  }
+  os << "------------------------------" << std::endl;
+}
+
+//_________________________________________________________________________
+int TrkrClusterCompressionDictv1::isValid() const
+{
+  return std::any_of(m_dict.begin(), m_dict.end(), [](const std::vector<float>& dict)
+                     { return !dict.empty(); });
+}
+
+//_________________________________________________________________________
+void TrkrClusterCompressionDictv1::set_dict(TrkrDefs::TrkrId trkrid, Field field, const std::vector<float>& entries, float max_error)
+{
+  auto& dict = m_dict[index(trkrid, field)];
+  dict.assign(entries.begin(), entries.begin() + std::min<std::size_t>(entries.size(), kEscape));
+  m_max_error[index(trkrid, field)] = max_error;
+}
+
+//_________________________________________________________________________
+uint16_t TrkrClusterCompressionDictv1::encode(TrkrDefs::TrkrId trkrid, Field field, float value) const
+{
+  if (trkrid >= NDetectors || std::isnan(value))
+  {
+    return kEscape;
+  }
+
+  const auto& dict = m_dict[index(trkrid, field)];
+  if (dict.empty())
+  {
+    return kEscape;
+  }
+
+  // closest entry
+  auto iter = std::lower_bound(dict.begin(), dict.end(), value);
+  if (iter == dict.end() || (iter != dict.begin() && value - *std::prev(iter) < *iter - value))
+  {
+    --iter;
+  }
+
+  if (std::abs(*iter - value) > m_max_error[index(trkrid, field)])
+  {
+    return kEscape;
+  }
+  return static_cast<uint16_t>(iter - dict.begin());
+}
+
+//_________________________________________________________________________
+float TrkrClusterCompressionDictv1::decode(TrkrDefs::TrkrId trkrid, Field field, uint16_t code) const
+{
+  if (trkrid >= NDetectors || field >= NFields)
+  {
+    return NAN;
+  }
+
+  const auto& dict = m_dict[index(trkrid, field)];
+  if (code >= dict.size())
+  {
+    return NAN;
+  }
+  return dict[code];
+}
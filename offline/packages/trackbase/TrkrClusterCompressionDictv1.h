@@ -0,0 +1,63 @@
+/**
+ * @file trackbase/TrkrClusterCompressionDictv1.h
+ * @brief Version 1 of the cluster compression dictionaries
+ */
+#ifndef TRACKBASE_TRKRCLUSTERCOMPRESSIONDICTV1_H
+#define TRACKBASE_TRKRCLUSTERCOMPRESSIONDICTV1_H
+
+#include "TrkrClusterCompressionDict.h"
+
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief Version 1 of the cluster compression dictionaries
+ *
+ * Dictionaries are sorted arrays of values, encoding is a binary search for
+ * the closest entry. The entries are set by the producer, see TrkrClusterCompressor.
+ */
+class TrkrClusterCompressionDictv1 : public TrkrClusterCompressionDict
+{
+ public:
+  TrkrClusterCompressionDictv1();
+
+  void Reset() override;
+
+  void identify(std::ostream& os = std::cout) const override;
+
+  //! true once at least one dictionary is built
+  int isValid() const override;
+
+  void set_dict(TrkrDefs::TrkrId, Field, const std::vector<float>& entries, float max_error) override;
+
+  float get_max_error(TrkrDefs::TrkrId trkrid, Field field) const override
+  {
+    return m_max_error[index(trkrid, field)];
+  }
+
+  std::size_t get_size(TrkrDefs::TrkrId trkrid, Field field) const override
+  {
+    return m_dict[index(trkrid, field)].size();
+  }
+
+  uint16_t encode(TrkrDefs::TrkrId, Field, float) const override;
+
+  //! value of a code. NAN for codes out of the dictionary, e.g. from a mismatched dictionary
+  float decode(TrkrDefs::TrkrId, Field, uint16_t) const override;
+
+ private:
+  static unsigned int index(TrkrDefs::TrkrId trkrid, Field field)
+  {
+    return trkrid * NFields + field;
+  }
+
+  //! sorted dictionary entries, per detector and field
+  std::vector<std::vector<float>> m_dict;
+
+  //! maximum absolute error, per detector and field
+  std::vector<float> m_max_error;
+
+  ClassDefOverride(TrkrClusterCompressionDictv1, 1);
+};
+
+#endif  // TRACKBASE_TRKRCLUSTERCOMPRESSIONDICTV1_H
@@ -8,6 +8,7 @@
 namespace
 {
   TrkrClusterContainer::Map dummy_map;
+  const TrkrClusterContainer::HitSetKeyList dummy_keys;
 }
 
 //__________________________________________________________
@@ -21,3 +22,9 @@ TrkrClusterContainer::ConstRange TrkrClusterContainer::getClusters(TrkrDefs::hit
 {
   return std::make_pair(dummy_map.cbegin(), dummy_map.cend());
 }
+
+//__________________________________________________________
+const TrkrClusterContainer::HitSetKeyList& TrkrClusterContainer::getHitSetKeys() const
+{
+  return dummy_keys;
+}
@@ -14,6 +14,7 @@
 
 #include <iostream>  // for cout, ostream
 #include <map>
+#include <vector>
 #include <utility>  // for pair
 
 class TrkrCluster;
@@ -61,11 +62,8 @@ class TrkrClusterContainer : public PHObject
   //! find cluster matching given key
   virtual TrkrCluster* findCluster(TrkrDefs::cluskey) const { return nullptr; }
 
-  //! get hitset key list
-  virtual HitSetKeyList getHitSetKeys() const
-  {
-    return HitSetKeyList();
-  }
+  //! get hitset key list, sorted. The reference is valid until the container is next modified
+  virtual const HitSetKeyList& getHitSetKeys() const;
 
   //! get hitset key list for a given detector
   virtual HitSetKeyList getHitSetKeys(const TrkrDefs::TrkrId) const
@@ -127,15 +127,14 @@ TrkrCluster* TrkrClusterContainerv3::findCluster(TrkrDefs::cluskey key) const
 }
 
 //_________________________________________________________________
-TrkrClusterContainer::HitSetKeyList TrkrClusterContainerv3::getHitSetKeys() const
+const TrkrClusterContainer::HitSetKeyList& TrkrClusterContainerv3::getHitSetKeys() const
 {
-  HitSetKeyList out;
-  out.reserve(m_clusmap.size());
+  m_hitsetkeys.clear();
   std::transform(
-      m_clusmap.begin(), m_clusmap.end(), std::back_inserter(out),
+      m_clusmap.begin(), m_clusmap.end(), std::back_inserter(m_hitsetkeys),
       [](const std::pair<TrkrDefs::hitsetkey, Map>& pair)
       { return pair.first; });
-  return out;
+  return m_hitsetkeys;
 }
 
 //_________________________________________________________________
@@ -34,7 +34,7 @@ class TrkrClusterContainerv3 : public TrkrClusterContainer
 
   TrkrCluster* findCluster(TrkrDefs::cluskey) const override;
 
-  HitSetKeyList getHitSetKeys() const override;
+  const HitSetKeyList& getHitSetKeys() const override;
 
   HitSetKeyList getHitSetKeys(const TrkrDefs::TrkrId) const override;
 
@@ -45,6 +45,9 @@ class TrkrClusterContainerv3 : public TrkrClusterContainer
  private:
   std::map<TrkrDefs::hitsetkey, Map> m_clusmap;
 
+  /// hitset keys returned by getHitSetKeys, refreshed at each call
+  mutable HitSetKeyList m_hitsetkeys;  //!
+
   ClassDefOverride(TrkrClusterContainerv3, 1)
 };
 
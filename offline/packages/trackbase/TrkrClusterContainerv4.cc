@@ -224,15 +224,14 @@ TrkrCluster* TrkrClusterContainerv4::findCluster(TrkrDefs::cluskey key) const
 }
 
 //_________________________________________________________________
-TrkrClusterContainer::HitSetKeyList TrkrClusterContainerv4::getHitSetKeys() const
+const TrkrClusterContainer::HitSetKeyList& TrkrClusterContainerv4::getHitSetKeys() const
 {
-  HitSetKeyList out;
-  out.reserve(m_clusmap.size());
+  m_hitsetkeys.clear();
   std::transform(
-      m_clusmap.begin(), m_clusmap.end(), std::back_inserter(out),
+      m_clusmap.begin(), m_clusmap.end(), std::back_inserter(m_hitsetkeys),
       [](const std::pair<TrkrDefs::hitsetkey, Vector>& pair)
       { return pair.first; });
-  return out;
+  return m_hitsetkeys;
 }
 
 //_________________________________________________________________
@@ -44,7 +44,7 @@ class TrkrClusterContainerv4 : public TrkrClusterContainer
 
   TrkrCluster* findCluster(TrkrDefs::cluskey) const override;
 
-  HitSetKeyList getHitSetKeys() const override;
+  const HitSetKeyList& getHitSetKeys() const override;
 
   HitSetKeyList getHitSetKeys(const TrkrDefs::TrkrId) const override;
 
@@ -59,6 +59,9 @@ class TrkrClusterContainerv4 : public TrkrClusterContainer
   /// the actual container
   std::map<TrkrDefs::hitsetkey, Vector> m_clusmap;
 
+  /// hitset keys returned by getHitSetKeys, refreshed at each call
+  mutable HitSetKeyList m_hitsetkeys;  //!
+
   /// temporary map
   /**
    * the map is transient. It must not be written to the output.
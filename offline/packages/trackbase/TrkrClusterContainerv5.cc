@@ -0,0 +1,513 @@
+/**
+ * @file trackbase/TrkrClusterContainerv5.cc
+ * @brief Implementation of TrkrClusterContainerv5
+ */
+#include "TrkrClusterContainerv5.h"
+#include "TrkrCluster.h"
+#include "TrkrDefs.h"
+
+#include <TBuffer.h>
+
+#include <algorithm>
+#include <cstdlib>  // for exit
+
+namespace
+{
+  TrkrClusterContainer::Map dummy_map;
+
+  // minimum size of the hitsetkey hash table
+  constexpr std::size_t min_index_size = 1024;
+
+  // hitsetkey hash. Fibonacci hashing spreads the packed detector/layer/ladder bits over the table
+  inline std::size_t hash(TrkrDefs::hitsetkey key, std::size_t mask)
+  {
+    return (static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL >> 32U) & mask;
+  }
+}  // namespace
+
+//_________________________________________________________________
+TrkrClusterContainerv5::~TrkrClusterContainerv5()
+{
+  delete_adopted();
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::delete_adopted()
+{
+  for (std::size_t i = 0; i < m_nblocks; ++i)
+  {
+    const auto& block = m_blocks[i];
+    for (std::size_t index = 0; index < block.clusters.size(); ++index)
+    {
+      if (block.adopted[index])
+      {
+        delete block.clusters[index];
+      }
+    }
+  }
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::Reset()
+{
+  delete_adopted();
+
+  // empty blocks, keeping the cluster vectors capacity
+  for (std::size_t i = 0; i < m_nblocks; ++i)
+  {
+    m_blocks[i].hitsetkey = TrkrDefs::HITSETKEYMAX;
+    m_blocks[i].clusters.clear();
+    m_blocks[i].adopted.clear();
+  }
+  m_nblocks = 0;
+  m_hitsetkeys.clear();
+  std::fill(m_index_keys.begin(), m_index_keys.end(), TrkrDefs::HITSETKEYMAX);
+
+  // arena clusters are overwritten when handed out again
+  m_arena_used = 0;
+  m_size = 0;
+
+  m_tmpmap.clear();
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::identify(std::ostream& os) const
+{
+  os << "-----TrkrClusterContainerv5-----" << std::endl;
+  os << "Number of clusters: " << size() << " arena size: " << m_arena.size() << std::endl;
+
+  for (const auto& hitsetkey : getHitSetKeys())
+  {
+    const unsigned int layer = TrkrDefs::getLayer(hitsetkey);
+    os << "layer: " << layer << " hitsetkey: " << hitsetkey << std::endl;
+
+    for (const auto& cluster : m_blocks[find_block(hitsetkey)].clusters)
+    {
+      if (cluster)
+      {
+        cluster->identify(os);
+      }
+    }
+  }
+
+  os << "------------------------------" << std::endl;
+}
+
+//_________________________________________________________________
+int TrkrClusterContainerv5::find_block(TrkrDefs::hitsetkey hitsetkey) const
+{
+  if (m_index_keys.empty())
+  {
+    return -1;
+  }
+
+  const std::size_t mask = m_index_keys.size() - 1;
+  for (std::size_t slot = hash(hitsetkey, mask);; slot = (slot + 1) & mask)
+  {
+    if (m_index_keys[slot] == hitsetkey)
+    {
+      return m_index_blocks[slot];
+    }
+    else if (m_index_keys[slot] == TrkrDefs::HITSETKEYMAX)
+    {
+      return -1;
+    }
+  }
+}
+
+//_________________________________________________________________
+TrkrClusterContainerv5::HitSetBlock& TrkrClusterContainerv5::find_or_add_block(TrkrDefs::hitsetkey hitsetkey)
+{
+  // keep the table at most half full
+  if (2 * (m_nblocks + 1) > m_index_keys.size())
+  {
+    rehash(std::max(min_index_size, 2 * m_index_keys.size()));
+  }
+
+  const std::size_t mask = m_index_keys.size() - 1;
+  std::size_t slot = hash(hitsetkey, mask);
+  for (; m_index_keys[slot] != TrkrDefs::HITSETKEYMAX; slot = (slot + 1) & mask)
+  {
+    if (m_index_keys[slot] == hitsetkey)
+    {
+      return m_blocks[m_index_blocks[slot]];
+    }
+  }
+
+  // new block, reusing a previously allocated one if any
+  if (m_nblocks == m_blocks.size())
+  {
+    m_blocks.emplace_back();
+  }
+  m_index_keys[slot] = hitsetkey;
+  m_index_blocks[slot] = m_nblocks;
+
+  auto& block = m_blocks[m_nblocks++];
+  block.hitsetkey = hitsetkey;
+  return block;
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::rehash(std::size_t size)
+{
+  m_index_keys.assign(size, TrkrDefs::HITSETKEYMAX);
+  m_index_blocks.assign(size, 0);
+
+  const std::size_t mask = size - 1;
+  for (std::size_t i = 0; i < m_nblocks; ++i)
+  {
+    std::size_t slot = hash(m_blocks[i].hitsetkey, mask);
+    while (m_index_keys[slot] != TrkrDefs::HITSETKEYMAX)
+    {
+      slot = (slot + 1) & mask;
+    }
+    m_index_keys[slot] = m_blocks[i].hitsetkey;
+    m_index_blocks[slot] = i;
+  }
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::list_hitset(TrkrDefs::hitsetkey hitsetkey)
+{
+  // hitsets are mostly filled in key order, in which case the key goes at the end
+  if (m_hitsetkeys.empty() || m_hitsetkeys.back() < hitsetkey)
+  {
+    m_hitsetkeys.push_back(hitsetkey);
+    return;
+  }
+  const auto iter = std::lower_bound(m_hitsetkeys.begin(), m_hitsetkeys.end(), hitsetkey);
+  if (*iter != hitsetkey)
+  {
+    m_hitsetkeys.insert(iter, hitsetkey);
+  }
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::unlist_hitset(TrkrDefs::hitsetkey hitsetkey)
+{
+  const auto iter = std::lower_bound(m_hitsetkeys.begin(), m_hitsetkeys.end(), hitsetkey);
+  if (iter != m_hitsetkeys.end() && *iter == hitsetkey)
+  {
+    m_hitsetkeys.erase(iter);
+  }
+}
+
+//_________________________________________________________________
+TrkrClusterv5* TrkrClusterContainerv5::allocate_cluster()
+{
+  if (m_arena_used == m_arena.size())
+  {
+    m_arena.emplace_back();
+  }
+  return &m_arena[m_arena_used++];
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::release_cluster(HitSetBlock& block, unsigned int index)
+{
+  // arena clusters are only released at Reset, adopted clusters are deleted right away
+  if (block.adopted[index])
+  {
+    delete block.clusters[index];
+    block.adopted[index] = false;
+  }
+  block.clusters[index] = nullptr;
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::removeCluster(TrkrDefs::cluskey key)
+{
+  const int iblock = find_block(TrkrDefs::getHitSetKeyFromClusKey(key));
+  if (iblock < 0)
+  {
+    return;
+  }
+
+  auto& block = m_blocks[iblock];
+  const auto index = TrkrDefs::getClusIndex(key);
+  if (index < block.clusters.size() && block.clusters[index])
+  {
+    release_cluster(block, index);
+    --m_size;
+  }
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::removeClusters(TrkrDefs::hitsetkey hitsetkey)
+{
+  const int iblock = find_block(hitsetkey);
+  if (iblock < 0)
+  {
+    return;
+  }
+
+  // the block itself stays in the index until Reset, but is no longer listed in getHitSetKeys
+  auto& block = m_blocks[iblock];
+  for (unsigned int index = 0; index < block.clusters.size(); ++index)
+  {
+    if (block.clusters[index])
+    {
+      release_cluster(block, index);
+      --m_size;
+    }
+  }
+  block.clusters.clear();
+  block.adopted.clear();
+  unlist_hitset(hitsetkey);
+}
+
+//_________________________________________________________________
+TrkrClusterContainerv5::HitSetBlock& TrkrClusterContainerv5::add_slot(TrkrDefs::cluskey key)
+{
+  auto& block = find_or_add_block(TrkrDefs::getHitSetKeyFromClusKey(key));
+  if (block.clusters.empty())
+  {
+    list_hitset(block.hitsetkey);
+  }
+
+  const auto index = TrkrDefs::getClusIndex(key);
+  if (index >= block.clusters.size())
+  {
+    block.clusters.resize(index + 1, nullptr);
+    block.adopted.resize(index + 1, false);
+  }
+  else if (block.clusters[index])
+  {
+    std::cout << "TrkrClusterContainerv5::AddClusterSpecifyKey: duplicate key: " << key << " exiting now" << std::endl;
+    exit(1);
+  }
+
+  ++m_size;
+  return block;
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::addClusterSpecifyKey(const TrkrDefs::cluskey key, TrkrCluster* newclus)
+{
+  auto& block = add_slot(key);
+  const auto index = TrkrDefs::getClusIndex(key);
+  block.clusters[index] = newclus;
+  block.adopted[index] = true;
+}
+
+//_________________________________________________________________
+TrkrClusterv5* TrkrClusterContainerv5::newClusterSpecifyKey(const TrkrDefs::cluskey key)
+{
+  auto& block = add_slot(key);
+  auto* cluster = allocate_cluster();
+
+  // arena clusters keep the values of the previous event
+  *cluster = TrkrClusterv5();
+  block.clusters[TrkrDefs::getClusIndex(key)] = cluster;
+  return cluster;
+}
+
+//_________________________________________________________________
+TrkrClusterContainerv5::ConstRange
+TrkrClusterContainerv5::getClusters() const
+{
+  std::cout << "deprecated function in TrkrClusterContainerv5, user getClusters(TrkrDefs:hitsetkey)"
+            << std::endl;
+  return std::make_pair(dummy_map.begin(), dummy_map.begin());
+}
+
+//_________________________________________________________________
+TrkrClusterContainerv5::ConstRange
+TrkrClusterContainerv5::getClusters(TrkrDefs::hitsetkey hitsetkey)
+{
+  m_tmpmap.clear();
+
+  const int iblock = find_block(hitsetkey);
+  if (iblock >= 0)
+  {
+    // copy content in temporary map. Keys are increasing, so that every insertion happens at the end
+    const auto& clusters = m_blocks[iblock].clusters;
+    for (size_t index = 0; index < clusters.size(); ++index)
+    {
+      if (clusters[index])
+      {
+        m_tmpmap.emplace_hint(m_tmpmap.end(), TrkrDefs::genClusKey(hitsetkey, index), clusters[index]);
+      }
+    }
+  }
+
+  return std::make_pair(m_tmpmap.cbegin(), m_tmpmap.cend());
+}
+
+//_________________________________________________________________
+TrkrCluster* TrkrClusterContainerv5::findCluster(TrkrDefs::cluskey key) const
+{
+  const int iblock = find_block(TrkrDefs::getHitSetKeyFromClusKey(key));
+  if (iblock < 0)
+  {
+    return nullptr;
+  }
+
+  const auto& clus_vector = m_blocks[iblock].clusters;
+  const auto index = TrkrDefs::getClusIndex(key);
+  return index < clus_vector.size() ? clus_vector[index] : nullptr;
+}
+
+//_________________________________________________________________
+const TrkrClusterContainer::HitSetKeyList& TrkrClusterContainerv5::getHitSetKeys() const
+{
+  return m_hitsetkeys;
+}
+
+//_________________________________________________________________
+TrkrClusterContainer::HitSetKeyList TrkrClusterContainerv5::get_hitset_keys(TrkrDefs::hitsetkey keylo, TrkrDefs::hitsetkey keyhi) const
+{
+  const auto begin = std::lower_bound(m_hitsetkeys.begin(), m_hitsetkeys.end(), keylo);
+  const auto end = std::upper_bound(begin, m_hitsetkeys.end(), keyhi);
+  return HitSetKeyList(begin, end);
+}
+
+//_________________________________________________________________
+TrkrClusterContainer::HitSetKeyList TrkrClusterContainerv5::getHitSetKeys(const TrkrDefs::TrkrId trackerid) const
+{
+  return get_hitset_keys(TrkrDefs::getHitSetKeyLo(trackerid), TrkrDefs::getHitSetKeyHi(trackerid));
+}
+
+//_________________________________________________________________
+TrkrClusterContainer::HitSetKeyList TrkrClusterContainerv5::getHitSetKeys(const TrkrDefs::TrkrId trackerid, const uint8_t layer) const
+{
+  return get_hitset_keys(TrkrDefs::getHitSetKeyLo(trackerid, layer), TrkrDefs::getHitSetKeyHi(trackerid, layer));
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::IOBuffers::resize(std::size_t size)
+{
+  index.resize(size);
+  localx.resize(size);
+  localy.resize(size);
+  subsurfkey.resize(size);
+  phierr.resize(size);
+  zerr.resize(size);
+  adc.resize(size);
+  maxadc.resize(size);
+  phisize.resize(size);
+  zsize.resize(size);
+  overlap.resize(size);
+  edge.resize(size);
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv5::Streamer(TBuffer& buffer)
+{
+  if (buffer.IsReading())
+  {
+    UInt_t start = 0;
+    UInt_t count = 0;
+    buffer.ReadVersion(&start, &count);
+    TrkrClusterContainer::Streamer(buffer);
+
+    Reset();
+    UInt_t nblocks = 0;
+    buffer >> nblocks;
+    for (UInt_t iblock = 0; iblock < nblocks; ++iblock)
+    {
+      TrkrDefs::hitsetkey hitsetkey = 0;
+      UInt_t nclusters = 0;
+      buffer >> hitsetkey;
+      buffer >> nclusters;
+
+      m_io.resize(nclusters);
+      buffer.ReadFastArray(m_io.index.data(), nclusters);
+      buffer.ReadFastArray(m_io.localx.data(), nclusters);
+      buffer.ReadFastArray(m_io.localy.data(), nclusters);
+      buffer.ReadFastArray(m_io.subsurfkey.data(), nclusters);
+      buffer.ReadFastArray(m_io.phierr.data(), nclusters);
+      buffer.ReadFastArray(m_io.zerr.data(), nclusters);
+      buffer.ReadFastArray(m_io.adc.data(), nclusters);
+      buffer.ReadFastArray(m_io.maxadc.data(), nclusters);
+      buffer.ReadFastArray(m_io.phisize.data(), nclusters);
+      buffer.ReadFastArray(m_io.zsize.data(), nclusters);
+      buffer.ReadFastArray(m_io.overlap.data(), nclusters);
+      buffer.ReadFastArray(m_io.edge.data(), nclusters);
+
+      // indices are sorted on file, the last one sets the vector size
+      auto& block = find_or_add_block(hitsetkey);
+      if (nclusters)
+      {
+        list_hitset(hitsetkey);
+      }
+      auto& clus_vector = block.clusters;
+      clus_vector.assign(nclusters ? m_io.index.back() + 1 : 0, nullptr);
+      block.adopted.assign(clus_vector.size(), false);
+      for (UInt_t i = 0; i < nclusters; ++i)
+      {
+        auto* cluster = allocate_cluster();
+        cluster->setLocalX(m_io.localx[i]);
+        cluster->setLocalY(m_io.localy[i]);
+        cluster->setSubSurfKey(m_io.subsurfkey[i]);
+        cluster->setPhiError(m_io.phierr[i]);
+        cluster->setZError(m_io.zerr[i]);
+        cluster->setAdc(m_io.adc[i]);
+        cluster->setMaxAdc(m_io.maxadc[i]);
+        cluster->setPhiSize(m_io.phisize[i]);
+        cluster->setZSize(m_io.zsize[i]);
+        cluster->setOverlap(m_io.overlap[i]);
+        cluster->setEdge(m_io.edge[i]);
+        clus_vector[m_io.index[i]] = cluster;
+      }
+      m_size += nclusters;
+    }
+    buffer.CheckByteCount(start, count, TrkrClusterContainerv5::IsA());
+  }
+  else
+  {
+    const UInt_t count = buffer.WriteVersion(TrkrClusterContainerv5::IsA(), kTRUE);
+    TrkrClusterContainer::Streamer(buffer);
+
+    // write hitsets in hitsetkey order, skipping empty ones
+    const auto& hitsetkeys = getHitSetKeys();
+    const UInt_t nblocks = hitsetkeys.size();
+    buffer << nblocks;
+
+    for (const auto& hitsetkey : hitsetkeys)
+    {
+      const auto& clus_vector = m_blocks[find_block(hitsetkey)].clusters;
+      m_io.resize(0);
+      for (UInt_t index = 0; index < clus_vector.size(); ++index)
+      {
+        const TrkrCluster* cluster = clus_vector[index];
+        if (!cluster)
+        {
+          continue;
+        }
+
+        m_io.index.push_back(index);
+        m_io.localx.push_back(cluster->getLocalX());
+        m_io.localy.push_back(cluster->getLocalY());
+        m_io.subsurfkey.push_back(cluster->getSubSurfKey());
+        m_io.phierr.push_back(cluster->getRPhiError());
+        m_io.zerr.push_back(cluster->getZError());
+        m_io.adc.push_back(cluster->getAdc());
+        m_io.maxadc.push_back(cluster->getMaxAdc());
+
+        // sizes are stored as char in TrkrClusterv5
+        m_io.phisize.push_back(static_cast<Char_t>(cluster->getPhiSize()));
+        m_io.zsize.push_back(static_cast<Char_t>(cluster->getZSize()));
+        m_io.overlap.push_back(cluster->getOverlap());
+        m_io.edge.push_back(cluster->getEdge());
+      }
+
+      const UInt_t nclusters = m_io.index.size();
+      buffer << hitsetkey;
+      buffer << nclusters;
+      buffer.WriteFastArray(m_io.index.data(), nclusters);
+      buffer.WriteFastArray(m_io.localx.data(), nclusters);
+      buffer.WriteFastArray(m_io.localy.data(), nclusters);
+      buffer.WriteFastArray(m_io.subsurfkey.data(), nclusters);
+      buffer.WriteFastArray(m_io.phierr.data(), nclusters);
+      buffer.WriteFastArray(m_io.zerr.data(), nclusters);
+      buffer.WriteFastArray(m_io.adc.data(), nclusters);
+      buffer.WriteFastArray(m_io.maxadc.data(), nclusters);
+      buffer.WriteFastArray(m_io.phisize.data(), nclusters);
+      buffer.WriteFastArray(m_io.zsize.data(), nclusters);
+      buffer.WriteFastArray(m_io.overlap.data(), nclusters);
+      buffer.WriteFastArray(m_io.edge.data(), nclusters);
+    }
+    buffer.SetByteCount(count, kTRUE);
+  }
+}
@@ -0,0 +1,171 @@
+#ifndef TRACKBASE_TRKRCLUSTERCONTAINERV5_H
+#define TRACKBASE_TRKRCLUSTERCONTAINERV5_H
+
+/**
+ * @file trackbase/TrkrClusterContainerv5.h
+ * @brief Cluster container with contiguous cluster storage
+ */
+
+#include "TrkrClusterContainer.h"
+#include "TrkrClusterv5.h"
+
+#include <phool/PHObject.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+class TrkrCluster;
+
+/**
+ * @brief Cluster container object
+ *
+ * Clusters are stored by value in a cluster arena owned by the container, and indexed per hitset
+ * by cluster index. Hitsets are found through a flat hash table, so that findCluster costs
+ * a hash probe and two array indexes. Reset only rewinds the arena and the index tables, no memory is released.
+ *
+ * Clusters passed to addClusterSpecifyKey are adopted as is and deleted in Reset, as for the other container versions.
+ * Producers that know the container type can instead get a TrkrClusterv5 from the arena with newClusterSpecifyKey.
+ * Pointers returned by findCluster and getClusters stay valid until the cluster is removed or the container is reset.
+ *
+ * On file, clusters are written hitset by hitset as flat arrays of TrkrClusterv5 fields, and are read back into the arena.
+ */
+class TrkrClusterContainerv5 : public TrkrClusterContainer
+{
+ public:
+  TrkrClusterContainerv5() = default;
+
+  ~TrkrClusterContainerv5() override;
+
+  // copying would alias adopted clusters
+  TrkrClusterContainerv5(const TrkrClusterContainerv5&) = delete;
+  TrkrClusterContainerv5& operator=(const TrkrClusterContainerv5&) = delete;
+
+  /**
+   * remove all stored clusters
+   * effectively leaving the container empty. Storage is kept for the next event
+   */
+  void Reset() override;
+
+  void identify(std::ostream& os = std::cout) const override;
+
+  void addClusterSpecifyKey(const TrkrDefs::cluskey, TrkrCluster*) override;
+
+  //! create a cluster in the arena and store it with the given key. The cluster is owned by the container
+  TrkrClusterv5* newClusterSpecifyKey(const TrkrDefs::cluskey);
+
+  //! remove cluster matching a given cluster key
+  void removeCluster(TrkrDefs::cluskey) override;
+
+  //! delete and remove all the clusters matching a given key
+  void removeClusters(TrkrDefs::hitsetkey) override;
+
+  ConstRange getClusters() const override;  // deprecated
+
+  ConstRange getClusters(TrkrDefs::hitsetkey) override;
+
+  TrkrCluster* findCluster(TrkrDefs::cluskey) const override;
+
+  const HitSetKeyList& getHitSetKeys() const override;
+
+  HitSetKeyList getHitSetKeys(const TrkrDefs::TrkrId) const override;
+
+  HitSetKeyList getHitSetKeys(const TrkrDefs::TrkrId, const uint8_t /* layer */) const override;
+
+  unsigned int size() const override
+  {
+    return m_size;
+  }
+
+ private:
+  /// clusters of a given hitset, indexed by cluster index. nullptr for missing clusters
+  struct HitSetBlock
+  {
+    TrkrDefs::hitsetkey hitsetkey = TrkrDefs::HITSETKEYMAX;
+    std::vector<TrkrCluster*> clusters;
+
+    /// true for clusters adopted from addClusterSpecifyKey, false for arena clusters
+    std::vector<bool> adopted;
+  };
+
+  /// block index matching hitsetkey, -1 if not found
+  int find_block(TrkrDefs::hitsetkey) const;
+
+  /// block matching hitsetkey, created if not found
+  HitSetBlock& find_or_add_block(TrkrDefs::hitsetkey);
+
+  /// rebuild the hash table with a given capacity (power of 2)
+  void rehash(std::size_t);
+
+  /// get a fresh cluster from the arena
+  TrkrClusterv5* allocate_cluster();
+
+  /// slot of a new cluster in its hitset block. Exits on duplicate key
+  HitSetBlock& add_slot(TrkrDefs::cluskey);
+
+  /// remove cluster from a block, deleting it if adopted. Arena clusters are only released at Reset
+  void release_cluster(HitSetBlock&, unsigned int index);
+
+  /// delete the adopted clusters of all blocks in use
+  void delete_adopted();
+
+  /// add hitsetkey to the sorted hitset key list
+  void list_hitset(TrkrDefs::hitsetkey);
+
+  /// remove hitsetkey from the sorted hitset key list
+  void unlist_hitset(TrkrDefs::hitsetkey);
+
+  /// hitset key range of the sorted hitset key list, as a new list
+  HitSetKeyList get_hitset_keys(TrkrDefs::hitsetkey keylo, TrkrDefs::hitsetkey keyhi) const;
+
+  /// hitset blocks. Only the first m_nblocks are in use, the others keep their memory for later events
+  std::vector<HitSetBlock> m_blocks;  //!
+  std::size_t m_nblocks = 0;  //!
+
+  /// sorted keys of the blocks holding clusters, updated when a block gets its first cluster or is emptied
+  HitSetKeyList m_hitsetkeys;  //!
+
+  /// open addressing hash table, hitsetkey to block index. Empty slots have HITSETKEYMAX as key
+  std::vector<TrkrDefs::hitsetkey> m_index_keys;  //!
+  std::vector<uint32_t> m_index_blocks;  //!
+
+  /// cluster arena. Deque growth keeps addresses stable
+  std::deque<TrkrClusterv5> m_arena;  //!
+  std::size_t m_arena_used = 0;  //!
+
+  /// total number of clusters
+  unsigned int m_size = 0;  //!
+
+  /// temporary map
+  /**
+   * the map is transient. It must not be written to the output.
+   * it is only used to implement getClusters(TrkrDefs::hitsetkey)
+   */
+  Map m_tmpmap;  //!
+
+  /// I/O buffers, one entry per cluster of a given hitset, reused from one hitset to the next
+  struct IOBuffers
+  {
+    std::vector<UInt_t> index;
+    std::vector<Float_t> localx;
+    std::vector<Float_t> localy;
+    std::vector<UShort_t> subsurfkey;
+    std::vector<Float_t> phierr;
+    std::vector<Float_t> zerr;
+    std::vector<UShort_t> adc;
+    std::vector<UShort_t> maxadc;
+    std::vector<Char_t> phisize;
+    std::vector<Char_t> zsize;
+    std::vector<Char_t> overlap;
+    std::vector<Char_t> edge;
+
+    void resize(std::size_t);
+  };
+  IOBuffers m_io;  //!
+
+  // custom streamer writes flat per hitset cluster arrays
+  ClassDefOverride(TrkrClusterContainerv5, 1)
+};
+
+#endif  // TRACKBASE_TRKRCLUSTERCONTAINERV5_H
@@ -0,0 +1,6 @@
+#ifdef __CINT__
+
+// streamer is implemented by hand, see TrkrClusterContainerv5.cc
+#pragma link C++ class TrkrClusterContainerv5 - ;
+
+#endif /* __CINT__ */
@@ -0,0 +1,74 @@
+/**
+ * @file trackbase/TrkrClusterContainerv6.cc
+ * @brief Implementation of TrkrClusterContainerv6
+ */
+#include "TrkrClusterContainerv6.h"
+#include "TrkrClusterCompressionDict.h"
+
+#include <TBuffer.h>
+
+//_________________________________________________________________
+void TrkrClusterContainerv6::identify(std::ostream& os) const
+{
+  os << "-----TrkrClusterContainerv6-----" << std::endl;
+  os << "Written compressed: " << m_nevents << " events, " << m_nclusters << " clusters, "
+     << m_nescaped << " uncompressed fields" << std::endl;
+  TrkrClusterContainerv5::identify(os);
+}
+
+//_________________________________________________________________
+void TrkrClusterContainerv6::Streamer(TBuffer& buffer)
+{
+  if (buffer.IsReading())
+  {
+    UInt_t start = 0;
+    UInt_t count = 0;
+    buffer.ReadVersion(&start, &count);
+    Bool_t compressed = false;
+    buffer >> compressed;
+    if (compressed)
+    {
+      m_compressed.Streamer(buffer);
+
+      Reset();
+      const auto* dict = TrkrClusterCompressionDict::get_current();
+      if (dict)
+      {
+        m_compressed.decompress(this, dict);
+      }
+      else
+      {
+        static bool once = true;
+        if (once)
+        {
+          once = false;
+          std::cout << "TrkrClusterContainerv6::Streamer - no TRKR_CLUSTER_COMPRESSION_DICT on the RUN node, clusters are not decoded" << std::endl;
+        }
+      }
+    }
+    else
+    {
+      TrkrClusterContainerv5::Streamer(buffer);
+    }
+    buffer.CheckByteCount(start, count, TrkrClusterContainerv6::IsA());
+  }
+  else
+  {
+    const UInt_t count = buffer.WriteVersion(TrkrClusterContainerv6::IsA(), kTRUE);
+    const Bool_t compressed = (m_dict != nullptr);
+    buffer << compressed;
+    if (compressed)
+    {
+      m_compressed.compress(this, m_dict);
+      m_compressed.Streamer(buffer);
+      ++m_nevents;
+      m_nclusters += m_compressed.size();
+      m_nescaped += m_compressed.get_nescaped();
+    }
+    else
+    {
+      TrkrClusterContainerv5::Streamer(buffer);
+    }
+    buffer.SetByteCount(count, kTRUE);
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef TRACKBASE_TRKRCLUSTERCONTAINERV6_H
+#define TRACKBASE_TRKRCLUSTERCONTAINERV6_H
+
+/**
+ * @file trackbase/TrkrClusterContainerv6.h
+ * @brief Cluster container stored on file with compressed cluster fields
+ */
+
+#include "TrkrClusterCompressedContainerv1.h"
+#include "TrkrClusterContainerv5.h"
+
+#include <cstddef>
+#include <iostream>
+
+class TrkrClusterCompressionDict;
+
+/**
+ * @brief Cluster container stored on file with compressed cluster fields
+ *
+ * In memory it is a TrkrClusterContainerv5. On file, clusters are written as a
+ * TrkrClusterCompressedContainerv1, encoded with the dictionary given to set_dict,
+ * and decoded back into the arena when read, using the dictionary of the RUN node
+ * (see TrkrClusterCompressionDict::get_current). Readers need no extra module.
+ *
+ * With no dictionary set, clusters are written as by TrkrClusterContainerv5.
+ */
+class TrkrClusterContainerv6 : public TrkrClusterContainerv5
+{
+ public:
+  TrkrClusterContainerv6() = default;
+
+  void identify(std::ostream& os = std::cout) const override;
+
+  //! dictionary used to encode the clusters on write. Not owned
+  void set_dict(const TrkrClusterCompressionDict* dict)
+  {
+    m_dict = dict;
+  }
+
+  //!@name compression statistics, summed over the events written compressed
+  //@{
+  std::size_t get_nevents() const { return m_nevents; }
+  std::size_t get_nclusters() const { return m_nclusters; }
+  std::size_t get_nescaped() const { return m_nescaped; }
+  //@}
+
+ private:
+  //! dictionary used on write
+  const TrkrClusterCompressionDict* m_dict = nullptr;  //!
+
+  //! compressed clusters, reused from one event to the next
+  TrkrClusterCompressedContainerv1 m_compressed;  //!
+
+  //! number of events and clusters written compressed, and of fields stored uncompressed among them
+  std::size_t m_nevents = 0;  //!
+  std::size_t m_nclusters = 0;  //!
+  std::size_t m_nescaped = 0;  //!
+
+  // custom streamer writes the compressed clusters
+  ClassDefOverride(TrkrClusterContainerv6, 1)
+};
+
+#endif  // TRACKBASE_TRKRCLUSTERCONTAINERV6_H
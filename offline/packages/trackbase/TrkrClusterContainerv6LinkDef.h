@@ -0,0 +1,6 @@
+#ifdef __CINT__
+
+// streamer is implemented by hand, see TrkrClusterContainerv6.cc
+#pragma link C++ class TrkrClusterContainerv6 - ;
+
+#endif /* __CINT__ */
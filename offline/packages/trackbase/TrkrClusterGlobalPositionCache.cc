@@ -0,0 +1,36 @@
+/**
+ * @file trackbase/TrkrClusterGlobalPositionCache.cc
+ * @brief Implementation of TrkrClusterGlobalPositionCache
+ */
+
+#include "TrkrClusterGlobalPositionCache.h"
+
+//_________________________________________________________________________
+void TrkrClusterGlobalPositionCache::Reset()
+{
+  // keep the vectors allocated, hitsets are mostly the same from one event to the next
+  for (auto& [hitsetkey, entries] : m_positions)
+  {
+    entries.clear();
+  }
+}
+
+//_________________________________________________________________________
+void TrkrClusterGlobalPositionCache::identify(std::ostream& os) const
+{
+  os << "TrkrClusterGlobalPositionCache - hitsets: " << m_positions.size() << " positions: " << size() << std::endl;
+}
+
+//_________________________________________________________________________
+std::size_t TrkrClusterGlobalPositionCache::size() const
+{
+  std::size_t size = 0;
+  for (const auto& [hitsetkey, entries] : m_positions)
+  {
+    for (const auto& entry : entries)
+    {
+      size += (entry.cluster != nullptr);
+    }
+  }
+  return size;
+}
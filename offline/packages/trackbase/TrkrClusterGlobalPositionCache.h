@@ -0,0 +1,122 @@
+#ifndef TRACKBASE_TRKRCLUSTERGLOBALPOSITIONCACHE_H
+#define TRACKBASE_TRKRCLUSTERGLOBALPOSITIONCACHE_H
+
+/**
+ * @file trackbase/TrkrClusterGlobalPositionCache.h
+ * @brief per event cache of the cluster global positions
+ */
+
+#include "TrkrCluster.h"
+#include "TrkrDefs.h"
+
+#include <phool/PHObject.h>
+
+#include <Acts/Definitions/Algebra.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief per event cache of the cluster global positions
+ *
+ * Stores the global position of each cluster, with all the corrections
+ * applied, as computed by the first module that needs it in the event.
+ * Positions are stored per hitset, in a flat array indexed by the cluster
+ * index, like in TrkrClusterContainerv4.
+ *
+ * Each position is tagged with the cluster object and local position, the
+ * bunch crossing and the set of corrections it was computed for, and is only
+ * returned to callers asking for the same ones. A cluster that is replaced or
+ * moved, or a position asked for another crossing, is thus recomputed, and
+ * the new position replaces the old one.
+ *
+ * The object is transient. It lives on the DST node, without being written
+ * out, so that it is cleared at the end of every event.
+ */
+class TrkrClusterGlobalPositionCache : public PHObject
+{
+ public:
+  //! constructor
+  TrkrClusterGlobalPositionCache() = default;
+
+  //! clear all positions. Memory is kept for the next event
+  void Reset() override;
+
+  void identify(std::ostream& os = std::cout) const override;
+
+  /**
+   * cached position of a cluster, nullptr if not found
+   * @param crossing bunch crossing the position was computed for
+   * @param tag identifies the corrections the position was computed with
+   */
+  const Acts::Vector3* find(TrkrDefs::cluskey key, const TrkrCluster* cluster, short int crossing, uint8_t tag) const
+  {
+    if (!cluster)
+    {
+      return nullptr;
+    }
+
+    const auto iter = m_positions.find(TrkrDefs::getHitSetKeyFromClusKey(key));
+    if (iter == m_positions.end())
+    {
+      return nullptr;
+    }
+
+    const auto index = TrkrDefs::getClusIndex(key);
+    if (index >= iter->second.size())
+    {
+      return nullptr;
+    }
+
+    const auto& entry = iter->second[index];
+    const bool match = entry.cluster == cluster &&
+                       entry.crossing == crossing &&
+                       entry.tag == tag &&
+                       entry.local_x == cluster->getLocalX() &&
+                       entry.local_y == cluster->getLocalY();
+    return match ? &entry.position : nullptr;
+  }
+
+  //! store the position of a cluster. Replaces any existing position
+  void insert(TrkrDefs::cluskey key, const TrkrCluster* cluster, short int crossing, uint8_t tag, const Acts::Vector3& position)
+  {
+    auto& entries = m_positions[TrkrDefs::getHitSetKeyFromClusKey(key)];
+    const auto index = TrkrDefs::getClusIndex(key);
+    if (index >= entries.size())
+    {
+      entries.resize(index + 1);
+    }
+
+    auto& entry = entries[index];
+    entry.position = position;
+    entry.cluster = cluster;
+    entry.local_x = cluster->getLocalX();
+    entry.local_y = cluster->getLocalY();
+    entry.crossing = crossing;
+    entry.tag = tag;
+  }
+
+  //! number of stored positions
+  std::size_t size() const;
+
+ private:
+  //! cached position
+  struct Entry
+  {
+    Acts::Vector3 position = Acts::Vector3::Zero();
+    const TrkrCluster* cluster = nullptr;
+    float local_x = 0;
+    float local_y = 0;
+    short int crossing = 0;
+    uint8_t tag = 0;
+  };
+
+  //! positions, per hitset, indexed by cluster index
+  std::unordered_map<TrkrDefs::hitsetkey, std::vector<Entry>> m_positions;  //!
+
+  ClassDefOverride(TrkrClusterGlobalPositionCache, 1)
+};
+
+#endif  // TRACKBASE_TRKRCLUSTERGLOBALPOSITIONCACHE_H
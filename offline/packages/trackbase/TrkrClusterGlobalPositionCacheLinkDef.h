@@ -0,0 +1,5 @@
+#ifdef __CINT__
+
+#pragma link C++ class TrkrClusterGlobalPositionCache + ;
+
+#endif /* __CINT__ */
@@ -70,6 +70,16 @@ class TrkrHitSet : public PHObject
    */
   virtual ConstIterator addHitSpecificKey(const TrkrDefs::hitkey, TrkrHit*);
 
+  /**
+   * @brief Get the hit matching a given key, creating it if not found
+   * @param[in] key Hit key
+   * @param[out] Pointer to the hit, owned by this TrkrHitSet
+   *
+   * The default implementation creates a new TrkrHitv2 and adds it using addHitSpecificKey.
+   * Implementations with pooled storage override it to avoid the per hit allocation.
+   */
+  virtual TrkrHit* findOrAddHit(const TrkrDefs::hitkey);
+
   /**
    * @brief Remove a hit using its key
    * @param[in] key to be removed
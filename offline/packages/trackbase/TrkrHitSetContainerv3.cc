@@ -0,0 +1,253 @@
+/**
+ * @file trackbase/TrkrHitSetContainerv3.cc
+ * @brief Implementation for TrkrHitSetContainerv3
+ */
+#include "TrkrHitSetContainerv3.h"
+
+#include "TrkrDefs.h"
+#include "TrkrHit.h"
+#include "TrkrHitSetv2.h"
+
+#include <TBuffer.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+TrkrHitSetContainerv3::~TrkrHitSetContainerv3()
+{
+  for (auto* hitset : m_pool)
+  {
+    delete hitset;
+  }
+  delete_adopted();
+}
+
+void TrkrHitSetContainerv3::delete_adopted()
+{
+  for (auto* hitset : m_adopted)
+  {
+    delete hitset;
+  }
+  m_adopted.clear();
+}
+
+void TrkrHitSetContainerv3::Reset()
+{
+  // keep the index nodes for the next event
+  while (!m_hitmap.empty())
+  {
+    m_free_nodes.push_back(m_hitmap.extract(m_hitmap.begin()));
+  }
+
+  // reset used hitsets. They keep their hit arena for the next event
+  for (std::size_t i = 0; i < m_pool_used; ++i)
+  {
+    m_pool[i]->Reset();
+  }
+  m_pool_used = 0;
+
+  delete_adopted();
+}
+
+void TrkrHitSetContainerv3::identify(std::ostream& os) const
+{
+  os << "TrkrHitSetContainerv3: Number of hitsets: " << size() << " pool size: " << m_pool.size() << std::endl;
+  for (const auto& pair : m_hitmap)
+  {
+    int layer = TrkrDefs::getLayer(pair.first);
+    os << "hitsetkey " << pair.first << " layer " << layer << std::endl;
+    pair.second->identify();
+  }
+  return;
+}
+
+TrkrHitSetContainerv3::Iterator
+TrkrHitSetContainerv3::insert(Map::const_iterator hint, TrkrDefs::hitsetkey key, TrkrHitSet* hitset)
+{
+  if (m_free_nodes.empty())
+  {
+    return m_hitmap.emplace_hint(hint, key, hitset);
+  }
+
+  auto node = std::move(m_free_nodes.back());
+  m_free_nodes.pop_back();
+  node.key() = key;
+  node.mapped() = hitset;
+  return m_hitmap.insert(hint, std::move(node));
+}
+
+TrkrHitSetv2* TrkrHitSetContainerv3::allocate_hitset()
+{
+  if (m_pool_used == m_pool.size())
+  {
+    m_pool.push_back(new TrkrHitSetv2);
+  }
+  return m_pool[m_pool_used++];
+}
+
+void TrkrHitSetContainerv3::release_hitset(TrkrHitSet* hitset)
+{
+  const auto end = m_pool.begin() + m_pool_used;
+  const auto iter = std::find(m_pool.begin(), end, hitset);
+  if (iter != end)
+  {
+    (*iter)->Reset();
+    std::iter_swap(iter, end - 1);
+    --m_pool_used;
+    return;
+  }
+
+  const auto adopted = std::find(m_adopted.begin(), m_adopted.end(), hitset);
+  if (adopted != m_adopted.end())
+  {
+    delete *adopted;
+    *adopted = m_adopted.back();
+    m_adopted.pop_back();
+  }
+}
+
+TrkrHitSetContainerv3::ConstIterator
+TrkrHitSetContainerv3::addHitSet(TrkrHitSet* newhit)
+{
+  return addHitSetSpecifyKey(newhit->getHitSetKey(), newhit);
+}
+
+TrkrHitSetContainerv3::ConstIterator
+TrkrHitSetContainerv3::addHitSetSpecifyKey(const TrkrDefs::hitsetkey key, TrkrHitSet* newhit)
+{
+  const auto iter = m_hitmap.lower_bound(key);
+  if (iter != m_hitmap.end() && iter->first == key)
+  {
+    std::cout << "TrkrHitSetContainerv3::AddHitSpecifyKey: duplicate key: " << key << " exiting now" << std::endl;
+    exit(1);
+  }
+
+  if (auto* hitset = dynamic_cast<TrkrHitSetv2*>(newhit))
+  {
+    // adopt hitset into the used part of the pool
+    m_pool.push_back(hitset);
+    std::swap(m_pool[m_pool_used], m_pool.back());
+    ++m_pool_used;
+  }
+  else
+  {
+    // other versions are kept as they are, the caller may still use the pointer
+    m_adopted.push_back(newhit);
+  }
+
+  return insert(iter, key, newhit);
+}
+
+void TrkrHitSetContainerv3::removeHitSet(TrkrDefs::hitsetkey key)
+{
+  auto iter = m_hitmap.find(key);
+  if (iter != m_hitmap.end())
+  {
+    release_hitset(iter->second);
+    m_free_nodes.push_back(m_hitmap.extract(iter));
+  }
+}
+
+void TrkrHitSetContainerv3::removeHitSet(TrkrHitSet* hitset)
+{
+  removeHitSet(hitset->getHitSetKey());
+}
+
+TrkrHitSetContainerv3::ConstRange
+TrkrHitSetContainerv3::getHitSets(const TrkrDefs::TrkrId trackerid) const
+{
+  const TrkrDefs::hitsetkey keylo = TrkrDefs::getHitSetKeyLo(trackerid);
+  const TrkrDefs::hitsetkey keyhi = TrkrDefs::getHitSetKeyHi(trackerid);
+  return std::make_pair(m_hitmap.lower_bound(keylo), m_hitmap.upper_bound(keyhi));
+}
+
+TrkrHitSetContainerv3::ConstRange
+TrkrHitSetContainerv3::getHitSets(const TrkrDefs::TrkrId trackerid, const uint8_t layer) const
+{
+  TrkrDefs::hitsetkey keylo = TrkrDefs::getHitSetKeyLo(trackerid, layer);
+  TrkrDefs::hitsetkey keyhi = TrkrDefs::getHitSetKeyHi(trackerid, layer);
+  return std::make_pair(m_hitmap.lower_bound(keylo), m_hitmap.upper_bound(keyhi));
+}
+
+TrkrHitSetContainerv3::ConstRange
+TrkrHitSetContainerv3::getHitSets() const
+{
+  return std::make_pair(m_hitmap.cbegin(), m_hitmap.cend());
+}
+
+TrkrHitSetContainerv3::Iterator
+TrkrHitSetContainerv3::findOrAddHitSet(TrkrDefs::hitsetkey key)
+{
+  auto it = m_hitmap.lower_bound(key);
+  if (it == m_hitmap.end() || (key < it->first))
+  {
+    auto* hitset = allocate_hitset();
+    hitset->setHitSetKey(key);
+    it = insert(it, key, hitset);
+  }
+  return it;
+}
+
+TrkrHitSet*
+TrkrHitSetContainerv3::findHitSet(TrkrDefs::hitsetkey key)
+{
+  auto it = m_hitmap.find(key);
+  if (it != m_hitmap.end())
+  {
+    return it->second;
+  }
+  else
+  {
+    return nullptr;
+  }
+}
+
+void TrkrHitSetContainerv3::Streamer(TBuffer& buffer)
+{
+  if (buffer.IsReading())
+  {
+    UInt_t start = 0;
+    UInt_t count = 0;
+    buffer.ReadVersion(&start, &count);
+    TrkrHitSetContainer::Streamer(buffer);
+
+    Reset();
+    UInt_t nhitsets = 0;
+    buffer >> nhitsets;
+    for (UInt_t i = 0; i < nhitsets; ++i)
+    {
+      // hitsets are sorted on file, so that every insertion happens at the end of the index
+      auto* hitset = allocate_hitset();
+      hitset->Streamer(buffer);
+      insert(m_hitmap.cend(), hitset->getHitSetKey(), hitset);
+    }
+    buffer.CheckByteCount(start, count, TrkrHitSetContainerv3::IsA());
+  }
+  else
+  {
+    const UInt_t count = buffer.WriteVersion(TrkrHitSetContainerv3::IsA(), kTRUE);
+    TrkrHitSetContainer::Streamer(buffer);
+
+    const UInt_t nhitsets = m_hitmap.size();
+    buffer << nhitsets;
+    for (const auto& [key, hitset] : m_hitmap)
+    {
+      if (auto* hitsetv2 = dynamic_cast<TrkrHitSetv2*>(hitset))
+      {
+        hitsetv2->Streamer(buffer);
+        continue;
+      }
+
+      // convert adopted hitsets of other versions
+      m_io_hitset.Reset();
+      m_io_hitset.setHitSetKey(key);
+      const auto hitrange = hitset->getHits();
+      for (auto hititer = hitrange.first; hititer != hitrange.second; ++hititer)
+      {
+        m_io_hitset.findOrAddHit(hititer->first)->setAdc(hititer->second->getAdc());
+      }
+      m_io_hitset.Streamer(buffer);
+    }
+    buffer.SetByteCount(count, kTRUE);
+  }
+}
@@ -0,0 +1,100 @@
+#ifndef TRACKBASE_TrkrHitSetContainerv3_H
+#define TRACKBASE_TrkrHitSetContainerv3_H
+/**
+ * @file trackbase/TrkrHitSetContainerv3.h
+ * @brief Pooled container for TrkrHitSetv2 objects
+ */
+
+#include "TrkrDefs.h"
+#include "TrkrHitSetContainer.h"
+#include "TrkrHitSetv2.h"
+
+#include <cstddef>
+#include <iostream>  // for cout, ostream
+#include <map>
+#include <utility>  // for pair
+#include <vector>
+
+class TrkrHitSet;
+
+/**
+ * Container for TrkrHitSetv2 objects
+ *
+ * Hitsets are taken from a pool owned by the container and the nodes of the hitsetkey index are recycled,
+ * so that Reset() only resets the hitsets (which keep their own hit arena) and no memory is released
+ * or allocated from one event to the next.
+ * TrkrHitSetv2 objects passed to addHitSet/addHitSetSpecifyKey are adopted into the pool. Other hitset versions
+ * are adopted as is, deleted in Reset() as for TrkrHitSetContainerv1, and converted to TrkrHitSetv2 on file.
+ */
+class TrkrHitSetContainerv3 : public TrkrHitSetContainer
+{
+ public:
+  TrkrHitSetContainerv3() = default;
+
+  ~TrkrHitSetContainerv3() override;
+
+  // copying would alias pooled hitsets
+  TrkrHitSetContainerv3(const TrkrHitSetContainerv3&) = delete;
+  TrkrHitSetContainerv3& operator=(const TrkrHitSetContainerv3&) = delete;
+
+  void Reset() override;
+
+  void identify(std::ostream& = std::cout) const override;
+
+  ConstIterator addHitSet(TrkrHitSet*) override;
+
+  ConstIterator addHitSetSpecifyKey(const TrkrDefs::hitsetkey, TrkrHitSet*) override;
+
+  void removeHitSet(TrkrDefs::hitsetkey) override;
+
+  void removeHitSet(TrkrHitSet*) override;
+
+  Iterator findOrAddHitSet(TrkrDefs::hitsetkey key) override;
+
+  ConstRange getHitSets(const TrkrDefs::TrkrId trackerid) const override;
+
+  ConstRange getHitSets(const TrkrDefs::TrkrId trackerid, const uint8_t layer) const override;
+
+  ConstRange getHitSets() const override;
+
+  TrkrHitSet* findHitSet(TrkrDefs::hitsetkey key) override;
+
+  unsigned int size() const override
+  {
+    return m_hitmap.size();
+  }
+
+ private:
+  //! insert hitset in index, reusing a recycled node if any
+  Iterator insert(Map::const_iterator hint, TrkrDefs::hitsetkey, TrkrHitSet*);
+
+  //! get a fresh hitset from the pool
+  TrkrHitSetv2* allocate_hitset();
+
+  //! return hitset to the pool, or delete it if it is not a pooled hitset
+  void release_hitset(TrkrHitSet*);
+
+  //! delete the adopted hitsets that are not TrkrHitSetv2
+  void delete_adopted();
+
+  //! hitsetkey index
+  Map m_hitmap;  //!
+
+  //! nodes removed from the index, reused for the next insertions
+  std::vector<Map::node_type> m_free_nodes;  //!
+
+  //! hitset pool. The first m_pool_used hitsets are in use
+  std::vector<TrkrHitSetv2*> m_pool;  //!
+  std::size_t m_pool_used = 0;  //!
+
+  //! hitsets of other versions adopted from addHitSetSpecifyKey, owned by the container
+  std::vector<TrkrHitSet*> m_adopted;  //!
+
+  //! used to write the adopted hitsets as TrkrHitSetv2
+  TrkrHitSetv2 m_io_hitset;  //!
+
+  // custom streamer writes the hitsets in hitsetkey order
+  ClassDefOverride(TrkrHitSetContainerv3, 1)
+};
+
+#endif  // TRACKBASE_TrkrHitSetContainerv3_H
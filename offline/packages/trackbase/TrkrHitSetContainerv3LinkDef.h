@@ -0,0 +1,6 @@
+#ifdef __CINT__
+
+// streamer is implemented by hand, see TrkrHitSetContainerv3.cc
+#pragma link C++ class TrkrHitSetContainerv3 - ;
+
+#endif /* __CINT__ */
@@ -0,0 +1,208 @@
+/**
+ * @file trackbase/TrkrHitSetv2.cc
+ * @brief Implementation of TrkrHitSetv2
+ */
+#include "TrkrHitSetv2.h"
+#include "TrkrHit.h"
+
+#include <TBuffer.h>
+
+#include <algorithm>
+#include <cstdlib>  // for exit
+#include <iostream>
+
+TrkrHitSetv2::~TrkrHitSetv2()
+{
+  for (auto* hit : m_adopted)
+  {
+    delete hit;
+  }
+}
+
+void TrkrHitSetv2::Reset()
+{
+  m_hitSetKey = TrkrDefs::HITSETKEYMAX;
+  clear_hits();
+}
+
+void TrkrHitSetv2::clear_hits()
+{
+  // keep the index nodes for the next event
+  while (!m_hits.empty())
+  {
+    m_free_nodes.push_back(m_hits.extract(m_hits.begin()));
+  }
+
+  for (auto* hit : m_adopted)
+  {
+    delete hit;
+  }
+  m_adopted.clear();
+
+  // arena hits are reinitialized when handed out again
+  m_arena_used = 0;
+}
+
+void TrkrHitSetv2::identify(std::ostream& os) const
+{
+  const unsigned int layer = TrkrDefs::getLayer(m_hitSetKey);
+  const unsigned int trkrid = TrkrDefs::getTrkrId(m_hitSetKey);
+  os
+      << "TrkrHitSetv2: "
+      << "       hitsetkey " << getHitSetKey()
+      << " TrkrId " << trkrid
+      << " layer " << layer
+      << " nhits: " << m_hits.size()
+      << " arena size: " << m_arena.size()
+      << std::endl;
+
+  for (const auto& entry : m_hits)
+  {
+    std::cout << " hitkey " << entry.first << std::endl;
+    (entry.second)->identify(os);
+  }
+}
+
+TrkrHitSetv2::ConstIterator
+TrkrHitSetv2::insert(Map::const_iterator hint, TrkrDefs::hitkey key, TrkrHit* hit)
+{
+  if (m_free_nodes.empty())
+  {
+    return m_hits.emplace_hint(hint, key, hit);
+  }
+
+  auto node = std::move(m_free_nodes.back());
+  m_free_nodes.pop_back();
+  node.key() = key;
+  node.mapped() = hit;
+  return m_hits.insert(hint, std::move(node));
+}
+
+void TrkrHitSetv2::recycle(Map::const_iterator iter)
+{
+  m_free_nodes.push_back(m_hits.extract(iter));
+}
+
+TrkrHit* TrkrHitSetv2::allocate_hit()
+{
+  if (m_arena_used == m_arena.size())
+  {
+    m_arena.emplace_back();
+  }
+  auto& hit = m_arena[m_arena_used++];
+  hit.setAdc(0);
+  return &hit;
+}
+
+TrkrHitSetv2::ConstIterator
+TrkrHitSetv2::addHitSpecificKey(const TrkrDefs::hitkey key, TrkrHit* hit)
+{
+  const auto iter = m_hits.lower_bound(key);
+  if (iter != m_hits.end() && iter->first == key)
+  {
+    std::cout << "TrkrHitSetv2::AddHitSpecificKey: duplicate key: " << key << " exiting now" << std::endl;
+    exit(1);
+  }
+
+  m_adopted.push_back(hit);
+  return insert(iter, key, hit);
+}
+
+TrkrHit*
+TrkrHitSetv2::findOrAddHit(const TrkrDefs::hitkey key)
+{
+  const auto iter = m_hits.lower_bound(key);
+  if (iter != m_hits.end() && iter->first == key)
+  {
+    return iter->second;
+  }
+
+  return insert(iter, key, allocate_hit())->second;
+}
+
+void TrkrHitSetv2::removeHit(TrkrDefs::hitkey key)
+{
+  const auto iter = m_hits.find(key);
+  if (iter == m_hits.end())
+  {
+    identify();
+    std::cout << "TrkrHitSetv2::removeHit: deleting a nonexist key: " << key << " exiting now" << std::endl;
+    exit(1);
+  }
+
+  // arena hits are only released at Reset, adopted hits are deleted right away
+  if (!m_adopted.empty())
+  {
+    const auto adopted = std::find(m_adopted.begin(), m_adopted.end(), iter->second);
+    if (adopted != m_adopted.end())
+    {
+      delete *adopted;
+      *adopted = m_adopted.back();
+      m_adopted.pop_back();
+    }
+  }
+
+  recycle(iter);
+}
+
+TrkrHit*
+TrkrHitSetv2::getHit(const TrkrDefs::hitkey key) const
+{
+  const auto iter = m_hits.find(key);
+  return iter == m_hits.end() ? nullptr : iter->second;
+}
+
+TrkrHitSetv2::ConstRange
+TrkrHitSetv2::getHits() const
+{
+  return std::make_pair(m_hits.cbegin(), m_hits.cend());
+}
+
+void TrkrHitSetv2::Streamer(TBuffer& buffer)
+{
+  if (buffer.IsReading())
+  {
+    UInt_t start = 0;
+    UInt_t count = 0;
+    buffer.ReadVersion(&start, &count);
+    TrkrHitSet::Streamer(buffer);
+    buffer >> m_hitSetKey;
+
+    UInt_t nhits = 0;
+    buffer >> nhits;
+    m_io_keys.resize(nhits);
+    m_io_adcs.resize(nhits);
+    buffer.ReadFastArray(m_io_keys.data(), nhits);
+    buffer.ReadFastArray(m_io_adcs.data(), nhits);
+    buffer.CheckByteCount(start, count, TrkrHitSetv2::IsA());
+
+    // keys are sorted on file, so that every insertion happens at the end of the index
+    clear_hits();
+    for (UInt_t i = 0; i < nhits; ++i)
+    {
+      TrkrHit* hit = allocate_hit();
+      hit->setAdc(m_io_adcs[i]);
+      insert(m_hits.cend(), m_io_keys[i], hit);
+    }
+  }
+  else
+  {
+    const UInt_t count = buffer.WriteVersion(TrkrHitSetv2::IsA(), kTRUE);
+    TrkrHitSet::Streamer(buffer);
+    buffer << m_hitSetKey;
+
+    m_io_keys.clear();
+    m_io_adcs.clear();
+    for (const auto& [key, hit] : m_hits)
+    {
+      m_io_keys.push_back(key);
+      m_io_adcs.push_back(static_cast<unsigned short>(hit->getAdc()));
+    }
+
+    const UInt_t nhits = m_io_keys.size();
+    buffer << nhits;
+    buffer.WriteFastArray(m_io_keys.data(), nhits);
+    buffer.WriteFastArray(m_io_adcs.data(), nhits);
+    buffer.SetByteCount(count, kTRUE);
+  }
+}
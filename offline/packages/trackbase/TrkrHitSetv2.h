@@ -0,0 +1,112 @@
+#ifndef TRACKBASE_TRKRHITSETV2_H
+#define TRACKBASE_TRKRHITSETV2_H
+
+/**
+ * @file trackbase/TrkrHitSetv2.h
+ * @brief Arena backed container for storing TrkrHit's
+ */
+#include "TrkrDefs.h"
+#include "TrkrHitSet.h"
+#include "TrkrHitv2.h"
+
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <utility>  // for pair
+#include <vector>
+
+// forward declaration
+class TrkrHit;
+
+/**
+ * @brief TrkrHitSet with pooled hit storage
+ *
+ * Hits created with findOrAddHit are constructed in a hit arena owned by the hitset,
+ * and the nodes of the hitkey index are recycled, so that once the arena has grown to the size of a typical event
+ * there is no memory allocation when filling the hitset, and Reset() releases nothing but only rewinds the arena.
+ * Hits passed to addHitSpecificKey are adopted and deleted in Reset(), as for TrkrHitSetv1.
+ *
+ * On file, the hits are stored as two flat arrays of hitkeys and adc values sorted by hitkey.
+ * Only the adc value of each hit is persistent.
+ */
+class TrkrHitSetv2 : public TrkrHitSet
+{
+ public:
+  TrkrHitSetv2() = default;
+
+  ~TrkrHitSetv2() override;
+
+  // copying would alias the hit index with the arena of the source
+  TrkrHitSetv2(const TrkrHitSetv2&) = delete;
+  TrkrHitSetv2& operator=(const TrkrHitSetv2&) = delete;
+
+  void identify(std::ostream& os = std::cout) const override;
+
+  void Reset() override;
+
+  void setHitSetKey(const TrkrDefs::hitsetkey key) override
+  {
+    m_hitSetKey = key;
+  }
+
+  TrkrDefs::hitsetkey getHitSetKey() const override
+  {
+    return m_hitSetKey;
+  }
+
+  ConstIterator addHitSpecificKey(const TrkrDefs::hitkey, TrkrHit*) override;
+
+  TrkrHit* findOrAddHit(const TrkrDefs::hitkey) override;
+
+  void removeHit(TrkrDefs::hitkey) override;
+
+  TrkrHit* getHit(const TrkrDefs::hitkey) const override;
+
+  ConstRange getHits() const override;
+
+  unsigned int size() const override
+  {
+    return m_hits.size();
+  }
+
+ private:
+  //! insert hit in index, reusing a recycled node if any
+  ConstIterator insert(Map::const_iterator hint, TrkrDefs::hitkey, TrkrHit*);
+
+  //! remove entry from index, keeping the node for later reuse
+  void recycle(Map::const_iterator);
+
+  //! get a fresh hit from the arena
+  TrkrHit* allocate_hit();
+
+  //! release all hits, keeping arena and index nodes
+  void clear_hits();
+
+  /// unique key for this object
+  TrkrDefs::hitsetkey m_hitSetKey = TrkrDefs::HITSETKEYMAX;
+
+  /// hitkey index
+  Map m_hits;  //!
+
+  /// nodes removed from the index, reused for the next insertions
+  std::vector<Map::node_type> m_free_nodes;  //!
+
+  /// hit arena. Elements are never destroyed before the hitset itself, deque growth keeps addresses stable
+  std::deque<TrkrHitv2> m_arena;  //!
+
+  /// number of arena hits in use
+  std::size_t m_arena_used = 0;  //!
+
+  /// hits adopted from addHitSpecificKey, owned by the hitset
+  std::vector<TrkrHit*> m_adopted;  //!
+
+  /// I/O buffers, reused from one event to the next
+  std::vector<TrkrDefs::hitkey> m_io_keys;  //!
+  std::vector<unsigned short> m_io_adcs;  //!
+
+  // custom streamer writes/reads flat (hitkey, adc) arrays
+  ClassDefOverride(TrkrHitSetv2, 1);
+};
+
+#endif  // TRACKBASE_TRKRHITSETV2_H
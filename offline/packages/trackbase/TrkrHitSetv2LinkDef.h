@@ -0,0 +1,6 @@
+#ifdef __CINT__
+
+// streamer is implemented by hand, see TrkrHitSetv2.cc
+#pragma link C++ class TrkrHitSetv2 - ;
+
+#endif /* __CINT__ */
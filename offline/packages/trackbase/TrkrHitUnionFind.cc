@@ -0,0 +1,78 @@
+#include "TrkrHitUnionFind.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace
+{
+  constexpr unsigned int kNoCluster = std::numeric_limits<unsigned int>::max();
+}
+
+void TrkrHitUnionFind::reset(unsigned int nhits)
+{
+  m_parent.resize(nhits);
+  std::iota(m_parent.begin(), m_parent.end(), 0);
+}
+
+unsigned int TrkrHitUnionFind::find(unsigned int i)
+{
+  // path halving
+  while (m_parent[i] != i)
+  {
+    m_parent[i] = m_parent[m_parent[i]];
+    i = m_parent[i];
+  }
+  return i;
+}
+
+void TrkrHitUnionFind::unite(unsigned int i, unsigned int j)
+{
+  i = find(i);
+  j = find(j);
+  if (i < j)
+  {
+    m_parent[j] = i;
+  }
+  else if (j < i)
+  {
+    m_parent[i] = j;
+  }
+}
+
+unsigned int TrkrHitUnionFind::make_clusters()
+{
+  const auto nhits = static_cast<unsigned int>(m_parent.size());
+
+  // number clusters in order of their first hit
+  m_rootid.assign(nhits, kNoCluster);
+  m_clusterid.resize(nhits);
+  unsigned int nclusters = 0;
+  for (unsigned int i = 0; i < nhits; ++i)
+  {
+    auto &id = m_rootid[find(i)];
+    if (id == kNoCluster)
+    {
+      id = nclusters++;
+    }
+    m_clusterid[i] = id;
+  }
+
+  // group hits per cluster, keeping the input order
+  m_offsets.assign(nclusters + 1, 0);
+  for (unsigned int i = 0; i < nhits; ++i)
+  {
+    ++m_offsets[m_clusterid[i] + 1];
+  }
+  std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+  m_order.resize(nhits);
+  for (unsigned int i = 0; i < nhits; ++i)
+  {
+    // m_offsets[id] is used as insertion point, it is shifted back below
+    m_order[m_offsets[m_clusterid[i]]++] = i;
+  }
+  std::copy_backward(m_offsets.begin(), m_offsets.end() - 1, m_offsets.end());
+  m_offsets[0] = 0;
+
+  return nclusters;
+}
@@ -0,0 +1,65 @@
+#ifndef TRACKBASE_TRKRHITUNIONFIND_H
+#define TRACKBASE_TRKRHITUNIONFIND_H
+
+/**
+ * @file trackbase/TrkrHitUnionFind.h
+ * @brief union-find over the hits of one hitset, for the clusterizers
+ */
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief union-find over the hits of one hitset
+ *
+ * Hits are given by their index in the clusterizer input. The clusterizer
+ * merges adjacent hits with unite(), then make_clusters() numbers the
+ * clusters in order of their first hit and lists their hits in input
+ * order, which is the numbering of boost::connected_components on the hit
+ * adjacency graph.
+ *
+ * Buffers are kept from one hitset to the next; one instance must be used per thread.
+ */
+class TrkrHitUnionFind
+{
+ public:
+  //! start a new hitset with nhits hits, each in its own cluster
+  void reset(unsigned int nhits);
+
+  //! root of the cluster of a hit
+  unsigned int find(unsigned int);
+
+  //! merge the clusters of two hits. The lowest hit index is the root
+  void unite(unsigned int, unsigned int);
+
+  //! number the clusters and group hits per cluster. Returns the number of clusters
+  unsigned int make_clusters();
+
+  //! number of clusters found by the last call to make_clusters
+  unsigned int nclusters() const { return m_offsets.empty() ? 0 : m_offsets.size() - 1; }
+
+  //! indices in the input of the hits of a given cluster
+  std::pair<const unsigned int *, const unsigned int *> cluster(unsigned int clusid) const
+  {
+    return std::make_pair(m_order.data() + m_offsets[clusid], m_order.data() + m_offsets[clusid + 1]);
+  }
+
+  //! cluster of each input hit
+  const std::vector<unsigned int> &cluster_ids() const { return m_clusterid; }
+
+ private:
+  //! union-find parent of each hit
+  std::vector<unsigned int> m_parent;
+
+  //! cluster id of each root hit
+  std::vector<unsigned int> m_rootid;
+
+  std::vector<unsigned int> m_clusterid;
+
+  //! hits grouped per cluster, cluster i spans [m_offsets[i], m_offsets[i+1])
+  std::vector<unsigned int> m_order;
+  std::vector<std::size_t> m_offsets;
+};
+
+#endif  // TRACKBASE_TRKRHITUNIONFIND_H
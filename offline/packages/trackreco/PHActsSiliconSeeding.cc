@@ -339,7 +339,7 @@ void PHActsSiliconSeeding::makeSvtxTracksWithTime(const GridSeeds& seedVector,
       {
         const auto& cluskey = spacePoint->Id();
 
-        auto globalPosition = m_tGeometry->getGlobalPosition(
+        auto globalPosition = getGlobalPosition(
             cluskey,
             m_clusterMap->findCluster(cluskey));
         if (m_seedAnalysis)
@@ -388,7 +388,7 @@ void PHActsSiliconSeeding::makeSvtxTracksWithTime(const GridSeeds& seedVector,
           for (auto& intt_clus : intt_clus_vec)
           {
             trackSeed->insert_cluster_key(intt_clus);
-            positions.insert(std::make_pair(intt_clus, m_tGeometry->getGlobalPosition(
+            positions.insert(std::make_pair(intt_clus, getGlobalPosition(
                                                            intt_clus,
                                                            m_clusterMap->findCluster(intt_clus))));
           }
@@ -464,7 +464,7 @@ void PHActsSiliconSeeding::makeSvtxTracks(const GridSeeds& seedVector)
         cluster_keys.push_back(cluskey);
 
         trackSeed->insert_cluster_key(cluskey);
-        auto globalPosition = m_tGeometry->getGlobalPosition(
+        auto globalPosition = getGlobalPosition(
             cluskey,
             m_clusterMap->findCluster(cluskey));
         globalPositions.push_back(globalPosition);
@@ -769,7 +769,7 @@ std::vector<short int> PHActsSiliconSeeding::getInttCrossings(TrackSeed& si_trac
           continue;
         }
 
-        Acts::Vector3 global = m_tGeometry->getGlobalPosition(cluster_key, cluster);
+        Acts::Vector3 global = getGlobalPosition(cluster_key, cluster);
 
         std::cout << "Checking  si Track with cluster " << cluster_key
                   << " in layer " << layer << " position " << global(0) << "  " << global(1) << "  " << global(2)
@@ -955,7 +955,7 @@ std::vector<TrkrDefs::cluskey> PHActsSiliconSeeding::findMatches(
           }
           int newstrobe = MvtxDefs::getStrobeId(cluskey);
           auto* const cluster = clusIter->second;
-          auto glob = m_tGeometry->getGlobalPosition(
+          auto glob = getGlobalPosition(
               cluskey, cluster);
           auto intersection = TrackFitUtils::get_helix_surface_intersection(surf, fitpars, glob, m_tGeometry);
           if (!dummypars.empty())
@@ -977,7 +977,7 @@ std::vector<TrkrDefs::cluskey> PHActsSiliconSeeding::findMatches(
           /// Diagnostic
           if (m_seedAnalysis)
           {
-            const auto globalP = m_tGeometry->getGlobalPosition(
+            const auto globalP = getGlobalPosition(
                 cluskey, cluster);
             m_clusgx = globalP.x();
             m_clusgy = globalP.y();
@@ -1108,7 +1108,7 @@ std::vector<std::vector<TrkrDefs::cluskey>> PHActsSiliconSeeding::findMatchesWit
     for (auto& key : seed)
     {
       keys.push_back(key);
-      clusters.push_back(m_tGeometry->getGlobalPosition(
+      clusters.push_back(getGlobalPosition(
           key,
           m_clusterMap->findCluster(key)));
     }
@@ -1262,7 +1262,7 @@ std::vector<std::vector<TrkrDefs::cluskey>> PHActsSiliconSeeding::iterateLayers(
         }
 
         auto* const cluster = clusIter->second;
-        auto glob = m_tGeometry->getGlobalPosition(
+        auto glob = getGlobalPosition(
             cluskey, cluster);
         auto intersection = TrackFitUtils::get_helix_surface_intersection(surf, fitpars, glob, m_tGeometry);
         auto local = (surf->transform(m_tGeometry->geometry().getGeoContext())).inverse() * (intersection * Acts::UnitConstants::cm);
@@ -1279,7 +1279,7 @@ std::vector<std::vector<TrkrDefs::cluskey>> PHActsSiliconSeeding::iterateLayers(
         m_projlz = local.y();
         if (m_seedAnalysis)
         {
-          const auto globalP = m_tGeometry->getGlobalPosition(
+          const auto globalP = getGlobalPosition(
               cluskey, cluster);
           m_clusgx = globalP.x();
           m_clusgy = globalP.y();
@@ -1556,6 +1556,12 @@ void PHActsSiliconSeeding::configureSeeder()
   m_seedFinderOptions = m_seedFinderOptions.toInternalUnits().calculateDerivedQuantities(m_seedFinderCfg);
 }
 
+Acts::Vector3 PHActsSiliconSeeding::getGlobalPosition(TrkrDefs::cluskey key, TrkrCluster* cluster) const
+{
+  // silicon clusters get no crossing nor distortion correction
+  return m_globalPositionWrapper.getGlobalPositionDistortionCorrected(key, cluster, 0);
+}
+
 int PHActsSiliconSeeding::getNodes(PHCompositeNode* topNode)
 {
   _cluster_crossing_map = findNode::getClass<TrkrClusterCrossingAssoc>(topNode, "TRKR_CLUSTERCROSSINGASSOC");
@@ -1589,6 +1595,8 @@ int PHActsSiliconSeeding::getNodes(PHCompositeNode* topNode)
     return Fun4AllReturnCodes::ABORTEVENT;
   }
 
+  m_globalPositionWrapper.loadNodes(topNode);
+
   if (m_useTruthClusters)
   {
     m_clusterMap = findNode::getClass<TrkrClusterContainer>(topNode,
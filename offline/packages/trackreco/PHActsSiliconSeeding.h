@@ -16,6 +16,8 @@
 
 #include <trackbase/SpacePoint.h>
 
+#include <tpc/TpcGlobalPositionWrapper.h>
+
 #include <TFile.h>
 #include <TH1.h>
 #include <TH2.h>
@@ -199,6 +201,9 @@ class PHActsSiliconSeeding : public SubsysReco
  private:
   int getNodes(PHCompositeNode *topNode);
   int createNodes(PHCompositeNode *topNode);
+
+  /// cluster global position, from the per event cache when available
+  Acts::Vector3 getGlobalPosition(TrkrDefs::cluskey, TrkrCluster *) const;
   
   int m_strobeLowWindow = -1;
   int m_strobeHighWindow = 2;
@@ -281,6 +286,10 @@ class PHActsSiliconSeeding : public SubsysReco
   float m_cluslz = std::numeric_limits<float>::quiet_NaN();
 
   ActsGeometry *m_tGeometry = nullptr;
+
+  /// global position wrapper, gives access to the cluster position cache
+  TpcGlobalPositionWrapper m_globalPositionWrapper;
+
   TrackSeedContainer *m_seedContainer = nullptr;
   TrkrClusterContainer *m_clusterMap = nullptr;
   PHG4CylinderGeomContainer *m_geomContainerIntt = nullptr;
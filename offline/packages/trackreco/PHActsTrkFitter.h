@@ -31,10 +31,12 @@
 #include <TH2.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 class alignmentTransformationContainer;
 class ActsGeometry;
 class SvtxTrack;
+class SvtxTrack_v4;
 class SvtxTrackMap;
 class TrackSeed;
 class TrackSeedContainer;
@@ -145,6 +147,10 @@ class PHActsTrkFitter : public SubsysReco
   void setTrkrClusterContainerName(const std::string& name) { m_clusterContainerName = name; }
   void setDirectNavigation(bool flag) { m_directNavigation = flag; }
   void setClusterEdgeRejection(int edge ) { m_cluster_edge_rejection = edge; }
+
+  /// number of threads used to fit the seeds
+  void set_num_threads(int value) { m_num_threads = value; }
+
  private:
   /// Get all the nodes
   int getNodes(PHCompositeNode* topNode);
@@ -154,6 +160,16 @@ class PHActsTrkFitter : public SubsysReco
 
   void loopTracks(Acts::Logging::Level logLevel);
 
+  /// Fit one seed with given fitter functions, trying several crossings if needed.
+  /// Returns true if a fitted track was stored in fitted, counts failed fits in nBadFits.
+  /// directed is set if the track goes to the SC calibration track map
+  bool fitSeed(TrackSeed* track,
+               const ActsTrackFittingAlgorithm::Config& fitCfg,
+               SvtxTrack_v4& fitted, bool& directed, int& nBadFits);
+
+  /// Insert a fitted track in the SC calibration track map if directed, in the output map otherwise
+  void insertTrack(const SvtxTrack_v4& track, bool directed);
+
   /// Convert the acts track fit result to an svtx track
   void updateSvtxTrack(
       const std::vector<Acts::MultiTrajectoryTraits::IndexType>& tips,
@@ -169,7 +185,8 @@ class PHActsTrkFitter : public SubsysReco
     const ActsTrackFittingAlgorithm::GeneralFitterOptions& kfOptions,
     const SurfacePtrVec& surfSequence,
     const CalibratorAdapter& calibrator,
-    ActsTrackFittingAlgorithm::TrackContainer& tracks);
+    ActsTrackFittingAlgorithm::TrackContainer& tracks,
+    const ActsTrackFittingAlgorithm::Config& fitCfg);
 
   // remove all source links for detectors that we don't want to include in the fit
   SourceLinkVec filterSourceLinks(const SourceLinkVec& sourceLinks ) const;
@@ -194,8 +211,18 @@ class PHActsTrkFitter : public SubsysReco
   /// Options that Acts::Fitter needs to run from MakeActsGeometry
   ActsGeometry* m_tGeometry = nullptr;
 
-  /// Configuration containing the fitting function instance
-  ActsTrackFittingAlgorithm::Config m_fitCfg;
+  /// Configurations containing the fitting function instances, one per fitting thread
+  std::vector<ActsTrackFittingAlgorithm::Config> m_fitCfg;
+
+  /**
+   * number of fitting threads. Default is 1, seeds are fitted serially.
+   * 0 allocates as many threads as available on the host.
+   * The evaluator, commissioning, time analysis, outlier finder
+   * and transient transforms (no cluster mover) force serial fitting.
+   * Fitted tracks are inserted in seed order, so the track maps are
+   * identical to the serial fit for any number of threads
+   */
+  int m_num_threads = 1;
 
   /// TrackMap containing SvtxTracks
   alignmentTransformationContainer* m_alignmentTransformationMap = nullptr;  // added for testing purposes
@@ -209,9 +209,19 @@ int PHCASeeding::InitializeGeometry(PHCompositeNode* topNode)
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
-Acts::Vector3 PHCASeeding::getGlobalPosition(TrkrDefs::cluskey key, TrkrCluster* cluster) const
+void PHCASeeding::getGlobalPositions(const TpcGlobalPositionWrapper::ClusterList& clusters, std::vector<Acts::Vector3>& positions) const
 {
-  return _pp_mode ? m_tGeometry->getGlobalPosition(key, cluster) : m_globalPositionWrapper.getGlobalPositionDistortionCorrected(key, cluster, 0);
+  if (_pp_mode)
+  {
+    positions.clear();
+    for (const auto& [key, cluster] : clusters)
+    {
+      positions.push_back(m_tGeometry->getGlobalPosition(key, cluster));
+    }
+    return;
+  }
+
+  m_globalPositionWrapper.getGlobalPositionsDistortionCorrected(clusters, 0, positions);
 }
 
 void PHCASeeding::QueryTree(const bgi::rtree<PHCASeeding::pointKey, bgi::quadratic<16>>& rtree, double phimin, double z_min, double phimax, double z_max, std::vector<pointKey>& returned_values) const
@@ -244,8 +254,13 @@ std::pair<PHCASeeding::PositionMap, PHCASeeding::keyListPerLayer> PHCASeeding::F
   PositionMap cachedPositions;
   cachedPositions.reserve(_cluster_map->size());  // avoid resizing mid-execution
 
+  // selected clusters of a hitset and their global positions
+  TpcGlobalPositionWrapper::ClusterList clusters;
+  std::vector<Acts::Vector3> positions;
+
   for (const auto& hitsetkey : _cluster_map->getHitSetKeys(TrkrDefs::TrkrId::tpcId))
   {
+    clusters.clear();
     auto range = _cluster_map->getClusters(hitsetkey);
     for (auto clusIter = range.first; clusIter != range.second; ++clusIter)
     {
@@ -272,12 +287,17 @@ std::pair<PHCASeeding::PositionMap, PHCASeeding::keyListPerLayer> PHCASeeding::F
         }
       }
 
-      // get global position, convert to Acts::Vector3 and store in map
-      const Acts::Vector3 globalpos_d = getGlobalPosition(ckey, cluster);
-      const Acts::Vector3 globalpos = {globalpos_d.x(), globalpos_d.y(), globalpos_d.z()};
-      cachedPositions.insert(std::make_pair(ckey, globalpos));
+      clusters.emplace_back(ckey, cluster);
+    }
+
+    // get global positions of the hitset at once and store in map
+    getGlobalPositions(clusters, positions);
+    for (size_t i = 0; i < clusters.size(); ++i)
+    {
+      const TrkrDefs::cluskey ckey = clusters[i].first;
+      cachedPositions.insert(std::make_pair(ckey, positions[i]));
 
-      ckeys[layer - _FIRST_LAYER_TPC].push_back(ckey);
+      ckeys[TrkrDefs::getLayer(ckey) - _FIRST_LAYER_TPC].push_back(ckey);
       fill_tuple(_tupclus_all, 0, ckey, cachedPositions.at(ckey));
     }
   }
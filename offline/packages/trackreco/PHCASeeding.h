@@ -215,12 +215,12 @@ class PHCASeeding : public PHTrackSeeding
   /// tpc distortion correction utility class
   TpcDistortionCorrection m_distortionCorrection;
 
-  /// get global position for a given cluster
+  /// get global positions for a list of clusters from the same hitset
   /**
    * uses ActsTransformation to convert cluster local position into global coordinates
-   * incorporates TPC distortion correction, if present
+   * incorporates TPC distortion correction, if present, applied to all clusters at once
    */
-  Acts::Vector3 getGlobalPosition(TrkrDefs::cluskey, TrkrCluster*) const;
+  void getGlobalPositions(const TpcGlobalPositionWrapper::ClusterList&, std::vector<Acts::Vector3>&) const;
   std::pair<PositionMap, keyListPerLayer> FillGlobalPositions();
   std::pair<keyLinks, keyLinkPerLayer> CreateBiLinks(const PositionMap& globalPositions, const keyListPerLayer& ckeys);
   PHCASeeding::keyLists FollowBiLinks(const keyLinks& trackSeedPairs, const keyLinkPerLayer& bilinks, const PositionMap& globalPositions) const;
@@ -13,11 +13,11 @@
 #include <trackbase_historic/TrackSeedContainer.h>
 #include <trackbase_historic/TrackSeedHelper.h>
 
-#include <cmath>     // for sqrt, fabs, atan2, cos
-#include <iostream>  // for operator<<, basic_ostream
-#include <map>       // for map
-#include <set>       // for _Rb_tree_const_iterator
-#include <utility>   // for pair, make_pair
+#include <algorithm>  // for sort, find_if, min, max
+#include <cmath>      // for sqrt, fabs, atan2, cos
+#include <iostream>   // for operator<<, basic_ostream
+#include <utility>    // for pair, make_pair
+#include <vector>     // for vector
 
 //____________________________________________________________________________..
 bool PHGhostRejection::cut_from_clusters(int itrack) {
@@ -102,54 +102,77 @@ void PHGhostRejection::find_ghosts(const std::vector<float>& trackChi2)
   }
 
   // Elimate low-interest track, and try to eliminate repeated tracks
-  std::set<unsigned int> matches_set;
-  std::multimap<unsigned int, unsigned int> matches;
-  for (size_t trid1 = 0; trid1 < seeds.size(); ++trid1)
+  // seed parameters used in the cuts, computed once per seed
+  std::vector<float> eta(seeds.size(), 0);
+  std::vector<Acts::Vector3> position(seeds.size(), Acts::Vector3::Zero());
+
+  // candidate pairs come from a sweep over the seeds sorted by eta: each seed is
+  // only compared to the following seeds that are within the eta cut
+  std::vector<unsigned int> sorted;
+  sorted.reserve(seeds.size());
+  for (unsigned int trid = 0; trid < seeds.size(); ++trid)
   {
-    if (m_rejected[trid1]) { continue; }
-    const auto& track1 = seeds[trid1];
-    const float track1phi = track1.get_phi();
+    if (m_rejected[trid]) { continue; }
+    eta[trid] = seeds[trid].get_eta();
+    position[trid] = TrackSeedHelper::get_xyz(&seeds[trid]);
+
+    // a nan eta never passes the eta cut
+    if (std::isnan(eta[trid])) { continue; }
+    sorted.push_back(trid);
+  }
+  std::sort(sorted.begin(), sorted.end(), [&eta](unsigned int lhs, unsigned int rhs)
+            { return eta[lhs] < eta[rhs]; });
 
-    const auto track1_pos = TrackSeedHelper::get_xyz(&track1);
-    const float track1eta = track1.get_eta();
-    for (size_t trid2 = trid1+1; trid2 < seeds.size(); ++trid2)
+  // pairs of matching seeds (trid1, trid2), with trid1 < trid2
+  std::vector<std::pair<unsigned int, unsigned int>> matches;
+  for (auto iter1 = sorted.begin(); iter1 != sorted.end(); ++iter1)
+  {
+    for (auto iter2 = iter1 + 1; iter2 != sorted.end(); ++iter2)
     {
-      if (m_rejected[trid2])
-      {
-        continue;
-      }
+      // eta differences only increase from here
+      if (!(eta[*iter2] - eta[*iter1] < _eta_cut)) { break; }
 
-      const auto& track2 = seeds[trid2];
-      const auto track2_pos = TrackSeedHelper::get_xyz(&track2);
-      const float track2eta = track2.get_eta();
-      auto delta_phi = std::abs(track1phi - track2.get_phi());
+      // same cuts, in the same order, as when comparing all pairs
+      const auto trid1 = std::min(*iter1, *iter2);
+      const auto trid2 = std::max(*iter1, *iter2);
+      auto delta_phi = std::abs(seeds[trid1].get_phi() - seeds[trid2].get_phi());
 
       if (delta_phi > 2 * M_PI) {
         delta_phi = delta_phi - 2*M_PI;
       }
       if (delta_phi < _phi_cut &&
-          std::abs(track1eta - track2eta) < _eta_cut &&
-          std::abs(track1_pos.x() - track2_pos.x()) < _x_cut &&
-          std::abs(track1_pos.y() - track2_pos.y()) < _y_cut &&
-          std::abs(track1_pos.z() - track2_pos.z()) < _z_cut)
+          std::abs(eta[trid1] - eta[trid2]) < _eta_cut &&
+          std::abs(position[trid1].x() - position[trid2].x()) < _x_cut &&
+          std::abs(position[trid1].y() - position[trid2].y()) < _y_cut &&
+          std::abs(position[trid1].z() - position[trid2].z()) < _z_cut)
       {
-        matches_set.insert(trid1);
-        matches.insert(std::pair(trid1, trid2));
-
-        if (m_verbosity > 1)
-        {
-          std::cout << "Found match for tracks " << trid1 << " and " << trid2 << std::endl;
-        }
+        matches.emplace_back(trid1, trid2);
       }
     }
   }
 
-  for (auto set_it : matches_set)
+  // process the pairs in seed order
+  std::sort(matches.begin(), matches.end());
+  if (m_verbosity > 1)
   {
+    for (const auto& [trid1, trid2] : matches)
+    {
+      std::cout << "Found match for tracks " << trid1 << " and " << trid2 << std::endl;
+    }
+  }
+
+  for (auto match_begin = matches.begin(); match_begin != matches.end();)
+  {
+    // all matches of the same first seed
+    const auto set_it = match_begin->first;
+    const auto match_end = std::find_if(match_begin, matches.end(), [set_it](const auto& match)
+                                        { return match.first != set_it; });
+    const auto match_list = std::make_pair(match_begin, match_end);
+    match_begin = match_end;
+
     if (m_rejected[set_it]) { continue; } // already rejected
-    auto match_list = matches.equal_range(set_it);
 
-    auto tr1 = seeds[set_it];
+    const auto& tr1 = seeds[set_it];
     double best_qual = trackChi2.at(set_it);
     unsigned int best_track = set_it;
 
@@ -165,7 +188,7 @@ void PHGhostRejection::find_ghosts(const std::vector<float>& trackChi2)
         std::cout << "    match of track " << it->first << " to track " << it->second << std::endl;
       }
 
-      auto tr2 = seeds[it->second];
+      const auto& tr2 = seeds[it->second];
 
       // Check that these two tracks actually share the same clusters, if not skip this pair
       bool is_same_track = checkClusterSharing(tr1, tr2);
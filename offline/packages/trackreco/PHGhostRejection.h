@@ -44,6 +44,7 @@ class PHGhostRejection
 
   // cut on the ghosts: note that this also ignores all seeds failing
   // ``cut_from_clusters'' and uses the pt_cut
+  // candidate pairs are found by a sweep over the seeds sorted by eta
   void find_ghosts(const std::vector<float>& trackChi2);
   bool is_rejected(int itrack) const { return m_rejected[itrack]; };
 
@@ -32,15 +32,36 @@
 #include <TFile.h>
 #include <TNtuple.h>
 
+#include <algorithm>  // for clamp, min, max, sort
 #include <climits>   // for UINT_MAX
 #include <cmath>     // for fabs, sqrt
 #include <iostream>  // for operator<<, basic_ostream
 #include <memory>
+#include <numeric>  // for iota, partial_sum
 #include <set>      // for _Rb_tree_const_iterator
 #include <utility>  // for pair
 
 using namespace std;
 
+namespace
+{
+  // eta-phi grid of the silicon seeds. Eta cells are about the size of the eta window at high pT,
+  // phi cells about a third of the phi window
+  constexpr double grid_eta_step = 0.05;
+  constexpr int grid_neta_max = 1000;
+  constexpr int grid_nphi = 64;
+
+  // grid cells are selected from windows enlarged by this margin, much larger than rounding errors.
+  // The windows themselves are then checked exactly as when looping over all seeds
+  constexpr double grid_margin = 1e-6;
+
+  // phi in [0, 2pi)
+  inline double wrap_phi(double phi)
+  {
+    return phi - 2 * M_PI * std::floor(phi / (2 * M_PI));
+  }
+}  // namespace
+
 //____________________________________________________________________________..
 PHSiliconTpcTrackMatching::PHSiliconTpcTrackMatching(const std::string &name)
   : SubsysReco(name)
@@ -174,6 +195,20 @@ bool PHSiliconTpcTrackMatching::WindowMatcher::in_window
   }
 }
 
+std::pair<double, double> PHSiliconTpcTrackMatching::WindowMatcher::range
+(const bool posQ, const double tpc_pt)
+{
+  if (posQ) {
+    double pt = (tpc_pt<min_pt_posQ) ? min_pt_posQ : tpc_pt;
+    const double hi = fn_exp(posHi, posHi_b0, pt);
+    return std::make_pair(fabs_max_posQ ? -hi : fn_exp(posLo, posLo_b0, pt), hi);
+  } else {
+    double pt = (tpc_pt<min_pt_negQ) ? min_pt_negQ : tpc_pt;
+    const double hi = fn_exp(negHi, negHi_b0, pt);
+    return std::make_pair(fabs_max_negQ ? -hi : fn_exp(negLo, negLo_b0, pt), hi);
+  }
+}
+
 //____________________________________________________________________________..
 int PHSiliconTpcTrackMatching::process_event(PHCompositeNode * /*unused*/)
 {
@@ -462,11 +497,152 @@ int PHSiliconTpcTrackMatching::GetNodes(PHCompositeNode *topNode)
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
+void PHSiliconTpcTrackMatching::fillSiliconSeedGrid()
+{
+  // silicon seed parameters
+  _si_params.assign(_track_map_silicon->size(), SiliconSeedParameters());
+  for (unsigned int siid = 0; siid < _track_map_silicon->size(); ++siid)
+  {
+    auto *tracklet_si = _track_map_silicon->get(siid);
+    if (!tracklet_si)
+    {
+      continue;
+    }
+
+    auto &params = _si_params[siid];
+    if (_zero_field) {
+      auto cluster_list = getTrackletClusterList(tracklet_si);
+
+      Acts::Vector3  mom;
+      double si_pt;
+
+      std::tie(params.valid, params.phi, params.eta, si_pt, params.pos, mom) =
+        TrackFitUtils::zero_field_track_params(_tGeometry, _cluster_map, cluster_list);
+      params.px = mom.x();
+      params.py = mom.y();
+      params.pz = mom.z();
+      params.q = -100;
+    } else {
+      params.valid = true;
+      params.eta = tracklet_si->get_eta();
+      params.phi = tracklet_si->get_phi();
+
+      params.pos = TrackSeedHelper::get_xyz(tracklet_si);
+      params.px = tracklet_si->get_px();
+      params.py = tracklet_si->get_py();
+      params.pz = tracklet_si->get_pz();
+      params.q = tracklet_si->get_charge();
+    }
+  }
+
+  // seeds with a non finite eta or phi fail the window checks, they are left out of the grid
+  std::vector<unsigned int> seeds;
+  double eta_max = 0;
+  _grid_eta_min = 0;
+  for (unsigned int siid = 0; siid < _si_params.size(); ++siid)
+  {
+    const auto &params = _si_params[siid];
+    if (!params.valid || !std::isfinite(params.eta) || !std::isfinite(params.phi))
+    {
+      continue;
+    }
+    if (seeds.empty())
+    {
+      _grid_eta_min = eta_max = params.eta;
+    }
+    _grid_eta_min = std::min(_grid_eta_min, params.eta);
+    eta_max = std::max(eta_max, params.eta);
+    seeds.push_back(siid);
+  }
+
+  _grid_neta = std::clamp(std::ceil((eta_max - _grid_eta_min) / grid_eta_step), 1., double(grid_neta_max));
+  _grid_eta_step = std::max((eta_max - _grid_eta_min) / _grid_neta, grid_eta_step);
+  _grid_nphi = grid_nphi;
+
+  // counting sort of the seeds per cell. Seeds of a cell stay in increasing id order
+  std::vector<unsigned int> cells;
+  cells.reserve(seeds.size());
+  _grid_offsets.assign(_grid_neta * _grid_nphi + 1, 0);
+  for (const auto siid : seeds)
+  {
+    const auto &params = _si_params[siid];
+    const int ieta = std::min<int>((params.eta - _grid_eta_min) / _grid_eta_step, _grid_neta - 1);
+    const int iphi = std::min<int>(wrap_phi(params.phi) / (2 * M_PI) * _grid_nphi, _grid_nphi - 1);
+    cells.push_back(ieta * _grid_nphi + iphi);
+    ++_grid_offsets[cells.back() + 1];
+  }
+  std::partial_sum(_grid_offsets.begin(), _grid_offsets.end(), _grid_offsets.begin());
+
+  _grid_seeds.resize(seeds.size());
+  auto fill = _grid_offsets;
+  for (std::size_t i = 0; i < seeds.size(); ++i)
+  {
+    _grid_seeds[fill[cells[i]]++] = seeds[i];
+  }
+}
+
+void PHSiliconTpcTrackMatching::findSiliconCandidates(
+    bool posQ, double tpc_pt, double tpc_eta, double tpc_phi,
+    std::vector<unsigned int> &candidates)
+{
+  candidates.clear();
+
+  // eta: window, or within _deltaeta_min. fmin and fmax ignore a nan window
+  const auto [deta_lo, deta_hi] = window_deta.range(posQ, tpc_pt);
+  const double eta_lo = std::fmin(tpc_eta - deta_hi, tpc_eta - _deltaeta_min) - grid_margin;
+  const double eta_hi = std::fmax(tpc_eta - deta_lo, tpc_eta + _deltaeta_min) + grid_margin;
+
+  // phi: window, modulo 2pi
+  const auto [dphi_lo, dphi_hi] = window_dphi.range(posQ, tpc_pt);
+  const double phi_lo = tpc_phi - dphi_hi - grid_margin;
+  const double phi_hi = tpc_phi - dphi_lo + grid_margin;
+
+  // no silicon seed can match a non finite TPC eta or phi, or nan or empty windows
+  if (!std::isfinite(tpc_eta) || !std::isfinite(tpc_phi) || !(eta_lo <= eta_hi) || !(phi_lo <= phi_hi))
+  {
+    return;
+  }
+
+  // eta cells, clamped to the grid
+  const double ieta_lo = std::max(std::floor((eta_lo - _grid_eta_min) / _grid_eta_step), 0.);
+  const double ieta_hi = std::min(std::floor((eta_hi - _grid_eta_min) / _grid_eta_step), _grid_neta - 1.);
+  if (ieta_lo > ieta_hi)
+  {
+    return;
+  }
+
+  // phi cells, unwrapped. All cells if the window spans the full circle
+  double iphi_lo = 0;
+  double iphi_hi = _grid_nphi - 1;
+  if (phi_hi - phi_lo < 2 * M_PI)
+  {
+    iphi_lo = std::floor(phi_lo / (2 * M_PI) * _grid_nphi);
+    iphi_hi = std::min(std::floor(phi_hi / (2 * M_PI) * _grid_nphi), iphi_lo + _grid_nphi - 1);
+  }
+
+  for (int ieta = ieta_lo; ieta <= ieta_hi; ++ieta)
+  {
+    for (double iphi_unwrapped = iphi_lo; iphi_unwrapped <= iphi_hi; ++iphi_unwrapped)
+    {
+      const int iphi = iphi_unwrapped - _grid_nphi * std::floor(iphi_unwrapped / _grid_nphi);
+      const int cell = ieta * _grid_nphi + iphi;
+      candidates.insert(candidates.end(), _grid_seeds.begin() + _grid_offsets[cell], _grid_seeds.begin() + _grid_offsets[cell + 1]);
+    }
+  }
+
+  // same order as when looping over all silicon seeds
+  std::sort(candidates.begin(), candidates.end());
+}
+
 void PHSiliconTpcTrackMatching::findEtaPhiMatches(
     std::set<unsigned int> &tpc_matched_set,
     std::set<unsigned int> &tpc_unmatched_set,
     std::multimap<unsigned int, unsigned int> &tpc_matches)
 {
+  // silicon seed parameters and eta-phi grid, computed once for all TPC seeds
+  fillSiliconSeedGrid();
+  std::vector<unsigned int> candidates;
+
   // loop over the TPC track seeds
   for (unsigned int phtrk_iter = 0;
        phtrk_iter < _track_map->size();
@@ -537,47 +713,35 @@ void PHSiliconTpcTrackMatching::findEtaPhiMatches(
 
     bool matched = false;
 
+    // silicon seeds to check: all of them when filling the test ntuple, otherwise those from the grid cells overlapping the eta and phi windows
+    if (_test_windows)
+    {
+      candidates.resize(_si_params.size());
+      std::iota(candidates.begin(), candidates.end(), 0);
+    }
+    else
+    {
+      findSiliconCandidates(is_posQ, tpc_pt, tpc_eta, tpc_phi, candidates);
+    }
+
     // Now search the silicon track list for a match in eta and phi
-    for (unsigned int phtrk_iter_si = 0;
-         phtrk_iter_si < _track_map_silicon->size();
-         ++phtrk_iter_si)
+    for (const auto siid : candidates)
     {
-      _tracklet_si = _track_map_silicon->get(phtrk_iter_si);
-      if (!_tracklet_si)
+      const auto &si_params = _si_params[siid];
+      if (!si_params.valid)
       {
-
         continue;
       }
 
-      double si_phi, si_eta, si_pt;
-      float si_px, si_py, si_pz;
-      int si_q;
-      Acts::Vector3 si_pos;
-      if (_zero_field) {
-      auto cluster_list = getTrackletClusterList(_tracklet_si);
-
-      Acts::Vector3  mom;
-      bool ok_track;
-
-      std::tie(ok_track, si_phi, si_eta, si_pt, si_pos, mom) =
-        TrackFitUtils::zero_field_track_params(_tGeometry, _cluster_map, cluster_list);
-      if (!ok_track) { continue; }
-        si_px = mom.x();
-        si_py = mom.y();
-        si_pz = mom.z();
-        si_q = -100;
-      } else {
-        si_eta = _tracklet_si->get_eta();
-        si_phi = _tracklet_si->get_phi();
-
-        si_pos = TrackSeedHelper::get_xyz(_tracklet_si);
-        si_px = _tracklet_si->get_px();
-        si_py = _tracklet_si->get_py();
-        si_pz = _tracklet_si->get_pz();
-        si_q = _tracklet_si->get_charge();
-      }
+      _tracklet_si = _track_map_silicon->get(siid);
+      const double si_phi = si_params.phi;
+      const double si_eta = si_params.eta;
+      const float si_px = si_params.px;
+      const float si_py = si_params.py;
+      const float si_pz = si_params.pz;
+      const int si_q = si_params.q;
+      const Acts::Vector3 &si_pos = si_params.pos;
       int si_crossing = _tracklet_si->get_crossing();
-      unsigned int siid = phtrk_iter_si;
 
       if(_test_windows)
       {
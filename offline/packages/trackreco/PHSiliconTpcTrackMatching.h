@@ -8,8 +8,12 @@
 #include <tpc/TpcClusterZCrossingCorrection.h>
 #include <trackbase/ActsGeometry.h>
 
+#include <Acts/Definitions/Algebra.hpp>
+
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 class PHCompositeNode;
 class TrackSeedContainer;
@@ -86,6 +90,9 @@ class PHSiliconTpcTrackMatching : public SubsysReco, public PHParameterInterface
 
     bool in_window(bool posQ, const double tpc_pt, const double tpc_X, const double si_X);
 
+    // (lo, hi) range of tpc_X-si_X accepted by in_window
+    std::pair<double, double> range(bool posQ, const double tpc_pt);
+
     // initialize to fn_lo < deltaX < fn_hi for +Q, and fn_lo < deltaX < fn_hi for -Q
 
     void reset_fns() {
@@ -161,6 +168,13 @@ class PHSiliconTpcTrackMatching : public SubsysReco, public PHParameterInterface
   void findEtaPhiMatches(std::set<unsigned int> &tpc_matched_set,
                          std::set<unsigned int> &tpc_unmatched_set,
                          std::multimap<unsigned int, unsigned int> &tpc_matches);
+
+  // compute the silicon seed parameters and bin the silicon seeds in eta and phi
+  void fillSiliconSeedGrid();
+
+  // silicon seeds, in increasing id order, that can be in the eta and phi windows of a TPC seed
+  void findSiliconCandidates(bool posQ, double tpc_pt, double tpc_eta, double tpc_phi,
+                             std::vector<unsigned int> &candidates);
   std::vector<short int> getInttCrossings(TrackSeed *si_track);
   void checkZMatches(std::multimap<unsigned int, unsigned int> &tpc_matches,
 		     std::multimap<unsigned int, unsigned int> &bad_map);
@@ -216,6 +230,32 @@ class PHSiliconTpcTrackMatching : public SubsysReco, public PHParameterInterface
   std::string _cluster_map_name = "TRKR_CLUSTER";
   std::string m_fieldMap = "1.4";
   std::vector<TrkrDefs::cluskey> getTrackletClusterList(TrackSeed* tracklet);
+
+  // silicon seed parameters used in the eta-phi matching, computed once per event
+  struct SiliconSeedParameters
+  {
+    // false for missing seeds, and failed zero field fits
+    bool valid = false;
+    double phi = 0;
+    double eta = 0;
+    Acts::Vector3 pos = Acts::Vector3::Zero();
+    float px = 0;
+    float py = 0;
+    float pz = 0;
+    int q = 0;
+  };
+
+  // silicon seed parameters, indexed by silicon seed id
+  std::vector<SiliconSeedParameters> _si_params;
+
+  // silicon seeds binned in eta and phi. Cell (ieta, iphi) spans
+  // [_grid_offsets[i], _grid_offsets[i+1]) in _grid_seeds, with i = ieta*_grid_nphi+iphi
+  std::vector<unsigned int> _grid_seeds;
+  std::vector<unsigned int> _grid_offsets;
+  double _grid_eta_min = 0;
+  double _grid_eta_step = 1;
+  int _grid_neta = 0;
+  int _grid_nphi = 0;
 };
 
 #endif  //  PHSILICONTPCTRACKMATCHING_H
@@ -0,0 +1,273 @@
+/*!
+ * \file TrkrClusterCompressor.cc
+ * \brief store the clusters on the DST with lossy compressed positions and errors
+ */
+
+#include "TrkrClusterCompressor.h"
+
+#include <fun4all/Fun4AllDstOutputManager.h>
+#include <fun4all/Fun4AllReturnCodes.h>
+#include <fun4all/Fun4AllServer.h>
+#include <phool/PHCompositeNode.h>
+#include <phool/PHIODataNode.h>
+#include <phool/PHNodeIterator.h>
+#include <phool/getClass.h>
+#include <phool/phool.h>
+#include <trackbase/TrkrCluster.h>
+#include <trackbase/TrkrClusterCompressionDictv1.h>
+#include <trackbase/TrkrClusterContainer.h>
+#include <trackbase/TrkrClusterContainerv6.h>
+
+// the compressor package defines its functions in the header, it must be included in a single source file
+#include <compressclus/compressor.h>
+
+#include <TTree.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+//_____________________________________________________________________
+TrkrClusterCompressor::TrkrClusterCompressor(const std::string& name)
+  : SubsysReco(name)
+{
+  // default maximum errors, in cm, except for the TPC local y, which is a time in ns.
+  // Well below the detector resolutions
+  m_max_error[TrkrDefs::mvtxId] = {0.5e-4, 0.5e-4, 0.05e-4, 0.05e-4};
+  m_max_error[TrkrDefs::inttId] = {2e-4, 10e-4, 1e-4, 1e-4};
+  m_max_error[TrkrDefs::tpcId] = {10e-4, 0.1, 2e-4, 2e-4};
+  m_max_error[TrkrDefs::micromegasId] = {10e-4, 10e-4, 2e-4, 2e-4};
+}
+
+//_____________________________________________________________________
+int TrkrClusterCompressor::Init(PHCompositeNode* topNode)
+{
+  PHNodeIterator iter(topNode);
+
+  // dictionary, on the RUN node
+  auto runNode = dynamic_cast<PHCompositeNode*>(iter.findFirst("PHCompositeNode", "RUN"));
+  if (!runNode)
+  {
+    std::cout << "TrkrClusterCompressor::Init - RUN Node missing" << std::endl;
+    return Fun4AllReturnCodes::ABORTRUN;
+  }
+
+  m_dict = findNode::getClass<TrkrClusterCompressionDict>(runNode, "TRKR_CLUSTER_COMPRESSION_DICT");
+  if (!m_dict)
+  {
+    m_dict = new TrkrClusterCompressionDictv1;
+    runNode->addNode(new PHIODataNode<PHObject>(m_dict, "TRKR_CLUSTER_COMPRESSION_DICT", "PHObject"));
+  }
+
+  // clusters, on the DST/TRKR node. Created here, before the clusterizers InitRun, so that they fill it
+  auto dstNode = dynamic_cast<PHCompositeNode*>(iter.findFirst("PHCompositeNode", "DST"));
+  if (!dstNode)
+  {
+    std::cout << "TrkrClusterCompressor::Init - DST Node missing" << std::endl;
+    return Fun4AllReturnCodes::ABORTRUN;
+  }
+
+  if (!findNode::getClass<TrkrClusterContainer>(dstNode, "TRKR_CLUSTER"))
+  {
+    PHNodeIterator dstiter(dstNode);
+    auto trkrNode = dynamic_cast<PHCompositeNode*>(dstiter.findFirst("PHCompositeNode", "TRKR"));
+    if (!trkrNode)
+    {
+      trkrNode = new PHCompositeNode("TRKR");
+      dstNode->addNode(trkrNode);
+    }
+
+    auto clusters = new TrkrClusterContainerv6;
+    trkrNode->addNode(new PHIODataNode<PHObject>(clusters, "TRKR_CLUSTER", "PHObject"));
+  }
+
+  return Fun4AllReturnCodes::EVENT_OK;
+}
+
+//_____________________________________________________________________
+int TrkrClusterCompressor::InitRun(PHCompositeNode* topNode)
+{
+  m_cluster_map = findNode::getClass<TrkrClusterContainer>(topNode, "TRKR_CLUSTER");
+  if (!m_cluster_map)
+  {
+    std::cout << PHWHERE << " TRKR_CLUSTER node not found" << std::endl;
+    return Fun4AllReturnCodes::ABORTRUN;
+  }
+
+  m_compressed_map = dynamic_cast<TrkrClusterContainerv6*>(m_cluster_map);
+  if (!m_compressed_map)
+  {
+    std::cout << PHWHERE << " TRKR_CLUSTER is a " << m_cluster_map->ClassName()
+              << ", not a TrkrClusterContainerv6. Clusters are written uncompressed" << std::endl;
+    return Fun4AllReturnCodes::EVENT_OK;
+  }
+
+  m_compressed_map->set_dict(m_dict);
+  return Fun4AllReturnCodes::EVENT_OK;
+}
+
+//_____________________________________________________________________
+int TrkrClusterCompressor::process_event(PHCompositeNode* /*topNode*/)
+{
+  // the dictionaries of each detector are built from its first events with clusters.
+  // The clusters are encoded when TRKR_CLUSTER is written
+  if (m_compressed_map)
+  {
+    update_dict();
+  }
+
+  return Fun4AllReturnCodes::EVENT_OK;
+}
+
+//_____________________________________________________________________
+int TrkrClusterCompressor::End(PHCompositeNode* /*topNode*/)
+{
+  if (!m_compressed_map || !m_compressed_map->get_nevents())
+  {
+    return Fun4AllReturnCodes::EVENT_OK;
+  }
+
+  const auto nevents = m_compressed_map->get_nevents();
+  const auto nclusters = m_compressed_map->get_nclusters();
+  std::cout << "TrkrClusterCompressor::End -"
+            << " events: " << nevents
+            << " clusters per event: " << static_cast<double>(nclusters) / nevents
+            << std::endl;
+  if (nclusters)
+  {
+    std::cout << "TrkrClusterCompressor::End -"
+              << " uncompressed fields: " << static_cast<double>(m_compressed_map->get_nescaped()) / (nclusters * TrkrClusterCompressionDict::NFields)
+              << std::endl;
+  }
+
+  // measured size on disk, after the output file compression
+  auto out = dynamic_cast<Fun4AllDstOutputManager*>(Fun4AllServer::instance()->getOutputManager(m_output_manager));
+  if (!out)
+  {
+    std::cout << "TrkrClusterCompressor::End - no Fun4AllDstOutputManager " << m_output_manager
+              << ", TRKR_CLUSTER size on disk not reported" << std::endl;
+    return Fun4AllReturnCodes::EVENT_OK;
+  }
+
+  const double bytes = out->NodeBytesOnDisk("TRKR_CLUSTER");
+  std::cout << "TrkrClusterCompressor::End -"
+            << " TRKR_CLUSTER on disk: " << bytes / nevents << " bytes per event";
+  if (nclusters)
+  {
+    std::cout << ", " << bytes / nclusters << " bytes per cluster";
+  }
+  std::cout << std::endl;
+
+  return Fun4AllReturnCodes::EVENT_OK;
+}
+
+//_____________________________________________________________________
+bool TrkrClusterCompressor::has_dict(TrkrDefs::TrkrId trkrid) const
+{
+  for (unsigned int field = 0; field < TrkrClusterCompressionDict::NFields; ++field)
+  {
+    if (m_dict->get_size(trkrid, static_cast<TrkrClusterCompressionDict::Field>(field)))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//_____________________________________________________________________
+void TrkrClusterCompressor::update_dict()
+{
+  bool updated = false;
+  for (unsigned int trkrid = 0; trkrid < TrkrClusterCompressionDict::NDetectors; ++trkrid)
+  {
+    const auto id = static_cast<TrkrDefs::TrkrId>(trkrid);
+    if (has_dict(id))
+    {
+      continue;
+    }
+
+    const auto hitsetkeys = m_cluster_map->getHitSetKeys(id);
+    if (hitsetkeys.empty())
+    {
+      continue;
+    }
+
+    auto& values = m_samples[trkrid];
+    for (const auto& hitsetkey : hitsetkeys)
+    {
+      const auto range = m_cluster_map->getClusters(hitsetkey);
+      for (auto iter = range.first; iter != range.second; ++iter)
+      {
+        const auto cluster = iter->second;
+        values[TrkrClusterCompressionDict::LocalX].push_back(cluster->getLocalX());
+        values[TrkrClusterCompressionDict::LocalY].push_back(cluster->getLocalY());
+        values[TrkrClusterCompressionDict::RPhiError].push_back(cluster->getRPhiError());
+        values[TrkrClusterCompressionDict::ZError].push_back(cluster->getZError());
+      }
+    }
+
+    if (values[TrkrClusterCompressionDict::LocalX].empty() || ++m_sample_events[trkrid] < m_dict_events)
+    {
+      continue;
+    }
+
+    for (unsigned int field = 0; field < TrkrClusterCompressionDict::NFields; ++field)
+    {
+      build_dict(id, static_cast<TrkrClusterCompressionDict::Field>(field), values[field]);
+
+      // release the sample
+      std::vector<float>().swap(values[field]);
+    }
+    updated = true;
+
+    if (Verbosity())
+    {
+      std::cout << "TrkrClusterCompressor::update_dict - built dictionaries for detector " << trkrid
+                << " from " << m_sample_events[trkrid] << " events" << std::endl;
+    }
+  }
+
+  if (updated && Verbosity())
+  {
+    m_dict->identify();
+  }
+}
+
+//_____________________________________________________________________
+void TrkrClusterCompressor::build_dict(TrkrDefs::TrkrId trkrid, TrkrClusterCompressionDict::Field field, std::vector<float>& values)
+{
+  values.erase(std::remove_if(values.begin(), values.end(), [](float value)
+                              { return std::isnan(value); }),
+               values.end());
+  if (values.empty())
+  {
+    return;
+  }
+
+  // approx reads the sample from a tree. Keep it in memory, out of any output file
+  Float_t value = 0;
+  TTree sample("TrkrClusterCompressorSample", "TrkrClusterCompressor sample");
+  sample.SetDirectory(nullptr);
+  sample.Branch("value", &value, "value/F");
+  for (const auto& v : values)
+  {
+    value = v;
+    sample.Fill();
+  }
+
+  // merge the sample into at most kEscape intervals, the entries are their sorted centers
+  std::vector<UShort_t> order;
+  std::vector<Float_t> entries;
+  std::vector<size_t> counts;
+  const auto sigma = approx(&order, &entries, &counts, sample.GetEntries(), &sample, &value, TrkrClusterCompressionDict::kEscape);
+
+  m_dict->set_dict(trkrid, field, entries, m_max_error[trkrid][field]);
+
+  if (Verbosity())
+  {
+    std::cout << "TrkrClusterCompressor::build_dict - detector " << trkrid << " field " << field
+              << " sample: " << values.size() << " entries: " << entries.size()
+              << " error rms: " << sigma << std::endl;
+  }
+}
@@ -0,0 +1,96 @@
+#ifndef TRACKRECO_TRKRCLUSTERCOMPRESSOR_H
+#define TRACKRECO_TRKRCLUSTERCOMPRESSOR_H
+
+/*!
+ * \file TrkrClusterCompressor.h
+ * \brief store the clusters on the DST with lossy compressed positions and errors
+ */
+
+#include <fun4all/SubsysReco.h>
+#include <trackbase/TrkrClusterCompressionDict.h>
+#include <trackbase/TrkrDefs.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+class PHCompositeNode;
+class TrkrClusterContainer;
+class TrkrClusterContainerv6;
+
+/**
+ * Writes TRKR_CLUSTER to the DST with compressed local positions and errors.
+ *
+ * Init creates TRKR_CLUSTER as a TrkrClusterContainerv6, which the clusterizers then
+ * fill, and TRKR_CLUSTER_COMPRESSION_DICT on the RUN node. The module must be registered
+ * after the clusterizers: the dictionaries of a detector are built from the clusters of
+ * the first events in which it has clusters (see set_dict_events), with the quantization
+ * of the compressor package (approx, in compressor.h), using all the 16 bit codes.
+ * Until then, and for values further than the error set with set_max_error from any
+ * dictionary entry, fields are stored uncompressed.
+ *
+ * Reading needs no extra module: TrkrClusterContainerv6 decodes itself with the
+ * dictionary read from the RUN node. End reports the measured on disk size of
+ * TRKR_CLUSTER per event, from the DST output manager set with set_output_manager.
+ *
+ * SvtxTrack states are not compressed.
+ */
+class TrkrClusterCompressor : public SubsysReco
+{
+ public:
+  TrkrClusterCompressor(const std::string& name = "TrkrClusterCompressor");
+
+  int Init(PHCompositeNode*) override;
+  int InitRun(PHCompositeNode*) override;
+  int process_event(PHCompositeNode*) override;
+  int End(PHCompositeNode*) override;
+
+  //! maximum absolute compression error of a field, in the units of the field
+  void set_max_error(TrkrDefs::TrkrId trkrid, TrkrClusterCompressionDict::Field field, float value)
+  {
+    m_max_error[trkrid][field] = value;
+  }
+
+  //! number of events with clusters of a detector from which its dictionaries are built
+  void set_dict_events(unsigned int value)
+  {
+    m_dict_events = value;
+  }
+
+  //! name of the Fun4AllDstOutputManager writing TRKR_CLUSTER, used for the size report
+  void set_output_manager(const std::string& value)
+  {
+    m_output_manager = value;
+  }
+
+ private:
+  //! add the current clusters to the samples of the detectors with no dictionary yet, and build the dictionaries of the complete samples
+  void update_dict();
+
+  //! build the dictionary of a field from its sample, with the compressor package quantization
+  void build_dict(TrkrDefs::TrkrId, TrkrClusterCompressionDict::Field, std::vector<float>& values);
+
+  //! true if the dictionaries of a detector are built
+  bool has_dict(TrkrDefs::TrkrId) const;
+
+  TrkrClusterContainer* m_cluster_map = nullptr;
+  TrkrClusterContainerv6* m_compressed_map = nullptr;
+  TrkrClusterCompressionDict* m_dict = nullptr;
+
+  //! maximum absolute error, per detector and field
+  std::array<std::array<float, TrkrClusterCompressionDict::NFields>, TrkrClusterCompressionDict::NDetectors> m_max_error{};
+
+  //! number of events with clusters of a detector from which its dictionaries are built
+  unsigned int m_dict_events = 1;
+
+  //! number of events in the samples, per detector
+  std::array<unsigned int, TrkrClusterCompressionDict::NDetectors> m_sample_events{};
+
+  //! values from which the dictionaries are built, per detector and field
+  std::array<std::array<std::vector<float>, TrkrClusterCompressionDict::NFields>, TrkrClusterCompressionDict::NDetectors> m_samples;
+
+  //! DST output manager name
+  std::string m_output_manager = "DSTOUT";
+};
+
+#endif  // TRACKRECO_TRKRCLUSTERCOMPRESSOR_H
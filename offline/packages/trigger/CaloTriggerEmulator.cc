@@ -404,6 +404,8 @@ int CaloTriggerEmulator::InitRun(PHCompositeNode *topNode)
     return Fun4AllReturnCodes::ABORTRUN;
   }
 
+  BuildLookupTables();
+
   CreateNodes(topNode);
 
   return 0;
@@ -526,6 +528,163 @@ int CaloTriggerEmulator::Download_Calibrations()
   }
   return 0;
 }
+
+std::vector<unsigned int> CaloTriggerEmulator::compile_lut(const std::map<unsigned int, TH1 *> &h_lut, unsigned int (*encode)(unsigned int), unsigned int nchannels, bool use_default, std::vector<uint8_t> &table)
+{
+  std::vector<unsigned int> offsets(nchannels, 0);
+  std::map<std::vector<uint8_t>, unsigned int> known_tables;
+  std::vector<uint8_t> lut(1024, 0);
+  unsigned int nmissing = 0;
+
+  table.clear();
+  for (unsigned int channel = 0; channel < nchannels; channel++)
+  {
+    TH1 *h = nullptr;
+    if (!use_default)
+    {
+      auto iter = h_lut.find(encode(channel));
+      if (iter != h_lut.end())
+      {
+        h = iter->second;
+      }
+      if (!h)
+      {
+        nmissing++;
+      }
+    }
+
+    for (unsigned int lut_input = 0; lut_input < 1024; lut_input++)
+    {
+      unsigned int lut_output = (h ? ((unsigned int) h->GetBinContent(lut_input + 1)) & 0x3ffU : m_l1_adc_table[lut_input]);
+      // shift before the sum
+      lut[lut_input] = (lut_output >> 2U) & 0xffU;
+    }
+
+    auto inserted = known_tables.emplace(lut, table.size());
+    if (inserted.second)
+    {
+      table.insert(table.end(), lut.begin(), lut.end());
+    }
+    offsets[channel] = inserted.first->second;
+  }
+  if (nmissing)
+  {
+    std::cout << PHWHERE << " no LUT histogram for " << nmissing << " channels, using the identity table for them" << std::endl;
+  }
+  return offsets;
+}
+
+void CaloTriggerEmulator::BuildLookupTables()
+{
+  m_n_peak_samples = m_nsamples - 1;
+  if (m_trig_sample > 0)
+  {
+    m_n_peak_samples = 1;
+  }
+  // samples up to sample_end + 1 are read by the peak finding
+  m_waveform.assign(std::max(m_nsamples, m_trig_sample + 1) + 2, 0);
+
+  if (m_do_emcal)
+  {
+    // the waveforms are stored by channel, channel i having the tower key encode_emcal(i)
+    std::map<unsigned int, unsigned int> channel_of_key;
+    for (unsigned int i = 0; i < 24576; i++)
+    {
+      channel_of_key[TowerInfoDefs::encode_emcal(i)] = i;
+    }
+    m_sum_channels_emcal.clear();
+    for (int ip = 0; ip < m_prim_map[TriggerDefs::DetectorId::emcalDId]; ip++)
+    {
+      for (int isum = 0; isum < m_n_sums; isum++)
+      {
+        for (int j = 0; j < 4; j++)
+        {
+          unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::DetectorId::emcalDId, ip, isum, j);
+          m_sum_channels_emcal.push_back(channel_of_key.at(key));
+        }
+      }
+    }
+
+    m_lut_offset_emcal = compile_lut(h_emcal_lut, &TowerInfoDefs::encode_emcal, 24576, m_default_lut_emcal, m_lut_table_emcal);
+    m_peak_sub_ped_emcal.assign(24576 * m_n_peak_samples, 0);
+  }
+
+  if (m_do_hcalin || m_do_hcalout)
+  {
+    std::map<unsigned int, unsigned int> channel_of_key;
+    for (unsigned int i = 0; i < 1536; i++)
+    {
+      channel_of_key[TowerInfoDefs::encode_hcal(i)] = i;
+    }
+    m_sum_channels_hcal.clear();
+    for (int ip = 0; ip < m_prim_map[TriggerDefs::DetectorId::hcalDId]; ip++)
+    {
+      for (int isum = 0; isum < m_n_sums; isum++)
+      {
+        for (int j = 0; j < 4; j++)
+        {
+          unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::DetectorId::hcalDId, ip, isum, j);
+          m_sum_channels_hcal.push_back(channel_of_key.at(key));
+        }
+      }
+    }
+  }
+  if (m_do_hcalin)
+  {
+    m_lut_offset_hcalin = compile_lut(h_hcalin_lut, &TowerInfoDefs::encode_hcal, 1536, m_default_lut_hcalin, m_lut_table_hcalin);
+    m_peak_sub_ped_hcalin.assign(1536 * m_n_peak_samples, 0);
+  }
+  if (m_do_hcalout)
+  {
+    m_lut_offset_hcalout = compile_lut(h_hcalout_lut, &TowerInfoDefs::encode_hcal, 1536, m_default_lut_hcalout, m_lut_table_hcalout);
+    m_peak_sub_ped_hcalout.assign(1536 * m_n_peak_samples, 0);
+  }
+
+  if (Verbosity() >= 1)
+  {
+    std::cout << __FUNCTION__ << ": distinct LUTs emcal / hcalin / hcalout = "
+              << m_lut_table_emcal.size() / 1024 << " / "
+              << m_lut_table_hcalin.size() / 1024 << " / "
+              << m_lut_table_hcalout.size() / 1024 << std::endl;
+  }
+}
+
+void CaloTriggerEmulator::fill_peak_sub_ped(std::vector<unsigned int> &peak_sub_ped, unsigned int iwave, bool suppressed, int sample_start, int sample_end)
+{
+  std::size_t offset = static_cast<std::size_t>(iwave) * m_n_peak_samples;
+  // padding channels beyond the last tower are never used
+  if (offset >= peak_sub_ped.size())
+  {
+    return;
+  }
+  unsigned int *out = peak_sub_ped.data() + offset;
+
+  if (suppressed)
+  {
+    std::fill(out, out + (sample_end - sample_start), 0);
+    return;
+  }
+
+  const int *wave = m_waveform.data();
+  for (int i = sample_start; i < sample_end; i++)
+  {
+    // maximum of 3 consecutive samples minus the sample m_trig_sub_delay before
+    int16_t maxim = (wave[i] > wave[i + 1] ? wave[i] : wave[i + 1]);
+    maxim = (maxim > wave[i + 2] ? maxim : wave[i + 2]);
+    uint16_t sam = 0;
+    if (i >= m_trig_sub_delay)
+    {
+      sam = i - m_trig_sub_delay;
+    }
+    unsigned int sub = 0;
+    if (maxim > wave[sam])
+    {
+      sub = (((uint16_t) (maxim - wave[sam])) & 0x3fffU);
+    }
+    *out++ = sub;
+  }
+}
+
 // process event procedure
 int CaloTriggerEmulator::process_event(PHCompositeNode *topNode)
 {
@@ -576,10 +735,10 @@ int CaloTriggerEmulator::process_event(PHCompositeNode *topNode)
 // RESET event procedure that takes all variables to 0 and clears the primitives.
 int CaloTriggerEmulator::ResetEvent(PHCompositeNode * /*topNode*/)
 {
-  // here, the peak minus pedestal map is cleanly disposed of
-  m_peak_sub_ped_emcal.clear();
-  m_peak_sub_ped_hcalin.clear();
-  m_peak_sub_ped_hcalout.clear();
+  // here, the peak minus pedestal buffers are zeroed, keeping their memory
+  std::fill(m_peak_sub_ped_emcal.begin(), m_peak_sub_ped_emcal.end(), 0);
+  std::fill(m_peak_sub_ped_hcalin.begin(), m_peak_sub_ped_hcalin.end(), 0);
+  std::fill(m_peak_sub_ped_hcalout.begin(), m_peak_sub_ped_hcalout.end(), 0);
 
   return 0;
 }
@@ -637,64 +796,27 @@ int CaloTriggerEmulator::process_offline(PHCompositeNode *topNode)
             {
               for (int iskip = 0; iskip < 64; iskip++)
               {
-                std::vector<unsigned int> v_peak_sub_ped;
-                for (int i = sample_start; i < sample_end; i++)
-                {
-                  v_peak_sub_ped.push_back(0);
-                }
-                unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-                m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
+                fill_peak_sub_ped(m_peak_sub_ped_emcal, iwave, true, sample_start, sample_end);
                 iwave++;
               }
             }
           }
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
+          bool suppressed = packet->iValue(channel, "SUPPRESSED");
+          if (!suppressed)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              v_peak_sub_ped.push_back(0);
+              m_waveform[i] = packet->iValue(i, channel);
             }
           }
-          else
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
-            }
-          }
-          unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-          m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
+          fill_peak_sub_ped(m_peak_sub_ped_emcal, iwave, suppressed, sample_start, sample_end);
           iwave++;
         }
         if (nchannels < 192 && !(adc_skip_mask < 4))
         {
           for (int iskip = 0; iskip < 192 - nchannels; iskip++)
           {
-            std::vector<unsigned int> v_peak_sub_ped;
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              v_peak_sub_ped.push_back(0);
-            }
-            unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-            m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
+            fill_peak_sub_ped(m_peak_sub_ped_emcal, iwave, true, sample_start, sample_end);
             iwave++;
           }
         }
@@ -727,40 +849,15 @@ int CaloTriggerEmulator::process_offline(PHCompositeNode *topNode)
 
         for (int channel = 0; channel < nchannels; channel++)
         {
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
+          bool suppressed = packet->iValue(channel, "SUPPRESSED");
+          if (!suppressed)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              v_peak_sub_ped.push_back(0);
+              m_waveform[i] = packet->iValue(i, channel);
             }
           }
-          else
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
-            }
-          }
-          unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-          m_peak_sub_ped_hcalout[key] = v_peak_sub_ped;
+          fill_peak_sub_ped(m_peak_sub_ped_hcalout, iwave, suppressed, sample_start, sample_end);
           iwave++;
         }
       }
@@ -792,40 +889,15 @@ int CaloTriggerEmulator::process_offline(PHCompositeNode *topNode)
 
         for (int channel = 0; channel < nchannels; channel++)
         {
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
+          bool suppressed = packet->iValue(channel, "SUPPRESSED");
+          if (!suppressed)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              v_peak_sub_ped.push_back(0);
-            }
-          }
-          else
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
+              m_waveform[i] = packet->iValue(i, channel);
             }
           }
-          unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-          m_peak_sub_ped_hcalin[key] = v_peak_sub_ped;
+          fill_peak_sub_ped(m_peak_sub_ped_hcalin, iwave, suppressed, sample_start, sample_end);
           iwave++;
         }
       }
@@ -896,52 +968,21 @@ int CaloTriggerEmulator::process_waveforms(PHCompositeNode *topNode)
             {
               for (int iskip = 0; iskip < 64; iskip++)
               {
-                std::vector<unsigned int> v_peak_sub_ped;
-                for (int i = sample_start; i < sample_end; i++)
-                {
-                  v_peak_sub_ped.push_back(0);
-                }
-                unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-                m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
+                fill_peak_sub_ped(m_peak_sub_ped_emcal, iwave, true, sample_start, sample_end);
                 iwave++;
               }
               continue;
             }
           }
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
+          bool suppressed = packet->iValue(channel, "SUPPRESSED");
+          if (!suppressed)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              v_peak_sub_ped.push_back(0);
+              m_waveform[i] = packet->iValue(i, channel);
             }
           }
-          else
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
-            }
-          }
-          unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-          m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
+          fill_peak_sub_ped(m_peak_sub_ped_emcal, iwave, suppressed, sample_start, sample_end);
           iwave++;
         }
       }
@@ -965,40 +1006,15 @@ int CaloTriggerEmulator::process_waveforms(PHCompositeNode *topNode)
 
         for (int channel = 0; channel < nchannels; channel++)
         {
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              v_peak_sub_ped.push_back(0);
-            }
-          }
-          else
+          bool suppressed = packet->iValue(channel, "SUPPRESSED");
+          if (!suppressed)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
+              m_waveform[i] = packet->iValue(i, channel);
             }
           }
-          unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-          m_peak_sub_ped_hcalout[key] = v_peak_sub_ped;
+          fill_peak_sub_ped(m_peak_sub_ped_hcalout, iwave, suppressed, sample_start, sample_end);
           iwave++;
         }
       }
@@ -1022,40 +1038,15 @@ int CaloTriggerEmulator::process_waveforms(PHCompositeNode *topNode)
 
         for (int channel = 0; channel < nchannels; channel++)
         {
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
+          bool suppressed = packet->iValue(channel, "SUPPRESSED");
+          if (!suppressed)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              v_peak_sub_ped.push_back(0);
+              m_waveform[i] = packet->iValue(i, channel);
             }
           }
-          else
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
-            }
-          }
-          unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-          m_peak_sub_ped_hcalin[key] = v_peak_sub_ped;
+          fill_peak_sub_ped(m_peak_sub_ped_hcalin, iwave, suppressed, sample_start, sample_end);
           iwave++;
         }
       }
@@ -1095,42 +1086,17 @@ int CaloTriggerEmulator::process_sim()
     // for each waveform, clauclate the peak - pedestal given the sub-delay setting
     for (unsigned int iwave = 0; iwave < (unsigned int) m_waveforms_emcal->size(); iwave++)
     {
-      std::vector<unsigned int> v_peak_sub_ped;
       TowerInfo *tower = m_waveforms_emcal->get_tower_at_channel(iwave);
-      unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-      if (tower->get_isZS())
+      bool suppressed = tower->get_isZS();
+      if (!suppressed)
       {
-        for (int i = sample_start; i < sample_end; i++)
+        for (int i = 0; i < sample_end + 2; i++)
         {
-          v_peak_sub_ped.push_back(0);
-        }
-      }
-      else
-      {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          int16_t maxim = (tower->get_waveform_value(i) > tower->get_waveform_value(i + 1) ? tower->get_waveform_value(i) : tower->get_waveform_value(i + 1));
-          maxim = (maxim > tower->get_waveform_value(i + 2) ? maxim : tower->get_waveform_value(i + 2));
-          uint16_t sam = 0;
-          if (i >= m_trig_sub_delay)
-          {
-            sam = i - m_trig_sub_delay;
-          }
-          else
-          {
-            sam = 0;
-          }
-          unsigned int sub = 0;
-          if (maxim > tower->get_waveform_value(sam))
-          {
-            sub = (((uint16_t) (maxim - tower->get_waveform_value(sam))) & 0x3fffU);
-          }
-
-          v_peak_sub_ped.push_back(sub);
+          m_waveform[i] = tower->get_waveform_value(i);
         }
       }
       // save in global.
-      m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
+      fill_peak_sub_ped(m_peak_sub_ped_emcal, iwave, suppressed, sample_start, sample_end);
     }
   }
   if (m_do_hcalout)
@@ -1140,7 +1106,6 @@ int CaloTriggerEmulator::process_sim()
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: ohcal" << std::endl;
     }
 
-    std::vector<int> wave;
     // for each waveform, clauclate the peak - pedestal given the sub-delay setting
     if (!m_waveforms_hcalout->size())
     {
@@ -1149,42 +1114,17 @@ int CaloTriggerEmulator::process_sim()
 
     for (unsigned int iwave = 0; iwave < (unsigned int) m_waveforms_hcalout->size(); iwave++)
     {
-      std::vector<unsigned int> v_peak_sub_ped;
       TowerInfo *tower = m_waveforms_hcalout->get_tower_at_channel(iwave);
-      unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-      if (tower->get_isZS())
+      bool suppressed = tower->get_isZS();
+      if (!suppressed)
       {
-        for (int i = sample_start; i < sample_end; i++)
+        for (int i = 0; i < sample_end + 2; i++)
         {
-          v_peak_sub_ped.push_back(0);
-        }
-      }
-      else
-      {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          int16_t maxim = (tower->get_waveform_value(i) > tower->get_waveform_value(i + 1) ? tower->get_waveform_value(i) : tower->get_waveform_value(i + 1));
-          maxim = (maxim > tower->get_waveform_value(i + 2) ? maxim : tower->get_waveform_value(i + 2));
-          uint16_t sam = 0;
-          if (i >= m_trig_sub_delay)
-          {
-            sam = i - m_trig_sub_delay;
-          }
-          else
-          {
-            sam = 0;
-          }
-          unsigned int sub = 0;
-          if (maxim > tower->get_waveform_value(sam))
-          {
-            sub = (((uint16_t) (maxim - tower->get_waveform_value(sam))) & 0x3fffU);
-          }
-
-          v_peak_sub_ped.push_back(sub);
+          m_waveform[i] = tower->get_waveform_value(i);
         }
       }
       // save in global.
-      m_peak_sub_ped_hcalout[key] = v_peak_sub_ped;
+      fill_peak_sub_ped(m_peak_sub_ped_hcalout, iwave, suppressed, sample_start, sample_end);
     }
   }
   if (m_do_hcalin)
@@ -1202,47 +1142,20 @@ int CaloTriggerEmulator::process_sim()
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: ihcal" << std::endl;
     }
 
-    std::vector<unsigned int> wave;
-
     // for each waveform, clauclate the peak - pedestal given the sub-delay setting
     for (unsigned int iwave = 0; iwave < (unsigned int) m_waveforms_hcalin->size(); iwave++)
     {
-      std::vector<unsigned int> v_peak_sub_ped;
       TowerInfo *tower = m_waveforms_hcalin->get_tower_at_channel(iwave);
-      unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-      if (tower->get_isZS())
-      {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          v_peak_sub_ped.push_back(0);
-        }
-      }
-      else
+      bool suppressed = tower->get_isZS();
+      if (!suppressed)
       {
-        for (int i = sample_start; i < sample_end; i++)
+        for (int i = 0; i < sample_end + 2; i++)
         {
-          int16_t maxim = (tower->get_waveform_value(i) > tower->get_waveform_value(i + 1) ? tower->get_waveform_value(i) : tower->get_waveform_value(i + 1));
-          maxim = (maxim > tower->get_waveform_value(i + 2) ? maxim : tower->get_waveform_value(i + 2));
-          uint16_t sam = 0;
-          if (i >= m_trig_sub_delay)
-          {
-            sam = i - m_trig_sub_delay;
-          }
-          else
-          {
-            sam = 0;
-          }
-          unsigned int sub = 0;
-          if (maxim > tower->get_waveform_value(sam))
-          {
-            sub = (((uint16_t) (maxim - tower->get_waveform_value(sam))) & 0x3fffU);
-          }
-
-          v_peak_sub_ped.push_back(sub);
+          m_waveform[i] = tower->get_waveform_value(i);
         }
       }
       // save in global.
-      m_peak_sub_ped_hcalin[key] = v_peak_sub_ped;
+      fill_peak_sub_ped(m_peak_sub_ped_hcalin, iwave, suppressed, sample_start, sample_end);
     }
   }
 
@@ -1250,6 +1163,8 @@ int CaloTriggerEmulator::process_sim()
 }
 
 // procedure to process the peak - pedestal into primitives.
+// For each 2x2 sum, the LUT outputs of its 4 towers are accumulated for all samples at once,
+// running over the contiguous samples of each channel.
 int CaloTriggerEmulator::process_primitives()
 {
   int ip;
@@ -1266,6 +1181,9 @@ int CaloTriggerEmulator::process_primitives()
     std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives" << std::endl;
   }
 
+  const TriggerDefs::TriggerId noneid = TriggerDefs::GetTriggerId("NONE");
+  std::vector<unsigned int> temp_sums(nsample, 0);
+
   if (m_do_emcal)
   {
     if (Verbosity())
@@ -1273,6 +1191,10 @@ int CaloTriggerEmulator::process_primitives()
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: emcal" << std::endl;
     }
 
+    const TriggerDefs::DetectorId detid = TriggerDefs::GetDetectorId("EMCAL");
+    const TriggerDefs::PrimitiveId primid = TriggerDefs::GetPrimitiveId("EMCAL");
+    const unsigned int *channels = m_sum_channels_emcal.data();
+
     ip = 0;
 
     // get the number of primitives needed to process
@@ -1283,9 +1205,8 @@ int CaloTriggerEmulator::process_primitives()
       {
         std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: adding " << i << std::endl;
       }
-      unsigned int tmp = 0;
       // get the primitive key of what we are making, in order of the packet ID and channel number
-      TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("EMCAL"), TriggerDefs::GetPrimitiveId("EMCAL"), ip);
+      TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(noneid, detid, primid, ip);
 
       TriggerPrimitive *primitive = m_primitives_emcal->get_primitive_at_key(primkey);
       unsigned int sum = 0;
@@ -1293,10 +1214,10 @@ int CaloTriggerEmulator::process_primitives()
       mask = CheckFiberMasks(primkey);
 
       // calculate 16 sums
-      for (int isum = 0; isum < m_n_sums; isum++)
+      for (int isum = 0; isum < m_n_sums; isum++, channels += 4)
       {
         // get sum key
-        TriggerDefs::TriggerSumKey sumkey = TriggerDefs::getTriggerSumKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("EMCAL"), TriggerDefs::GetPrimitiveId("EMCAL"), ip, isum);
+        TriggerDefs::TriggerSumKey sumkey = TriggerDefs::getTriggerSumKey(noneid, detid, primid, ip, isum);
 
         // calculate sums for all samples, hense the vector.
         std::vector<unsigned int> *t_sum = primitive->get_sum_at_key(sumkey);
@@ -1304,34 +1225,30 @@ int CaloTriggerEmulator::process_primitives()
 
         // check to mask channel (if fiber masked, automatically mask the channel)
         bool mask_channel = mask || CheckChannelMasks(sumkey);
+
+        // if masked, just fill with 0s
+        std::fill(temp_sums.begin(), temp_sums.end(), 0);
+        if (!mask_channel)
+        {
+          for (int j = 0; j < 4; j++)
+          {
+            // the LUT output is shifted before the sum
+            const unsigned int *peak_sub_ped = &m_peak_sub_ped_emcal[channels[j] * m_n_peak_samples];
+            const uint8_t *lut = &m_lut_table_emcal[m_lut_offset_emcal[channels[j]]];
+            for (int is = 0; is < nsample; is++)
+            {
+              temp_sums[is] += lut[(peak_sub_ped[is] >> 4U) & 0x3ffU];
+            }
+          }
+        }
+
         for (int is = 0; is < nsample; is++)
         {
           sum = 0;
-          unsigned int temp_sum = 0;
-
-          // if masked, just fill with 0s
           if (!mask_channel)
           {
-            for (int j = 0; j < 4; j++)
-            {
-              // unsigned int iwave = 64*ip + isum*4 + j;
-              unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::GetDetectorId("EMCAL"), ip, isum, j);
-              unsigned int lut_input = (m_peak_sub_ped_emcal[key].at(is) >> 4U) & 0x3ffU;
-
-              // shift before the sum
-              if (m_default_lut_emcal)
-              {
-                tmp = (m_l1_adc_table[lut_input] >> 2U);
-              }
-              else
-              {
-                unsigned int lut_output = ((unsigned int) h_emcal_lut[key]->GetBinContent(lut_input + 1)) & 0x3ffU;
-                tmp = (lut_output >> 2U);
-              }
-              temp_sum += (tmp & 0xffU);
-            }
             // shift after the sum
-            sum = ((temp_sum & 0x3ffU) >> 2U) & 0xffU;
+            sum = ((temp_sums[is] & 0x3ffU) >> 2U) & 0xffU;
 
             // sum is now 8 bits and sends it all to the LL1
             if (Verbosity() >= 10 && sum >= 1)
@@ -1356,44 +1273,46 @@ int CaloTriggerEmulator::process_primitives()
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: ohcal" << std::endl;
     }
 
+    const TriggerDefs::DetectorId detid = TriggerDefs::GetDetectorId("HCALOUT");
+    const TriggerDefs::PrimitiveId primid = TriggerDefs::GetPrimitiveId("HCALOUT");
+    const unsigned int *channels = m_sum_channels_hcal.data();
+
     ip = 0;
 
     m_n_primitives = m_prim_map[TriggerDefs::DetectorId::hcaloutDId];
 
     for (i = 0; i < m_n_primitives; i++, ip++)
     {
-      TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("HCALOUT"), TriggerDefs::GetPrimitiveId("HCALOUT"), ip);
+      TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(noneid, detid, primid, ip);
       TriggerPrimitive *primitive = m_primitives_hcalout->get_primitive_at_key(primkey);
       unsigned int sum;
       mask = CheckFiberMasks(primkey);
-      for (int isum = 0; isum < m_n_sums; isum++)
+      for (int isum = 0; isum < m_n_sums; isum++, channels += 4)
       {
-        TriggerDefs::TriggerSumKey sumkey = TriggerDefs::getTriggerSumKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("HCALOUT"), TriggerDefs::GetPrimitiveId("HCALOUT"), ip, isum);
+        TriggerDefs::TriggerSumKey sumkey = TriggerDefs::getTriggerSumKey(noneid, detid, primid, ip, isum);
         std::vector<unsigned int> *t_sum = primitive->get_sum_at_key(sumkey);
         mask |= CheckChannelMasks(sumkey);
+
+        std::fill(temp_sums.begin(), temp_sums.end(), 0);
+        if (!mask)
+        {
+          for (int j = 0; j < 4; j++)
+          {
+            const unsigned int *peak_sub_ped = &m_peak_sub_ped_hcalout[channels[j] * m_n_peak_samples];
+            const uint8_t *lut = &m_lut_table_hcalout[m_lut_offset_hcalout[channels[j]]];
+            for (int is = 0; is < nsample; is++)
+            {
+              temp_sums[is] += lut[(peak_sub_ped[is] >> 4U) & 0x3ffU];
+            }
+          }
+        }
+
         for (int is = 0; is < nsample; is++)
         {
           sum = 0;
-          unsigned int temp_sum = 0;
           if (!mask)
           {
-            for (int j = 0; j < 4; j++)
-            {
-              unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::GetDetectorId("HCAL"), ip, isum, j);
-              unsigned int lut_input = (m_peak_sub_ped_hcalout[key].at(is) >> 4U) & 0x3ffU;
-              unsigned int tmp = 0;
-              if (m_default_lut_hcalout)
-              {
-                tmp = (m_l1_adc_table[lut_input] >> 2U);
-              }
-              else
-              {
-                unsigned int lut_output = ((unsigned int) h_hcalout_lut[key]->GetBinContent(lut_input + 1)) & 0x3ffU;
-                tmp = (lut_output >> 2U);
-              }
-              temp_sum += (tmp & 0xffU);
-            }
-            sum = ((temp_sum & 0x3ffU) >> 2U) & 0xffU;
+            sum = ((temp_sums[is] & 0x3ffU) >> 2U) & 0xffU;
 
             if (Verbosity() >= 10 && sum >= 1)
             {
@@ -1414,42 +1333,44 @@ int CaloTriggerEmulator::process_primitives()
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: ihcal" << std::endl;
     }
 
+    const TriggerDefs::DetectorId detid = TriggerDefs::GetDetectorId("HCALIN");
+    const TriggerDefs::PrimitiveId primid = TriggerDefs::GetPrimitiveId("HCALIN");
+    const unsigned int *channels = m_sum_channels_hcal.data();
+
     m_n_primitives = m_prim_map[TriggerDefs::DetectorId::hcalinDId];
 
     for (i = 0; i < m_n_primitives; i++, ip++)
     {
-      TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("HCALIN"), TriggerDefs::GetPrimitiveId("HCALIN"), ip);
+      TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(noneid, detid, primid, ip);
       TriggerPrimitive *primitive = m_primitives_hcalin->get_primitive_at_key(primkey);
       unsigned int sum;
       mask = CheckFiberMasks(primkey);
-      for (int isum = 0; isum < m_n_sums; isum++)
+      for (int isum = 0; isum < m_n_sums; isum++, channels += 4)
       {
-        TriggerDefs::TriggerSumKey sumkey = TriggerDefs::getTriggerSumKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("HCALIN"), TriggerDefs::GetPrimitiveId("HCALIN"), ip, isum);
+        TriggerDefs::TriggerSumKey sumkey = TriggerDefs::getTriggerSumKey(noneid, detid, primid, ip, isum);
         std::vector<unsigned int> *t_sum = primitive->get_sum_at_key(sumkey);
         mask |= CheckChannelMasks(sumkey);
+
+        std::fill(temp_sums.begin(), temp_sums.end(), 0);
+        if (!mask)
+        {
+          for (int j = 0; j < 4; j++)
+          {
+            const unsigned int *peak_sub_ped = &m_peak_sub_ped_hcalin[channels[j] * m_n_peak_samples];
+            const uint8_t *lut = &m_lut_table_hcalin[m_lut_offset_hcalin[channels[j]]];
+            for (int is = 0; is < nsample; is++)
+            {
+              temp_sums[is] += lut[(peak_sub_ped[is] >> 4U) & 0x3ffU];
+            }
+          }
+        }
+
         for (int is = 0; is < nsample; is++)
         {
           sum = 0;
-          unsigned int temp_sum = 0;
           if (!mask)
           {
-            for (int j = 0; j < 4; j++)
-            {
-              unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::GetDetectorId("HCAL"), ip, isum, j);
-              unsigned int lut_input = (m_peak_sub_ped_hcalin[key].at(is) >> 4U) & 0x3ffU;
-              unsigned int tmp = 0;
-              if (m_default_lut_hcalin)
-              {
-                tmp = (m_l1_adc_table[lut_input] >> 2U);
-              }
-              else
-              {
-                unsigned int lut_output = ((unsigned int) h_hcalin_lut[key]->GetBinContent(lut_input + 1)) & 0x3ffU;
-                tmp = (lut_output >> 2U);
-              }
-              temp_sum += (tmp & 0x3ffU);
-            }
-            sum = ((temp_sum & 0xfffU) >> 2U) & 0xffU;
+            sum = ((temp_sums[is] & 0xfffU) >> 2U) & 0xffU;
             if (Verbosity() >= 10 && sum >= 1)
             {
               std::cout << __FILE__ << "::" << __FUNCTION__ << ":: hcalin sum " << sumkey << " = " << sum << std::endl;
@@ -1891,17 +1812,8 @@ int CaloTriggerEmulator::process_trigger()
     // Make the jet primitives
     m_triggerid = TriggerDefs::TriggerId::jetTId;
     std::vector<unsigned int> *trig_bits = m_ll1out_jet->GetTriggerBits();
-    std::vector<unsigned int> jet_map[32][9]{};
-    for (auto &ie : jet_map)
-    {
-      for (auto &ip : ie)
-      {
-        for (int is = 0; is < nsample; is++)
-        {
-          ip.push_back(0);
-        }
-      }
-    }
+    // 4x4 overlapping jet sums, nsample consecutive samples per (phi, eta) patch
+    std::vector<unsigned int> jet_map(32 * 9 * nsample, 0);
 
     if (!m_primitives_jet)
     {
@@ -1923,7 +1835,6 @@ int CaloTriggerEmulator::process_trigger()
       {
         TriggerDefs::TriggerSumKey sumkey = (*iter_sum).first;
 
-        int i = 0;
         int sum_phi = static_cast<int>((TriggerDefs::getPrimitivePhiId_from_TriggerSumKey(sumkey) * 2) + TriggerDefs::getSumPhiId(sumkey));
         int sum_eta = static_cast<int>(TriggerDefs::getSumEtaId(sumkey));
         if (Verbosity() >= 2)
@@ -1931,17 +1842,19 @@ int CaloTriggerEmulator::process_trigger()
           std::cout << __FUNCTION__ << " " << __LINE__ << " processing JET trigger " << sum_phi << " " << sum_eta << std::endl;
         }
 
-        for (unsigned int &it_s : *(iter_sum->second))
+        const std::vector<unsigned int> &t_sum = *(iter_sum->second);
+        int n = std::min(nsample, static_cast<int>(t_sum.size()));
+        for (int ijeta = (sum_eta <= 3 ? 0 : sum_eta - 3); ijeta <= (sum_eta > 8 ? 8 : sum_eta); ijeta++)
         {
-          for (int ijeta = (sum_eta <= 3 ? 0 : sum_eta - 3); ijeta <= (sum_eta > 8 ? 8 : sum_eta); ijeta++)
+          for (int ijphi = sum_phi - 3; ijphi <= sum_phi; ijphi++)
           {
-            for (int ijphi = sum_phi - 3; ijphi <= sum_phi; ijphi++)
+            int iphi = (ijphi < 0 ? 32 + ijphi : ijphi);
+            unsigned int *jet_sum = &jet_map[((iphi * 9) + ijeta) * nsample];
+            for (int is = 0; is < n; is++)
             {
-              int iphi = (ijphi < 0 ? 32 + ijphi : ijphi);
-              jet_map[iphi][ijeta].at(i) += it_s;
+              jet_sum[is] += t_sum[is];
             }
           }
-          i++;
         }
       }
     }
@@ -1974,12 +1887,13 @@ int CaloTriggerEmulator::process_trigger()
             std::cout << __FUNCTION__ << " " << __LINE__ << " processing JET trigger " << ijphi << " " << ijeta << std::endl;
           }
 
-          sum->push_back(jet_map[ijphi][ijeta].at(is));
-          unsigned short bit = getBits(jet_map[ijphi][ijeta].at(is), TriggerDefs::TriggerId::jetTId);
+          unsigned int jet_sum = jet_map[(((ijphi * 9) + ijeta) * nsample) + is];
+          sum->push_back(jet_sum);
+          unsigned short bit = getBits(jet_sum, TriggerDefs::TriggerId::jetTId);
 
           if (bit)
           {
-            m_ll1out_jet->addTriggeredSum(sk, jet_map[ijphi][ijeta].at(is));
+            m_ll1out_jet->addTriggeredSum(sk, jet_sum);
             m_ll1out_jet->addTriggeredPrimitive(sk);
             pass = 1;
           }
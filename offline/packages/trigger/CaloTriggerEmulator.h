@@ -5,6 +5,7 @@
 
 #include <fun4all/SubsysReco.h>
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -66,6 +67,9 @@ class CaloTriggerEmulator : public SubsysReco
 
   int Download_Calibrations();
 
+  //! compile the LUT histograms into flat tables and map the towers of the 2x2 sums to channels
+  void BuildLookupTables();
+
   //! Set TriggerType
   void setTriggerType(const std::string &name);
   void setTriggerType(TriggerDefs::TriggerId triggerid);
@@ -125,6 +129,12 @@ class CaloTriggerEmulator : public SubsysReco
   void identify();
 
  private:
+  //! peak minus pedestal of channel iwave from the samples in m_waveform, or 0 if suppressed
+  void fill_peak_sub_ped(std::vector<unsigned int> &peak_sub_ped, unsigned int iwave, bool suppressed, int sample_start, int sample_end);
+
+  //! compile one LUT per channel into table, returns the offset of each channel's table
+  std::vector<unsigned int> compile_lut(const std::map<unsigned int, TH1 *> &h_lut, unsigned int (*encode)(unsigned int), unsigned int nchannels, bool use_default, std::vector<uint8_t> &table);
+
   std::string m_ll1_nodename;
   std::string m_prim_nodename;
   std::string m_waveform_nodename;
@@ -204,9 +214,27 @@ class CaloTriggerEmulator : public SubsysReco
   CDBHistos *cdbttree_hcalin{nullptr};
   CDBHistos *cdbttree_hcalout{nullptr};
 
-  std::map<unsigned int, std::vector<unsigned int>> m_peak_sub_ped_emcal{};
-  std::map<unsigned int, std::vector<unsigned int>> m_peak_sub_ped_hcalin{};
-  std::map<unsigned int, std::vector<unsigned int>> m_peak_sub_ped_hcalout{};
+  //! compiled LUTs: tables of 1024 LUT outputs, already masked and shifted to the 8 bit
+  //! input of the 2x2 sum, and the offset of the table of each channel. Identical tables are shared
+  std::vector<uint8_t> m_lut_table_emcal{};
+  std::vector<uint8_t> m_lut_table_hcalin{};
+  std::vector<uint8_t> m_lut_table_hcalout{};
+  std::vector<unsigned int> m_lut_offset_emcal{};
+  std::vector<unsigned int> m_lut_offset_hcalin{};
+  std::vector<unsigned int> m_lut_offset_hcalout{};
+
+  //! channel of each tower of the 2x2 sums, in (primitive, sum, tower) order
+  std::vector<unsigned int> m_sum_channels_emcal{};
+  std::vector<unsigned int> m_sum_channels_hcal{};
+
+  //! peak minus pedestal, m_n_peak_samples consecutive samples per channel
+  std::vector<unsigned int> m_peak_sub_ped_emcal{};
+  std::vector<unsigned int> m_peak_sub_ped_hcalin{};
+  std::vector<unsigned int> m_peak_sub_ped_hcalout{};
+  int m_n_peak_samples{0};
+
+  //! samples of the waveform being processed
+  std::vector<int> m_waveform{};
 
   //! Verbosity.
   int m_nevent{0};
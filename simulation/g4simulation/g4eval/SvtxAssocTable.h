@@ -0,0 +1,110 @@
+#ifndef G4EVAL_SVTXASSOCTABLE_H
+#define G4EVAL_SVTXASSOCTABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <utility>
+#include <vector>
+
+/**
+ * Flat one-to-many association table, used by the svtx evaluators to
+ * store the per-event cluster, g4hit, particle and track associations.
+ *
+ * (key, value) pairs are collected with add() and packed by build() into a
+ * sorted key array and an offset array pointing into a single value array,
+ * so that a lookup is one binary search and returns a contiguous range.
+ * Values of a key are sorted and unique, which is the iteration order of
+ * the std::set they replace. Keys registered with add_key() are present even
+ * if they have no value.
+ */
+template <class Key, class Value>
+class SvtxAssocTable
+{
+ public:
+  //! [first, second) values of a key
+  using range = std::pair<const Value*, const Value*>;
+
+  void clear()
+  {
+    m_pairs.clear();
+    m_keys.clear();
+    m_offsets.clear();
+    m_values.clear();
+  }
+
+  void add_key(const Key& key) { m_keys.push_back(key); }
+  void add(const Key& key, const Value& value) { m_pairs.emplace_back(key, value); }
+
+  //! sort the collected pairs and pack them. Must be called before any lookup
+  void build()
+  {
+    std::sort(m_pairs.begin(), m_pairs.end());
+    m_pairs.erase(std::unique(m_pairs.begin(), m_pairs.end()), m_pairs.end());
+
+    for (const auto& pair : m_pairs)
+    {
+      m_keys.push_back(pair.first);
+    }
+    std::sort(m_keys.begin(), m_keys.end());
+    m_keys.erase(std::unique(m_keys.begin(), m_keys.end()), m_keys.end());
+
+    m_offsets.assign(m_keys.size() + 1, 0);
+    m_values.clear();
+    m_values.reserve(m_pairs.size());
+    std::size_t ikey = 0;
+    for (const auto& [key, value] : m_pairs)
+    {
+      // pairs and keys are both sorted, skip the keys without values
+      while (m_keys[ikey] < key)
+      {
+        m_offsets[++ikey] = m_values.size();
+      }
+      m_values.push_back(value);
+    }
+    while (ikey < m_keys.size())
+    {
+      m_offsets[++ikey] = m_values.size();
+    }
+
+    m_pairs.clear();
+  }
+
+  bool contains(const Key& key) const
+  {
+    return std::binary_search(m_keys.begin(), m_keys.end(), key);
+  }
+
+  //! values of a key, empty if the key is not in the table
+  range find(const Key& key) const
+  {
+    const auto iter = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+    if (iter == m_keys.end() || key < *iter)
+    {
+      return range(nullptr, nullptr);
+    }
+    const std::size_t ikey = iter - m_keys.begin();
+    return range(m_values.data() + m_offsets[ikey], m_values.data() + m_offsets[ikey + 1]);
+  }
+
+  //! values of a key as a set
+  std::set<Value> get_set(const Key& key) const
+  {
+    const auto [first, last] = find(key);
+    return std::set<Value>(first, last);
+  }
+
+  std::size_t size() const { return m_keys.size(); }
+  bool empty() const { return m_keys.empty(); }
+
+ private:
+  //! pairs collected before build()
+  std::vector<std::pair<Key, Value>> m_pairs;
+
+  //! sorted keys, values of m_keys[i] span [m_offsets[i], m_offsets[i+1]) in m_values
+  std::vector<Key> m_keys;
+  std::vector<std::size_t> m_offsets;
+  std::vector<Value> m_values;
+};
+
+#endif  // G4EVAL_SVTXASSOCTABLE_H
@@ -24,6 +24,7 @@
 
 #include <TVector3.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
@@ -50,21 +51,20 @@ SvtxClusterEval::~SvtxClusterEval()
 
 void SvtxClusterEval::next_event(PHCompositeNode* topNode)
 {
-  _cache_all_truth_hits.clear();
   _cache_all_truth_clusters.clear();
   _cache_max_truth_hit_by_energy.clear();
   _cache_max_truth_cluster_by_energy.clear();
-  _cache_all_truth_particles.clear();
   _cache_max_truth_particle_by_energy.clear();
   _cache_max_truth_particle_by_cluster_energy.clear();
-  _cache_all_clusters_from_particle.clear();
-  _cache_all_clusters_from_g4hit.clear();
   _cache_best_cluster_from_g4hit.clear();
   _cache_get_energy_contribution_g4particle.clear();
   _cache_get_energy_contribution_g4hit.clear();
   _cache_best_cluster_from_gtrackid_layer.clear();
-  _clusters_per_layer.clear();
-  //  _g4hits_per_layer.clear();
+  _tables_built = false;
+  _table_cluster_g4hits.clear();
+  _table_cluster_particles.clear();
+  _table_g4hit_clusters.clear();
+  _table_particle_clusters.clear();
   _hiteval.next_event(topNode);
 
   get_node_pointers(topNode);
@@ -346,70 +346,71 @@ std::set<PHG4Hit*> SvtxClusterEval::all_truth_hits(TrkrDefs::cluskey cluster_key
 
   if (_do_cache)
   {
-    std::map<TrkrDefs::cluskey, std::set<PHG4Hit*>>::iterator iter =
-        _cache_all_truth_hits.find(cluster_key);
-    if (iter != _cache_all_truth_hits.end())
+    const auto& table = get_cluster_g4hit_table();
+    if (table.contains(cluster_key))
     {
-      return iter->second;
+      return table.get_set(cluster_key);
     }
   }
 
-  std::set<PHG4Hit*> truth_hits;
+  // cluster not in the cluster map of the event
+  std::vector<PHG4Hit*> truth_hits;
+  fill_truth_hits(cluster_key, truth_hits);
+  return std::set<PHG4Hit*>(truth_hits.begin(), truth_hits.end());
+}
 
-  // get all truth hits for this cluster
-  //_cluster_hit_map->identify();
-  std::pair<std::multimap<TrkrDefs::cluskey, TrkrDefs::hitkey>::const_iterator, std::multimap<TrkrDefs::cluskey, TrkrDefs::hitkey>::const_iterator>
-      hitrange = _cluster_hit_map->getHits(cluster_key);  // returns range of pairs {cluster key, hit key} for this cluskey
+void SvtxClusterEval::fill_truth_hits(TrkrDefs::cluskey cluster_key, std::vector<PHG4Hit*>& truth_hits)
+{
+  // TrkrHitTruthAssoc uses a map with (hitsetkey, std::pair(hitkey, g4hitkey)) - get the hitsetkey from the cluskey
+  TrkrDefs::hitsetkey hitsetkey = TrkrDefs::getHitSetKeyFromClusKey(cluster_key);
 
-  for (std::multimap<TrkrDefs::cluskey, TrkrDefs::hitkey>::const_iterator
-           clushititer = hitrange.first;
-       clushititer != hitrange.second; ++clushititer)
+  PHG4HitContainer* g4hits = nullptr;
+  switch (TrkrDefs::getTrkrId(hitsetkey))
   {
-    TrkrDefs::hitkey hitkey = clushititer->second;
-    // TrkrHitTruthAssoc uses a map with (hitsetkey, std::pair(hitkey, g4hitkey)) - get the hitsetkey from the cluskey
-    TrkrDefs::hitsetkey hitsetkey = TrkrDefs::getHitSetKeyFromClusKey(cluster_key);
+  case TrkrDefs::tpcId:
+    g4hits = _g4hits_tpc;
+    break;
+  case TrkrDefs::inttId:
+    g4hits = _g4hits_intt;
+    break;
+  case TrkrDefs::mvtxId:
+    g4hits = _g4hits_mvtx;
+    break;
+  case TrkrDefs::micromegasId:
+    g4hits = _g4hits_mms;
+    break;
+  default:
+    break;
+  }
+  if (!g4hits)
+  {
+    return;
+  }
 
+  // get all truth hits for this cluster
+  std::multimap<TrkrDefs::hitsetkey, std::pair<TrkrDefs::hitkey, PHG4HitDefs::keytype>> temp_map;
+  const auto hitrange = _cluster_hit_map->getHits(cluster_key);  // returns range of pairs {cluster key, hit key} for this cluskey
+  for (auto clushititer = hitrange.first; clushititer != hitrange.second; ++clushititer)
+  {
     // get all of the g4hits for this hitkey
-    std::multimap<TrkrDefs::hitsetkey, std::pair<TrkrDefs::hitkey, PHG4HitDefs::keytype>> temp_map;
-    _hit_truth_map->getG4Hits(hitsetkey, hitkey, temp_map);
+    temp_map.clear();
+    _hit_truth_map->getG4Hits(hitsetkey, clushititer->second, temp_map);
     // returns pairs (hitsetkey, std::pair(hitkey, g4hitkey)) for this hitkey only
 
     for (auto& htiter : temp_map)
     {
-      // extract the g4 hit key here and add the hits to the set
-      PHG4HitDefs::keytype g4hitkey = htiter.second.second;
-      PHG4Hit* g4hit = nullptr;
-      unsigned int trkrid = TrkrDefs::getTrkrId(hitsetkey);
-      switch (trkrid)
-      {
-      case TrkrDefs::tpcId:
-        g4hit = _g4hits_tpc->findHit(g4hitkey);
-        break;
-      case TrkrDefs::inttId:
-        g4hit = _g4hits_intt->findHit(g4hitkey);
-        break;
-      case TrkrDefs::mvtxId:
-        g4hit = _g4hits_mvtx->findHit(g4hitkey);
-        break;
-      case TrkrDefs::micromegasId:
-        g4hit = _g4hits_mms->findHit(g4hitkey);
-        break;
-      default:
-        break;
-      }
+      // extract the g4 hit key here and add the hits to the list
+      PHG4Hit* g4hit = g4hits->findHit(htiter.second.second);
       if (g4hit)
       {
-        truth_hits.insert(g4hit);
+        truth_hits.push_back(g4hit);
       }
     }  // end loop over g4hits associated with hitsetkey and hitkey
   }  // end loop over hits associated with cluskey
 
-  if (_do_cache)
-  {
-    _cache_all_truth_hits.insert(std::make_pair(cluster_key, truth_hits));
-  }
-
-  return truth_hits;
+  // several hits of a cluster can come from the same g4hit
+  std::sort(truth_hits.begin(), truth_hits.end());
+  truth_hits.erase(std::unique(truth_hits.begin(), truth_hits.end()), truth_hits.end());
 }
 
 PHG4Hit* SvtxClusterEval::all_truth_hits_by_nhit(TrkrDefs::cluskey cluster_key)
@@ -788,11 +789,10 @@ std::set<PHG4Particle*> SvtxClusterEval::all_truth_particles(TrkrDefs::cluskey c
 
   if (_do_cache)
   {
-    std::map<TrkrDefs::cluskey, std::set<PHG4Particle*>>::iterator iter =
-        _cache_all_truth_particles.find(cluster_key);
-    if (iter != _cache_all_truth_particles.end())
+    const auto& table = get_cluster_particle_table();
+    if (table.contains(cluster_key))
     {
-      return iter->second;
+      return table.get_set(cluster_key);
     }
   }
 
@@ -803,7 +803,6 @@ std::set<PHG4Particle*> SvtxClusterEval::all_truth_particles(TrkrDefs::cluskey c
   for (auto* hit : g4hits)
   {
     PHG4Particle* particle = get_truth_eval()->get_particle(hit);
-    // std::cout << "cluster key " << cluster_key << " has hit " << hit->get_hit_id() << " and has particle " << particle->get_track_id() << std::endl;
 
     if (_strict)
     {
@@ -818,11 +817,6 @@ std::set<PHG4Particle*> SvtxClusterEval::all_truth_particles(TrkrDefs::cluskey c
     truth_particles.insert(particle);
   }
 
-  if (_do_cache)
-  {
-    _cache_all_truth_particles.insert(std::make_pair(cluster_key, truth_particles));
-  }
-
   return truth_particles;
 }
 
@@ -937,33 +931,54 @@ std::set<TrkrDefs::cluskey> SvtxClusterEval::all_clusters_from(PHG4Particle* tru
     ++_errors;
     return std::set<TrkrDefs::cluskey>();
   }
-  // check if cache is filled, if not fill it.
-  //   if(_cache_all_clusters_from_particle.count(truthparticle)==0){
-  if (_cache_all_clusters_from_particle.empty())
+
+  if (!_tables_built)
   {
-    FillRecoClusterFromG4HitCache();
+    build_tables();
   }
 
-  if (_do_cache)
+  return _table_particle_clusters.get_set(truthparticle);
+}
+
+void SvtxClusterEval::FillRecoClusterFromG4HitCache()
+{
+  if (!_tables_built)
   {
-    std::map<PHG4Particle*, std::set<TrkrDefs::cluskey>>::iterator iter =
-        _cache_all_clusters_from_particle.find(truthparticle);
-    if (iter != _cache_all_clusters_from_particle.end())
-    {
-      return iter->second;
-    }
+    build_tables();
   }
-  std::set<TrkrDefs::cluskey> clusters;
-  return clusters;
 }
 
-void SvtxClusterEval::FillRecoClusterFromG4HitCache()
+const SvtxAssocTable<TrkrDefs::cluskey, PHG4Hit*>& SvtxClusterEval::get_cluster_g4hit_table()
+{
+  if (!_tables_built && has_node_pointers())
+  {
+    build_tables();
+  }
+  return _table_cluster_g4hits;
+}
+
+const SvtxAssocTable<TrkrDefs::cluskey, PHG4Particle*>& SvtxClusterEval::get_cluster_particle_table()
+{
+  if (!_tables_built && has_node_pointers())
+  {
+    build_tables();
+  }
+  return _table_cluster_particles;
+}
+
+void SvtxClusterEval::build_tables()
 {
   auto Mytimer = std::make_unique<PHTimer>("ReCl_timer");
   Mytimer->stop();
   Mytimer->restart();
 
-  std::multimap<PHG4Particle*, TrkrDefs::cluskey> temp_clusters_from_particles;
+  _table_cluster_g4hits.clear();
+  _table_cluster_particles.clear();
+  _table_g4hit_clusters.clear();
+  _table_particle_clusters.clear();
+
+  std::vector<PHG4Hit*> truth_hits;
+
   // loop over all the clusters
   for (const auto& hitsetkey : _clustermap->getHitSetKeys())
   {
@@ -971,34 +986,56 @@ void SvtxClusterEval::FillRecoClusterFromG4HitCache()
     for (auto iter = range.first; iter != range.second; ++iter)
     {
       TrkrDefs::cluskey cluster_key = iter->first;
+      _table_cluster_g4hits.add_key(cluster_key);
+      _table_cluster_particles.add_key(cluster_key);
 
-      // loop over all truth particles connected to this cluster
-      std::set<PHG4Particle*> particles = all_truth_particles(cluster_key);
-      for (auto* candidate : particles)
+      // the truth hits are obtained from TrkrAssoc maps
+      truth_hits.clear();
+      fill_truth_hits(cluster_key, truth_hits);
+
+      if (_verbosity > 1)
       {
-        temp_clusters_from_particles.insert(std::make_pair(candidate, cluster_key));
+        std::cout << "SvtxClusterEval::build_tables - layer " << TrkrDefs::getLayer(cluster_key)
+                  << " cluster_key " << cluster_key
+                  << " g4hits " << truth_hits.size() << std::endl;
+      }
+
+      for (auto* g4hit : truth_hits)
+      {
+        _table_cluster_g4hits.add(cluster_key, g4hit);
+        _table_g4hit_clusters.add(g4hit, cluster_key);
+
+        PHG4Particle* particle = get_truth_eval()->get_particle(g4hit);
+        if (_strict)
+        {
+          assert(particle);
+        }
+        else if (!particle)
+        {
+          ++_errors;
+          continue;
+        }
+
+        _table_cluster_particles.add(cluster_key, particle);
+        _table_particle_clusters.add(particle, cluster_key);
       }
     }
   }
-  // Loop over particles and fill cache
-  PHG4TruthInfoContainer::ConstRange range = _truthinfo->GetParticleRange();
-  for (PHG4TruthInfoContainer::ConstIterator iter = range.first;
-       iter != range.second; ++iter)
-  {
-    PHG4Particle* g4particle = iter->second;
-    std::set<TrkrDefs::cluskey> clusters;
-    std::multimap<PHG4Particle*, TrkrDefs::cluskey>::const_iterator lower_bound = temp_clusters_from_particles.lower_bound(g4particle);
-    std::multimap<PHG4Particle*, TrkrDefs::cluskey>::const_iterator upper_bound = temp_clusters_from_particles.upper_bound(g4particle);
-    std::multimap<PHG4Particle*, TrkrDefs::cluskey>::const_iterator cfp_iter;
-    for (cfp_iter = lower_bound; cfp_iter != upper_bound; ++cfp_iter)
-    {
-      TrkrDefs::cluskey cluster_key = cfp_iter->second;
-      clusters.insert(cluster_key);
-    }
-    _cache_all_clusters_from_particle.insert(std::make_pair(g4particle, clusters));
-  }
+
+  _table_cluster_g4hits.build();
+  _table_cluster_particles.build();
+  _table_g4hit_clusters.build();
+  _table_particle_clusters.build();
+  _tables_built = true;
 
   Mytimer->stop();
+  if (_verbosity > 0)
+  {
+    std::cout << "SvtxClusterEval::build_tables - " << _table_cluster_g4hits.size() << " clusters, "
+              << _table_g4hit_clusters.size() << " g4hits, "
+              << _table_particle_clusters.size() << " particles in "
+              << Mytimer->elapsed() << " ms" << std::endl;
+  }
 }
 
 std::set<TrkrDefs::cluskey> SvtxClusterEval::all_clusters_from(PHG4Hit* truthhit)
@@ -1019,115 +1056,12 @@ std::set<TrkrDefs::cluskey> SvtxClusterEval::all_clusters_from(PHG4Hit* truthhit
     return std::set<TrkrDefs::cluskey>();
   }
 
-  // one time, fill cache of g4hit/cluster pairs
-  if (_cache_all_clusters_from_g4hit.empty())
-  {
-    // make a map of truthhit, cluster_key inside this loop
-    std::multimap<PHG4HitDefs::keytype, TrkrDefs::cluskey> truth_cluster_map;
-    std::set<PHG4HitDefs::keytype> all_g4hits_set;
-    std::map<PHG4HitDefs::keytype, PHG4Hit*> all_g4hits_map;
-
-    // get all reco clusters
-    if (_verbosity > 1)
-    {
-      std::cout << "all_clusters_from_g4hit: list all reco clusters " << std::endl;
-    }
-
-    for (const auto& hitsetkey : _clustermap->getHitSetKeys())
-    {
-      auto range = _clustermap->getClusters(hitsetkey);
-      for (auto iter = range.first; iter != range.second; ++iter)
-      {
-        TrkrDefs::cluskey cluster_key = iter->first;
-        int layer = TrkrDefs::getLayer(cluster_key);
-        TrkrCluster* clus = iter->second;
-        if (_verbosity > 1)
-        {
-          std::cout << " layer " << layer << " cluster_key " << cluster_key << " adc " << clus->getAdc()
-                    << " localx " << clus->getLocalX()
-                    << " localy " << clus->getLocalY()
-                    << std::endl;
-          std::cout << "  associated hits:";
-          std::pair<std::multimap<TrkrDefs::cluskey, TrkrDefs::hitkey>::const_iterator, std::multimap<TrkrDefs::cluskey, TrkrDefs::hitkey>::const_iterator>
-              hitrange = _cluster_hit_map->getHits(cluster_key);  // returns range of pairs {cluster key, hit key} for this cluskey
-          for (std::multimap<TrkrDefs::cluskey, TrkrDefs::hitkey>::const_iterator
-                   clushititer = hitrange.first;
-               clushititer != hitrange.second; ++clushititer)
-          {
-            TrkrDefs::hitkey hitkey = clushititer->second;
-            std::cout << " " << hitkey;
-          }
-          std::cout << std::endl;
-        }
-
-        // the returned truth hits were obtained from TrkrAssoc maps
-        std::set<PHG4Hit*> hits = all_truth_hits(cluster_key);
-        for (auto* candidate : hits)
-        {
-          PHG4HitDefs::keytype g4hit_key = candidate->get_hit_id();
-
-          if (_verbosity > 5)
-          {
-            int gtrackID = candidate->get_trkid();
-            std::cout << "   adding cluster with cluster_key " << cluster_key << " g4hit with g4hit_key " << g4hit_key
-                      << " gtrackID " << gtrackID
-                      << std::endl;
-          }
-
-          all_g4hits_set.insert(g4hit_key);
-          all_g4hits_map.insert(std::make_pair(g4hit_key, candidate));
-
-          truth_cluster_map.insert(std::make_pair(g4hit_key, cluster_key));
-        }
-      }
-    }
-
-    // now fill the cache
-    // loop over all entries in all_g4hits
-    for (unsigned long long g4hit_key : all_g4hits_set)
-    {
-      if (_verbosity > 5)
-      {
-        std::cout << " associations for g4hit_key " << g4hit_key << std::endl;
-      }
-
-      std::map<PHG4HitDefs::keytype, PHG4Hit*>::iterator it = all_g4hits_map.find(g4hit_key);
-      PHG4Hit* g4hit = it->second;
-
-      std::set<TrkrDefs::cluskey> assoc_clusters;
-
-      std::pair<std::multimap<PHG4HitDefs::keytype, TrkrDefs::cluskey>::iterator,
-                std::multimap<PHG4HitDefs::keytype, TrkrDefs::cluskey>::iterator>
-          ret = truth_cluster_map.equal_range(g4hit_key);
-      for (std::multimap<PHG4HitDefs::keytype, TrkrDefs::cluskey>::iterator jter = ret.first; jter != ret.second; ++jter)
-      {
-        assoc_clusters.insert(jter->second);
-
-        if (_verbosity > 5)
-        {
-          std::cout << "             g4hit_key " << g4hit_key << " associated with cluster_key " << jter->second << std::endl;
-        }
-      }
-      // done with this g4hit
-      _cache_all_clusters_from_g4hit.insert(std::make_pair(g4hit, assoc_clusters));
-    }
-  }
-
-  // get the clusters
-  std::set<TrkrDefs::cluskey> clusters;
-  std::map<PHG4Hit*, std::set<TrkrDefs::cluskey>>::iterator iter =
-      _cache_all_clusters_from_g4hit.find(truthhit);
-  if (iter != _cache_all_clusters_from_g4hit.end())
+  if (!_tables_built)
   {
-    return iter->second;
+    build_tables();
   }
 
-  if (_clusters_per_layer.empty())
-  {
-    fill_cluster_layer_map();
-  }
-
-  return clusters;
+  return _table_g4hit_clusters.get_set(truthhit);
 }
 
 TrkrDefs::cluskey SvtxClusterEval::best_cluster_by_nhit(int gid, int layer)
@@ -1385,41 +1319,6 @@ void SvtxClusterEval::get_node_pointers(PHCompositeNode* topNode)
   return;
 }
 
-void SvtxClusterEval::fill_cluster_layer_map()
-{
-  // loop over all the clusters
-  for (const auto& hitsetkey : _clustermap->getHitSetKeys())
-  {
-    auto range = _clustermap->getClusters(hitsetkey);
-    for (auto iter = range.first; iter != range.second; ++iter)
-    {
-      TrkrDefs::cluskey cluster_key = iter->first;
-      unsigned int ilayer = TrkrDefs::getLayer(cluster_key);
-      TrkrCluster* cluster = iter->second;
-      auto glob = getGlobalPosition(cluster_key, cluster);
-      float clus_phi = atan2(glob(1), glob(0));
-
-      std::multimap<unsigned int, innerMap>::iterator it = _clusters_per_layer.find(ilayer);
-      if (it == _clusters_per_layer.end())
-      {
-        it = _clusters_per_layer.insert(std::make_pair(ilayer, innerMap()));
-      }
-      it->second.insert(std::make_pair(clus_phi, cluster_key));
-
-      // address wrapping along +/-PI by filling larger area of the map
-      if (clus_phi - (-M_PI) < _clusters_searching_window)
-      {
-        it->second.insert(std::make_pair(clus_phi + 2 * M_PI, cluster_key));
-      }
-      if (M_PI - clus_phi < _clusters_searching_window)
-      {
-        it->second.insert(std::make_pair(clus_phi - 2 * M_PI, cluster_key));
-      }
-    }
-  }
-  return;
-}
-
 bool SvtxClusterEval::has_node_pointers()
 {
   if (_strict)
@@ -1,6 +1,7 @@
 #ifndef G4EVAL_SVTXCLUSTEREVAL_H
 #define G4EVAL_SVTXCLUSTEREVAL_H
 
+#include "SvtxAssocTable.h"
 #include "SvtxHitEval.h"
 
 #include <trackbase/ActsGeometry.h>
@@ -10,6 +11,7 @@
 #include <memory>  // for shared_ptr, less
 #include <set>
 #include <utility>
+#include <vector>
 
 class PHCompositeNode;
 
@@ -24,8 +26,6 @@ class TrkrClusterHitAssoc;
 class TrkrHitTruthAssoc;
 class SvtxTruthEval;
 
-typedef std::multimap<float, TrkrDefs::cluskey> innerMap;
-
 class SvtxClusterEval
 {
  public:
@@ -76,6 +76,11 @@ class SvtxClusterEval
   TrkrDefs::cluskey best_cluster_from(PHG4Hit* truthhit);
   TrkrDefs::cluskey best_cluster_by_nhit(int gid, int layer);
   void FillRecoClusterFromG4HitCache();
+
+  // truth association tables of all the clusters of the event, built on first use
+  const SvtxAssocTable<TrkrDefs::cluskey, PHG4Hit*>& get_cluster_g4hit_table();
+  const SvtxAssocTable<TrkrDefs::cluskey, PHG4Particle*>& get_cluster_particle_table();
+
   // overlap calculations
   float get_energy_contribution(TrkrDefs::cluskey cluster_key, PHG4Particle* truthparticle);
   float get_energy_contribution(TrkrDefs::cluskey cluster_key, PHG4Hit* g4hit);
@@ -86,10 +91,14 @@ class SvtxClusterEval
 
  private:
   void get_node_pointers(PHCompositeNode* topNode);
-  void fill_cluster_layer_map();
-  //  void fill_g4hit_layer_map();
   bool has_node_pointers();
 
+  //! one pass over all clusters to fill the association tables
+  void build_tables();
+
+  //! g4hits associated to a cluster through the hit and truth association maps
+  void fill_truth_hits(TrkrDefs::cluskey cluster_key, std::vector<PHG4Hit*>& truth_hits);
+
   //! Fast approximation of atan2() for cluster searching
   //! From https://www.dsprelated.com/showarticle/1052.php
   float fast_approx_atan2(float y, float x);
@@ -113,21 +122,24 @@ class SvtxClusterEval
   Acts::Vector3 getGlobalPosition(TrkrDefs::cluskey cluster_key, TrkrCluster* cluster);
 
   bool _do_cache = true;
-  std::map<TrkrDefs::cluskey, std::set<PHG4Hit*>> _cache_all_truth_hits;
   std::map<TrkrDefs::cluskey, std::map<TrkrDefs::cluskey, std::shared_ptr<TrkrCluster>>> _cache_all_truth_clusters;
   std::map<TrkrDefs::cluskey, PHG4Hit*> _cache_max_truth_hit_by_energy;
   std::map<TrkrDefs::cluskey, std::pair<TrkrDefs::cluskey, std::shared_ptr<TrkrCluster>>> _cache_max_truth_cluster_by_energy;
-  std::map<TrkrDefs::cluskey, std::set<PHG4Particle*>> _cache_all_truth_particles;
   std::map<TrkrDefs::cluskey, PHG4Particle*> _cache_max_truth_particle_by_energy;
   std::map<TrkrDefs::cluskey, PHG4Particle*> _cache_max_truth_particle_by_cluster_energy;
-  std::map<PHG4Particle*, std::set<TrkrDefs::cluskey>> _cache_all_clusters_from_particle;
-  std::map<PHG4Hit*, std::set<TrkrDefs::cluskey>> _cache_all_clusters_from_g4hit;
   std::map<PHG4Hit*, TrkrDefs::cluskey> _cache_best_cluster_from_g4hit;
   std::map<std::pair<int, int>, TrkrDefs::cluskey> _cache_best_cluster_from_gtrackid_layer;
   std::map<std::pair<TrkrDefs::cluskey, PHG4Particle*>, float> _cache_get_energy_contribution_g4particle;
   std::map<std::pair<TrkrDefs::cluskey, PHG4Hit*>, float> _cache_get_energy_contribution_g4hit;
   std::map<std::shared_ptr<TrkrCluster>, std::pair<TrkrDefs::cluskey, TrkrCluster*>> _cache_reco_cluster_from_truth_cluster;
 
+  //! cluster <-> g4hit <-> particle associations of all clusters in _clustermap
+  bool _tables_built = false;
+  SvtxAssocTable<TrkrDefs::cluskey, PHG4Hit*> _table_cluster_g4hits;
+  SvtxAssocTable<TrkrDefs::cluskey, PHG4Particle*> _table_cluster_particles;
+  SvtxAssocTable<PHG4Hit*, TrkrDefs::cluskey> _table_g4hit_clusters;
+  SvtxAssocTable<PHG4Particle*, TrkrDefs::cluskey> _table_particle_clusters;
+
   // measured for low occupancy events, all in cm
   const float sig_tpc_rphi_inner = 220e-04;
   const float sig_tpc_rphi_mid = 155e-04;
@@ -139,11 +151,6 @@ class SvtxClusterEval
   const float sig_mvtx_z = 4.7e-04;
   const float sig_mms_rphi_55 = 100e-04;
   const float sig_mms_z_56 = 200e-04;
-
-  //! cluster azimuthal searching window in _clusters_per_layer. Unit: rad
-  static constexpr float _clusters_searching_window = 0.1f;
-  std::multimap<unsigned int, innerMap> _clusters_per_layer;
-  //  std::multimap<unsigned int, PHG4Hit*> _g4hits_per_layer;
 };
 
 #endif  // G4EVAL_SVTXCLUSTEREVAL_H
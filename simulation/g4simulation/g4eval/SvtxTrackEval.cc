@@ -21,6 +21,7 @@
 #include <cfloat>
 #include <iostream>
 #include <set>
+#include <vector>
 
 SvtxTrackEval::SvtxTrackEval(PHCompositeNode* topNode)
   : _clustereval(topNode)
@@ -44,14 +45,15 @@ void SvtxTrackEval::next_event(PHCompositeNode* topNode)
   _cache_all_truth_hits.clear();
   _cache_all_truth_particles.clear();
   _cache_max_truth_particle_by_nclusters.clear();
-  _cache_all_tracks_from_particle.clear();
   _cache_best_track_from_particle.clear();
-  _cache_all_tracks_from_g4hit.clear();
-  _cache_all_tracks_from_cluster.clear();
   _cache_best_track_from_cluster.clear();
   _cache_get_nclusters_contribution.clear();
   _cache_get_nclusters_contribution_by_layer.clear();
   _cache_get_nwrongclusters_contribution.clear();
+  _tables_built = false;
+  _table_cluster_tracks.clear();
+  _table_particle_tracks.clear();
+  _table_g4trkid_tracks.clear();
   _clustereval.next_event(topNode);
 
   get_node_pointers(topNode);
@@ -86,6 +88,7 @@ std::set<PHG4Hit*> SvtxTrackEval::all_truth_hits(SvtxTrack* track)
 
   std::set<PHG4Hit*> truth_hits;
   std::vector<TrkrDefs::cluskey> cluster_keys = get_track_ckeys(track);
+  std::vector<PHG4Hit*> buffer;
 
   // loop over all clusters...
   for (const auto& cluster_key : cluster_keys)
@@ -100,12 +103,8 @@ std::set<PHG4Hit*> SvtxTrackEval::all_truth_hits(SvtxTrack* track)
     //      continue;
     //    }
 
-    std::set<PHG4Hit*> new_hits = _clustereval.all_truth_hits(cluster_key);
-
-    for (auto* new_hit : new_hits)
-    {
-      truth_hits.insert(new_hit);
-    }
+    const auto [first, last] = get_cluster_g4hits(cluster_key, buffer);
+    truth_hits.insert(first, last);
   }
 
   if (_do_cache)
@@ -170,6 +169,7 @@ std::set<PHG4Particle*> SvtxTrackEval::all_truth_particles(SvtxTrack* track)
   {
     // loop over all clusters...
     std::vector<TrkrDefs::cluskey> cluster_keys = get_track_ckeys(track);
+    std::vector<PHG4Particle*> buffer;
     for (const auto& cluster_key : cluster_keys)
     {
       //    if (_strict)
@@ -182,12 +182,8 @@ std::set<PHG4Particle*> SvtxTrackEval::all_truth_particles(SvtxTrack* track)
       //      continue;
       //    }
 
-      std::set<PHG4Particle*> new_particles = _clustereval.all_truth_particles(cluster_key);
-
-      for (auto* new_particle : new_particles)
-      {
-        truth_particles.insert(new_particle);
-      }
+      const auto [first, last] = get_cluster_particles(cluster_key, buffer);
+      truth_particles.insert(first, last);
     }
   }
 
@@ -308,12 +304,11 @@ std::set<SvtxTrack*> SvtxTrackEval::all_tracks_from(PHG4Particle* truthparticle)
 
   if (_do_cache)
   {
-    std::map<PHG4Particle*, std::set<SvtxTrack*> >::iterator iter =
-        _cache_all_tracks_from_particle.find(truthparticle);
-    if (iter != _cache_all_tracks_from_particle.end())
+    if (!_tables_built)
     {
-      return iter->second;
+      build_tables();
     }
+    return _table_particle_tracks.get_set(truthparticle->get_track_id());
   }
 
   std::set<SvtxTrack*> tracks;
@@ -348,11 +343,6 @@ std::set<SvtxTrack*> SvtxTrackEval::all_tracks_from(PHG4Particle* truthparticle)
     }
   }
 
-  if (_do_cache)
-  {
-    _cache_all_tracks_from_particle.insert(std::make_pair(truthparticle, tracks));
-  }
-
   return tracks;
 }
 
@@ -376,12 +366,11 @@ std::set<SvtxTrack*> SvtxTrackEval::all_tracks_from(PHG4Hit* truthhit)
 
   if (_do_cache)
   {
-    std::map<PHG4Hit*, std::set<SvtxTrack*> >::iterator iter =
-        _cache_all_tracks_from_g4hit.find(truthhit);
-    if (iter != _cache_all_tracks_from_g4hit.end())
+    if (!_tables_built)
     {
-      return iter->second;
+      build_tables();
     }
+    return _table_g4trkid_tracks.get_set(truthhit->get_trkid());
   }
 
   std::set<SvtxTrack*> tracks;
@@ -417,11 +406,6 @@ std::set<SvtxTrack*> SvtxTrackEval::all_tracks_from(PHG4Hit* truthhit)
     }
   }
 
-  if (_do_cache)
-  {
-    _cache_all_tracks_from_g4hit.insert(std::make_pair(truthhit, tracks));
-  }
-
   return tracks;
 }
 
@@ -497,6 +481,18 @@ void SvtxTrackEval::create_cache_track_from_cluster()
     return;
   }
 
+  build_tables();
+}
+
+void SvtxTrackEval::build_tables()
+{
+  _table_cluster_tracks.clear();
+  _table_particle_tracks.clear();
+  _table_g4trkid_tracks.clear();
+
+  std::vector<PHG4Hit*> hit_buffer;
+  std::vector<PHG4Particle*> particle_buffer;
+
   // loop over all SvtxTracks
   for (auto& iter : *_trackmap)
   {
@@ -504,37 +500,60 @@ void SvtxTrackEval::create_cache_track_from_cluster()
     std::vector<TrkrDefs::cluskey> cluster_keys = get_track_ckeys(track);
 
     // loop over all clusters
-    for (const auto& candidate_key : cluster_keys)
+    for (const auto& cluster_key : cluster_keys)
     {
-      // unsigned int cluster_layer = TrkrDefs::getLayer(candidate_key);
-      //      if (_strict)
-      //      {
-      //        assert(candidate_key);
-      //      }
-      //      else if (!candidate_key)
-      //      {
-      //        ++_errors;
-      //        continue;
-      //      }
+      _table_cluster_tracks.add(cluster_key, track);
 
-      // check if cluster has an entry in cache
-      std::map<TrkrDefs::cluskey, std::set<SvtxTrack*> >::iterator cliter =
-          _cache_all_tracks_from_cluster.find(candidate_key);
-      if (cliter != _cache_all_tracks_from_cluster.end())
-      {                                // got entry
-        cliter->second.insert(track);  // add track to list;
+      const auto [first_hit, last_hit] = get_cluster_g4hits(cluster_key, hit_buffer);
+      for (auto hit = first_hit; hit != last_hit; ++hit)
+      {
+        _table_g4trkid_tracks.add((*hit)->get_trkid(), track);
       }
-      else
+
+      const auto [first_particle, last_particle] = get_cluster_particles(cluster_key, particle_buffer);
+      for (auto particle = first_particle; particle != last_particle; ++particle)
       {
-        std::set<SvtxTrack*> tracks;
-        tracks.insert(track);
-        _cache_all_tracks_from_cluster.insert(std::make_pair(candidate_key, tracks));
+        _table_particle_tracks.add((*particle)->get_track_id(), track);
       }
     }
   }
-  _cache_track_from_cluster_exists = true;
 
-  return;
+  _table_cluster_tracks.build();
+  _table_particle_tracks.build();
+  _table_g4trkid_tracks.build();
+  _tables_built = true;
+}
+
+SvtxAssocTable<TrkrDefs::cluskey, PHG4Hit*>::range SvtxTrackEval::get_cluster_g4hits(TrkrDefs::cluskey cluster_key, std::vector<PHG4Hit*>& buffer)
+{
+  if (_do_cache)
+  {
+    const auto& table = _clustereval.get_cluster_g4hit_table();
+    if (table.contains(cluster_key))
+    {
+      return table.find(cluster_key);
+    }
+  }
+
+  const auto hits = _clustereval.all_truth_hits(cluster_key);
+  buffer.assign(hits.begin(), hits.end());
+  return std::make_pair(buffer.data(), buffer.data() + buffer.size());
+}
+
+SvtxAssocTable<TrkrDefs::cluskey, PHG4Particle*>::range SvtxTrackEval::get_cluster_particles(TrkrDefs::cluskey cluster_key, std::vector<PHG4Particle*>& buffer)
+{
+  if (_do_cache)
+  {
+    const auto& table = _clustereval.get_cluster_particle_table();
+    if (table.contains(cluster_key))
+    {
+      return table.find(cluster_key);
+    }
+  }
+
+  const auto particles = _clustereval.all_truth_particles(cluster_key);
+  buffer.assign(particles.begin(), particles.end());
+  return std::make_pair(buffer.data(), buffer.data() + buffer.size());
 }
 
 std::set<SvtxTrack*> SvtxTrackEval::all_tracks_from(TrkrDefs::cluskey cluster_key)
@@ -559,18 +578,11 @@ std::set<SvtxTrack*> SvtxTrackEval::all_tracks_from(TrkrDefs::cluskey cluster_ke
 
   if (_do_cache)
   {
-    if (_cache_track_from_cluster_exists == false)
-    {
-      create_cache_track_from_cluster();
-    }
-    std::map<TrkrDefs::cluskey, std::set<SvtxTrack*> >::iterator iter =
-        _cache_all_tracks_from_cluster.find(cluster_key);
-    if (iter != _cache_all_tracks_from_cluster.end())
+    if (!_tables_built)
     {
-      return iter->second;
+      build_tables();
     }
-
-    return tracks;
+    return _table_cluster_tracks.get_set(cluster_key);
   }
 
   // loop over all SvtxTracks
@@ -599,11 +611,6 @@ std::set<SvtxTrack*> SvtxTrackEval::all_tracks_from(TrkrDefs::cluskey cluster_ke
     }
   }
 
-  if (_do_cache)
-  {
-    _cache_all_tracks_from_cluster.insert(std::make_pair(cluster_key, tracks));
-  }
-
   return tracks;
 }
 
@@ -753,6 +760,7 @@ void SvtxTrackEval::calc_cluster_contribution(SvtxTrack* track, PHG4Particle* pa
   unsigned int nwrong = 0;
   // loop over all clusters
   std::vector<TrkrDefs::cluskey> cluster_keys = get_track_ckeys(track);
+  std::vector<PHG4Particle*> buffer;
   for (const auto& cluster_key : cluster_keys)
   {
     //    if (_strict)
@@ -766,10 +774,10 @@ void SvtxTrackEval::calc_cluster_contribution(SvtxTrack* track, PHG4Particle* pa
     //    }
     int matched = 0;
     // loop over all particles
-    std::set<PHG4Particle*> particles = _clustereval.all_truth_particles(cluster_key);
-    for (auto* candidate : particles)
+    const auto [first, last] = get_cluster_particles(cluster_key, buffer);
+    for (auto candidate = first; candidate != last; ++candidate)
     {
-      if (get_truth_eval()->are_same_particle(candidate, particle))
+      if (get_truth_eval()->are_same_particle(*candidate, particle))
       {
         ++nclusters;
         matched = 1;
@@ -825,6 +833,7 @@ unsigned int SvtxTrackEval::get_nclusters_contribution_by_layer(SvtxTrack* track
 
   // loop over all clusters
   std::vector<TrkrDefs::cluskey> cluster_keys = get_track_ckeys(track);
+  std::vector<PHG4Particle*> buffer;
   for (const auto& cluster_key : cluster_keys)
   {
     unsigned int cluster_layer = TrkrDefs::getLayer(cluster_key);
@@ -840,11 +849,10 @@ unsigned int SvtxTrackEval::get_nclusters_contribution_by_layer(SvtxTrack* track
     //    }
 
     // loop over all particles
-    std::set<PHG4Particle*> particles = _clustereval.all_truth_particles(cluster_key);
-
-    for (auto* candidate : particles)
+    const auto [first, last] = get_cluster_particles(cluster_key, buffer);
+    for (auto candidate = first; candidate != last; ++candidate)
     {
-      if (get_truth_eval()->are_same_particle(candidate, particle))
+      if (get_truth_eval()->are_same_particle(*candidate, particle))
       {
         layer_occupied[cluster_layer]++;
       }
@@ -892,6 +900,7 @@ std::pair<unsigned int, unsigned int> SvtxTrackEval::get_layer_range_contributio
   std::vector<int> layers_wrong(nlayers, 0);
   // loop over all clusters
   std::vector<TrkrDefs::cluskey> cluster_keys = get_track_ckeys(track);
+  std::vector<PHG4Particle*> buffer;
   for (const auto& cluster_key : cluster_keys)
   {
     unsigned int cluster_layer = TrkrDefs::getLayer(cluster_key);
@@ -915,11 +924,11 @@ std::pair<unsigned int, unsigned int> SvtxTrackEval::get_layer_range_contributio
     //    }
 
     // loop over all particles
-    std::set<PHG4Particle*> particles = _clustereval.all_truth_particles(cluster_key);
+    const auto [first, last] = get_cluster_particles(cluster_key, buffer);
     int matched = 0;
-    for (auto* candidate : particles)
+    for (auto candidate = first; candidate != last; ++candidate)
     {
-      if (get_truth_eval()->are_same_particle(candidate, particle))
+      if (get_truth_eval()->are_same_particle(*candidate, particle))
       {
         //	nmatches |= (0x3FFFFFFF & (0x1 << cluster_layer));
         layers[cluster_layer - start_layer] = 1;
@@ -1,6 +1,7 @@
 #ifndef G4EVAL_SVTXTRACKEVAL_H
 #define G4EVAL_SVTXTRACKEVAL_H
 
+#include "SvtxAssocTable.h"
 #include "SvtxClusterEval.h"
 
 #include <trackbase/TrkrDefs.h>
@@ -9,6 +10,7 @@
 #include <set>
 #include <string>  // for string
 #include <utility>
+#include <vector>
 
 class PHCompositeNode;
 
@@ -80,6 +82,13 @@ class SvtxTrackEval
   void get_node_pointers(PHCompositeNode* topNode);
   bool has_node_pointers();
 
+  //! one pass over all tracks to fill the association tables
+  void build_tables();
+
+  //! truth of a cluster, from the cluster eval tables when possible. buffer holds the values otherwise
+  SvtxAssocTable<TrkrDefs::cluskey, PHG4Hit*>::range get_cluster_g4hits(TrkrDefs::cluskey cluster_key, std::vector<PHG4Hit*>& buffer);
+  SvtxAssocTable<TrkrDefs::cluskey, PHG4Particle*>::range get_cluster_particles(TrkrDefs::cluskey cluster_key, std::vector<PHG4Particle*>& buffer);
+
   std::vector<TrkrDefs::cluskey> get_track_ckeys(SvtxTrack* track);
 
   SvtxClusterEval _clustereval;
@@ -93,18 +102,22 @@ class SvtxTrackEval
   unsigned int _errors = 0;
 
   bool _do_cache = true;
-  bool _cache_track_from_cluster_exists = false;
   std::map<SvtxTrack*, std::set<PHG4Hit*> > _cache_all_truth_hits;
   std::map<SvtxTrack*, std::set<PHG4Particle*> > _cache_all_truth_particles;
   std::map<SvtxTrack*, PHG4Particle*> _cache_max_truth_particle_by_nclusters;
-  std::map<PHG4Particle*, std::set<SvtxTrack*> > _cache_all_tracks_from_particle;
   std::map<PHG4Particle*, SvtxTrack*> _cache_best_track_from_particle;
-  std::map<PHG4Hit*, std::set<SvtxTrack*> > _cache_all_tracks_from_g4hit;
-  std::map<TrkrDefs::cluskey, std::set<SvtxTrack*> > _cache_all_tracks_from_cluster;
   std::map<TrkrDefs::cluskey, SvtxTrack*> _cache_best_track_from_cluster;
   std::map<std::pair<SvtxTrack*, PHG4Particle*>, unsigned int> _cache_get_nclusters_contribution;
   std::map<std::pair<SvtxTrack*, PHG4Particle*>, unsigned int> _cache_get_nclusters_contribution_by_layer;
   std::map<std::pair<SvtxTrack*, PHG4Particle*>, unsigned int> _cache_get_nwrongclusters_contribution;
+
+  //! cluster, particle and g4hit to track associations of all tracks in _trackmap.
+  //! particles and g4hits are keyed by their g4 track id
+  bool _tables_built = false;
+  SvtxAssocTable<TrkrDefs::cluskey, SvtxTrack*> _table_cluster_tracks;
+  SvtxAssocTable<int, SvtxTrack*> _table_particle_tracks;
+  SvtxAssocTable<int, SvtxTrack*> _table_g4trkid_tracks;
+
   std::string m_TrackNodeName = "SvtxTrackMap";
 };
 
@@ -31,10 +31,10 @@
 
 #include <trackbase/ActsGeometry.h>
 #include <trackbase/TrkrDefs.h>
+#include <trackbase/TrkrHit.h>
 #include <trackbase/TrkrHitSet.h>
 #include <trackbase/TrkrHitSetContainerv1.h>
 #include <trackbase/TrkrHitTruthAssocv1.h>
-#include <trackbase/TrkrHitv2.h>
 
 #include <TVector2.h>
 #include <TVector3.h>
@@ -381,13 +381,8 @@ int PHG4MicromegasHitReco::process_event(PHCompositeNode* topNode)
 
         // get hit from hitset
         TrkrDefs::hitkey hitkey = MicromegasDefs::genHitKey(strip);
-        auto* hit = hitset_it->second->getHit(hitkey);
-        if (!hit)
-        {
-          // create hit and insert in hitset
-          hit = new TrkrHitv2;
-          hitset_it->second->addHitSpecificKey(hitkey, hit);
-        }
+        // find existing hit, or create a new one
+        auto* hit = hitset_it->second->findOrAddHit(hitkey);
 
         // add energy from g4hit
         hit->addEnergy(pair.second);
@@ -947,15 +947,8 @@ void PHG4MvtxHitReco::addtruthhitset(
     return;
   }
   TrkrHitSetContainer::Iterator hitsetit = m_truth_hits->findOrAddHitSet(hitsetkey);
-  // See if this hit already exists
-  TrkrHit* hit = nullptr;
-  hit = hitsetit->second->getHit(hitkey);
-  if (!hit)
-  {
-    // create a new one
-    hit = new TrkrHitv2();
-    hitsetit->second->addHitSpecificKey(hitkey, hit);
-  }
+  // find existing hit, or create a new one
+  TrkrHit* hit = hitsetit->second->findOrAddHit(hitkey);
   // Either way, add the energy to it  -- adc values will be added at digitization
   hit->addEnergy(neffelectrons);
 }
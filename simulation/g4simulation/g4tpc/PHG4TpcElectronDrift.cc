@@ -15,6 +15,7 @@
 #include <trackbase/TrkrHit.h>  // for TrkrHit
 #include <trackbase/TrkrHitSet.h>
 #include <trackbase/TrkrHitSetContainerv1.h>
+#include <trackbase/TrkrHitSetContainerv3.h>
 #include <trackbase/TrkrHitTruthAssoc.h>  // for TrkrHitTruthA...
 #include <trackbase/TrkrHitTruthAssocv1.h>
 #include <trackbase/TrkrHitv2.h>
@@ -61,6 +62,7 @@
 
 #include <array>
 #include <cassert>
+#include <chrono>
 #include <cmath>    // for sqrt, abs, NAN
 #include <cstdlib>  // for exit
 #include <format>
@@ -80,8 +82,8 @@ namespace
 PHG4TpcElectronDrift::PHG4TpcElectronDrift(const std::string &name)
   : SubsysReco(name)
   , PHParameterInterface(name)
-  , temp_hitsetcontainer(new TrkrHitSetContainerv1)
-  , single_hitsetcontainer(new TrkrHitSetContainerv1)
+  , temp_hitsetcontainer(new TrkrHitSetContainerv3)
+  , single_hitsetcontainer(new TrkrHitSetContainerv3)
 {
   InitializeParameters();
   RandomGenerator.reset(gsl_rng_alloc(gsl_rng_mt19937));
@@ -446,11 +448,28 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
   // if there is a big jump (such as crossing into the INTT area or out of the TPC)
   // then cluster the truth clusters before adding a new hit. This prevents
   // clustering loopers in the same HitSetKey surfaces in multiple passes
+
+  // batched drift: g4hits are drifted ahead in blocks, block_end is the first g4hit not drifted yet
+  auto block_end = hit_begin_end.first;
+  std::size_t iblock = 0;
   for (auto hiter = hit_begin_end.first; hiter != hit_begin_end.second; ++hiter)
   {
     count_g4hits++;
     dump_counter++;
 
+    const DriftedG4Hit *drifted = nullptr;
+    if (m_batched_drift)
+    {
+      if (hiter == block_end)
+      {
+        const auto block_start = std::chrono::steady_clock::now();
+        block_end = drift_block(hiter, hit_begin_end.second, layergeom->get_drift_velocity_sim(), ihit);
+        iblock = 0;
+        m_drift_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - block_start).count();
+      }
+      drifted = &m_electron_block.hits[iblock++];
+    }
+
     const double t0 = std::fmax(hiter->second->get_t(0), hiter->second->get_t(1));
     if (t0 > max_time)
     {
@@ -515,7 +534,8 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
     // drifted electrons, then copy to the node tree later
 
     double eion = hiter->second->get_eion();
-    unsigned int n_electrons = gsl_ran_poisson(RandomGenerator.get(), eion * electrons_per_gev);
+    // in batched drift the number of electrons was drawn with the block, in the same order
+    unsigned int n_electrons = drifted ? drifted->n_electrons : gsl_ran_poisson(RandomGenerator.get(), eion * electrons_per_gev);
     //    count_electrons += n_electrons;
 
     if (Verbosity() > 100)
@@ -546,9 +566,20 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
                 << " radius " << sqrt(pow(hiter->second->get_x(1), 2) + pow(hiter->second->get_y(1), 2)) << std::endl;
     }
 
+    const auto drift_start = std::chrono::steady_clock::now();
     int notReachingReadout = 0;
+    if (drifted)
+    {
+      notReachingReadout = drifted->notReachingReadout;
+      padplane->MapPreparedToPadPlane(truth_clusterer, single_hitsetcontainer.get(),
+                                      temp_hitsetcontainer.get(), hittruthassoc, drifted->begin, drifted->end,
+                                      hiter, ntpad, nthit);
+    }
+
+    // the batched drift has already drifted all the electrons of the g4hit, otherwise they are drifted one by one
+    const unsigned int n_single_electrons = drifted ? 0 : n_electrons;
     //    int notInAcceptance = 0;
-    for (unsigned int i = 0; i < n_electrons; i++)
+    for (unsigned int i = 0; i < n_single_electrons; i++)
     {
       // We choose the electron starting position at random from a flat
       // distribution along the path length the parameter t is the fraction of
@@ -698,6 +729,8 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
                               temp_hitsetcontainer.get(), hittruthassoc, x_final, y_final, t_final,
                               side, hiter, ntpad, nthit);
     }  // end loop over electrons for this g4hit
+    m_drift_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - drift_start).count();
+    ++m_drift_nhits;
 
     if (do_ElectronDriftQAHistos)
     {
@@ -884,10 +917,244 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
+PHG4HitContainer::ConstIterator PHG4TpcElectronDrift::drift_block(PHG4HitContainer::ConstIterator hiter, const PHG4HitContainer::ConstIterator hend, const double drift_velocity, double block_ihit)
+{
+  auto &block = m_electron_block;
+  block.clear();
+
+  // same g4hit selection and random number sequence as the g4hit loop in process_event
+  for (; hiter != hend && (block.hits.empty() || block.x_final.size() < m_block_electrons); ++hiter)
+  {
+    auto &drifted = block.hits.emplace_back();
+    drifted.begin = block.x_final.size();
+    const double t0 = std::fmax(hiter->second->get_t(0), hiter->second->get_t(1));
+    if (t0 <= max_time)
+    {
+      drifted.n_electrons = gsl_ran_poisson(RandomGenerator.get(), hiter->second->get_eion() * electrons_per_gev);
+      if (drifted.n_electrons > 0)
+      {
+        drifted.notReachingReadout = drift_electrons_batched(hiter, drifted.n_electrons, drift_velocity, block_ihit);
+        ++block_ihit;
+      }
+    }
+    drifted.end = block.x_final.size();
+  }
+
+  padplane->PrepareElectrons(block.x_final.size(), block.x_final.data(), block.y_final.data(), block.t_final.data(), block.side.data());
+  return hiter;
+}
+
+unsigned int PHG4TpcElectronDrift::drift_electrons_batched(PHG4HitContainer::ConstIterator hiter, const unsigned int n_electrons, const double drift_velocity, const double ihit)
+{
+  const PHG4Hit *g4hit = hiter->second;
+  auto &batch = m_electron_batch;
+  batch.resize(n_electrons);
+
+  // draw all random numbers for this g4hit in one go
+  gsl_rng *rng = RandomGenerator.get();
+  for (unsigned int i = 0; i < n_electrons; ++i)
+  {
+    batch.f[i] = gsl_rng_uniform(rng);
+    batch.ranphi[i] = gsl_rng_uniform(rng);
+    batch.rantrans[i] = gsl_ran_gaussian_ziggurat(rng, 1.0);
+    batch.rantime[i] = gsl_ran_gaussian_ziggurat(rng, 1.0);
+  }
+
+  // starting position, diffusion and drift time. No branches, so that this loop vectorizes
+  // diffusion and additional smearing are independent gaussians, drawn as one gaussian with the combined width
+  const double x0 = g4hit->get_x(0);
+  const double y0 = g4hit->get_y(0);
+  const double z0 = g4hit->get_z(0);
+  const double t0 = g4hit->get_t(0);
+  const double dx = g4hit->get_x(1) - x0;
+  const double dy = g4hit->get_y(1) - y0;
+  const double dz = g4hit->get_z(1) - z0;
+  const double dt = g4hit->get_t(1) - t0;
+  const double half_length = tpc_length / 2.;
+  const double trans2 = square(diffusion_trans);
+  const double smear_trans2 = square(added_smear_sigma_trans);
+  const double long2 = square(diffusion_long / drift_velocity);
+  const double smear_long2 = square(added_smear_sigma_long / drift_velocity);
+  for (unsigned int i = 0; i < n_electrons; ++i)
+  {
+    const double f = batch.f[i];
+    const double x_start = x0 + f * dx;
+    const double y_start = y0 + f * dy;
+    const double z_start = z0 + f * dz;
+    const double drift_length = half_length - std::abs(z_start);
+    const double rantrans = std::sqrt(trans2 * drift_length + smear_trans2) * batch.rantrans[i];
+    const double rantime = std::sqrt(long2 * drift_length + smear_long2) * batch.rantime[i];
+    const double ranphi = M_PI * (2. * batch.ranphi[i] - 1.);
+
+    batch.x_start[i] = x_start;
+    batch.y_start[i] = y_start;
+    batch.z_start[i] = z_start;
+    batch.t_start[i] = t0 + f * dt;
+    batch.rantrans[i] = rantrans;
+    batch.x_final[i] = x_start + rantrans * std::cos(ranphi);
+    batch.y_final[i] = y_start + rantrans * std::sin(ranphi);
+    batch.t_final[i] = batch.t_start[i] + drift_length / drift_velocity + rantime;
+  }
+
+  // time window, distortions and acceptance. Accepted electrons are appended to the block
+  auto &block = m_electron_block;
+  unsigned int notReachingReadout = 0;
+  for (unsigned int i = 0; i < n_electrons; ++i)
+  {
+    double t_final = batch.t_final[i];
+    if (t_final < min_time || t_final > max_time)
+    {
+      continue;
+    }
+
+    const double x_start = batch.x_start[i];
+    const double y_start = batch.y_start[i];
+    const double z_start = batch.z_start[i];
+    const double rantrans = batch.rantrans[i];
+
+    double z_final;
+    if (z_start < 0)
+    {
+      z_final = -half_length + t_final * drift_velocity;
+    }
+    else
+    {
+      z_final = half_length - t_final * drift_velocity;
+    }
+
+    const double radstart = std::sqrt(square(x_start) + square(y_start));
+    const double phistart = std::atan2(y_start, x_start);
+
+    double x_final = batch.x_final[i];
+    double y_final = batch.y_final[i];
+    double rad_final = std::sqrt(square(x_final) + square(y_final));
+    double phi_final = std::atan2(y_final, x_final);
+
+    if (do_ElectronDriftQAHistos)
+    {
+      z_startmap->Fill(z_start, radstart);
+      deltaphinodist->Fill(phistart, rantrans / rad_final);
+      deltarnodist->Fill(radstart, rantrans);
+    }
+
+    if (m_distortionMap)
+    {
+      const double reaches = m_distortionMap->get_reaches_readout(radstart, phistart, z_start);
+      if (reaches < thresholdforreachesreadout)
+      {
+        notReachingReadout++;
+        continue;
+      }
+
+      const double r_distortion = m_distortionMap->get_r_distortion(radstart, phistart, z_start);
+      const double phi_distortion = m_distortionMap->get_rphi_distortion(radstart, phistart, z_start) / radstart;
+      const double z_distortion = m_distortionMap->get_z_distortion(radstart, phistart, z_start);
+
+      rad_final += r_distortion;
+      phi_final += phi_distortion;
+      z_final += z_distortion;
+      if (z_start < 0)
+      {
+        t_final = (z_final + half_length) / drift_velocity;
+      }
+      else
+      {
+        t_final = (half_length - z_final) / drift_velocity;
+      }
+
+      x_final = rad_final * std::cos(phi_final);
+      y_final = rad_final * std::sin(phi_final);
+
+      if (do_ElectronDriftQAHistos)
+      {
+        const double phi_final_nodiff = phistart + phi_distortion;
+        const double rad_final_nodiff = radstart + r_distortion;
+        deltarnodiff->Fill(radstart, rad_final_nodiff - radstart);
+        deltaphinodiff->Fill(phistart, phi_final_nodiff - phistart);
+        deltaphivsRnodiff->Fill(radstart, phi_final_nodiff - phistart);
+        deltaRphinodiff->Fill(radstart, rad_final_nodiff * phi_final_nodiff - radstart * phistart);
+
+        hitmapstart->Fill(x_start, y_start);
+        hitmapend->Fill(x_final, y_final);
+        hitmapstart_z->Fill(z_start, radstart);
+        hitmapend_z->Fill(z_final, rad_final);
+        deltar->Fill(radstart, rad_final - radstart);
+        deltaphi->Fill(phistart, phi_final - phistart);
+        deltaz->Fill(z_start, z_distortion);
+      }
+    }
+
+    // remove electrons outside of our acceptance, with the same margins as the single electron drift
+    if (rad_final < min_active_radius - 2.0 || rad_final > max_active_radius + 1.0)
+    {
+      continue;
+    }
+
+    if (Verbosity() > 1000)
+    {
+      std::cout << "electron " << i << " g4hitid " << hiter->first << " f " << batch.f[i] << std::endl;
+      std::cout << "radstart " << radstart << " x_start: " << x_start
+                << ", y_start: " << y_start
+                << ",z_start: " << z_start
+                << " t_start " << batch.t_start[i]
+                << std::endl;
+      std::cout << "       rad_final " << rad_final << " x_final " << x_final
+                << " y_final " << y_final
+                << " z_final " << z_final << " t_final " << t_final
+                << " zdiff " << z_final - z_start << std::endl;
+    }
+
+    if (Verbosity() > 0)
+    {
+      assert(nt);
+      const double t_sigma = diffusion_long * std::sqrt(half_length - std::abs(z_start)) / drift_velocity;
+      nt->Fill(ihit, batch.t_start[i], t_final, t_sigma, rad_final, z_start, z_final);
+    }
+
+    block.x_final.push_back(x_final);
+    block.y_final.push_back(y_final);
+    block.t_final.push_back(t_final);
+    block.side.push_back((z_start > 0) ? 1 : 0);
+  }
+
+  return notReachingReadout;
+}
+
+void PHG4TpcElectronDrift::ElectronBatch::resize(std::size_t n)
+{
+  // vectors only grow, so that no memory is allocated once the largest g4hit has been seen
+  if (n <= f.size())
+  {
+    return;
+  }
+  for (auto *v : {&f, &ranphi, &rantrans, &rantime, &x_start, &y_start, &z_start, &t_start, &x_final, &y_final, &t_final})
+  {
+    v->resize(n);
+  }
+}
+
+void PHG4TpcElectronDrift::ElectronBlock::clear()
+{
+  // keeps the capacity, so that no memory is allocated once the largest block has been seen
+  hits.clear();
+  x_final.clear();
+  y_final.clear();
+  t_final.clear();
+  side.clear();
+}
+
 int PHG4TpcElectronDrift::End(PHCompositeNode * /*topNode*/)
 {
   if (Verbosity() > 0)
   {
+    std::cout << "PHG4TpcElectronDrift::End - " << (m_batched_drift ? "batched" : "single electron")
+              << " drift of " << m_drift_nhits << " g4hits took " << m_drift_time << " ms";
+    if (m_drift_time > 0)
+    {
+      std::cout << " (" << m_drift_nhits / m_drift_time * 1000. << " g4hits/s)";
+    }
+    std::cout << std::endl;
+
     assert(m_outf);
     assert(nt);
     assert(ntpad);
@@ -17,10 +17,12 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <fstream>
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 class PHG4TpcPadPlane;
 class PHG4TpcDistortion;
@@ -83,6 +85,19 @@ class PHG4TpcElectronDrift : public SubsysReco, public PHParameterInterface
   void set_zero_bfield_flag(bool flag) { zero_bfield = flag; };
   void set_zero_bfield_diffusion_factor(double f) { zero_bfield_diffusion_factor = f; };
   void use_PDG_gas_params() { m_use_PDG_gas_params = true; }
+
+  //! drift the electrons of each g4hit in one batch rather than one by one.
+  /*!
+   * random numbers are drawn for all electrons of the g4hit first, using the same generator (and seed),
+   * and the transverse and longitudinal smearing are each drawn as a single gaussian with the combined width.
+   * Results are statistically equivalent to, but not event by event identical with, the default path.
+   * They are reproducible for a given seed.
+   * Consecutive g4hits are drifted in blocks, and the pad plane prepares the electrons of a whole block at once
+   */
+  void set_batched_drift(bool flag = true) { m_batched_drift = flag; }
+
+  //! number of electrons after which a block of g4hits is closed in batched drift. A block has at least one g4hit
+  void set_batched_drift_block_electrons(std::size_t n) { m_block_electrons = n; }
   ClusHitsVerbosev1 *mClusHitsVerbose{nullptr};
 
  private:
@@ -142,6 +157,60 @@ class PHG4TpcElectronDrift : public SubsysReco, public PHParameterInterface
   bool do_getReachReadout{false};
   bool zero_bfield{false};
   bool m_use_PDG_gas_params{false};
+  bool m_batched_drift{false};
+  std::size_t m_block_electrons{100000};
+
+  //! drift the g4hits from hiter on, until m_block_electrons electrons are accepted, and prepare them on the pad plane.
+  //! ihit is the g4hit counter of the first g4hit. Returns the end of the block
+  PHG4HitContainer::ConstIterator drift_block(PHG4HitContainer::ConstIterator hiter, PHG4HitContainer::ConstIterator hend, const double drift_velocity, double ihit);
+
+  //! drift all electrons from one g4hit, append the accepted ones to the block. Return the number of electrons not reaching the readout
+  unsigned int drift_electrons_batched(PHG4HitContainer::ConstIterator hiter, const unsigned int n_electrons, const double drift_velocity, const double ihit);
+
+  //! per electron arrays for batched drift, reused from one g4hit to the next
+  struct ElectronBatch
+  {
+    std::vector<double> f;
+    std::vector<double> ranphi;
+    std::vector<double> rantrans;
+    std::vector<double> rantime;
+    std::vector<double> x_start;
+    std::vector<double> y_start;
+    std::vector<double> z_start;
+    std::vector<double> t_start;
+    std::vector<double> x_final;
+    std::vector<double> y_final;
+    std::vector<double> t_final;
+
+    void resize(std::size_t);
+  };
+  ElectronBatch m_electron_batch;
+
+  //! drifted g4hit in a block, with its range of accepted electrons
+  struct DriftedG4Hit
+  {
+    unsigned int n_electrons{0};
+    unsigned int notReachingReadout{0};
+    std::size_t begin{0};
+    std::size_t end{0};
+  };
+
+  //! accepted electrons of consecutive g4hits, given to the pad plane together
+  struct ElectronBlock
+  {
+    std::vector<DriftedG4Hit> hits;
+    std::vector<double> x_final;
+    std::vector<double> y_final;
+    std::vector<double> t_final;
+    std::vector<unsigned int> side;
+
+    void clear();
+  };
+  ElectronBlock m_electron_block;
+
+  //! time spent drifting electrons (ms) and number of drifted g4hits, printed at End
+  double m_drift_time{0};
+  unsigned long m_drift_nhits{0};
 
   std::unique_ptr<TrkrHitSetContainer> temp_hitsetcontainer;
   std::unique_ptr<TrkrHitSetContainer> single_hitsetcontainer;
@@ -8,6 +8,7 @@
 
 #include <phparameter/PHParameterInterface.h>
 
+#include <cstddef>
 #include <string>  // for string
 
 class TrkrHitSetContainer;
@@ -32,10 +33,36 @@ class PHG4TpcPadPlane : public SubsysReco, public PHParameterInterface
   virtual void UpdateInternalParameters() { return; }
   //  virtual void MapToPadPlane(PHG4CellContainer * /*g4cells*/, const double /*x_gem*/, const double /*y_gem*/, const double /*t_gem*/, const unsigned int /*side*/, PHG4HitContainer::ConstIterator /*hiter*/, TNtuple * /*ntpad*/, TNtuple * /*nthit*/) {}
   virtual void MapToPadPlane(TpcClusterBuilder & /*builder*/, TrkrHitSetContainer * /*single_hitsetcontainer*/, TrkrHitSetContainer * /*hitsetcontainer*/, TrkrHitTruthAssoc * /*hittruthassoc*/, const double /*x_gem*/, const double /*y_gem*/, const double /*t_gem*/, const unsigned int /*side*/, PHG4HitContainer::ConstIterator /*hiter*/, TNtuple * /*ntpad*/, TNtuple * /*nthit*/) = 0;  // { return {}; }
+
+  //! batch of n electrons, possibly from several g4hits, mapped later with MapPreparedToPadPlane.
+  //! The arrays must stay valid until the next call. By default nothing is computed ahead of the mapping
+  virtual void PrepareElectrons(const std::size_t /*n*/, const double *x_gem, const double *y_gem, const double *t_gem, const unsigned int *side)
+  {
+    m_prepared_x_gem = x_gem;
+    m_prepared_y_gem = y_gem;
+    m_prepared_t_gem = t_gem;
+    m_prepared_side = side;
+  }
+
+  //! map electrons [begin, end) of the last prepared batch, all from the same g4hit. By default, maps electrons one by one
+  virtual void MapPreparedToPadPlane(TpcClusterBuilder &builder, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer, TrkrHitTruthAssoc *hittruthassoc, const std::size_t begin, const std::size_t end, PHG4HitContainer::ConstIterator hiter, TNtuple *ntpad, TNtuple *nthit)
+  {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      MapToPadPlane(builder, single_hitsetcontainer, hitsetcontainer, hittruthassoc, m_prepared_x_gem[i], m_prepared_y_gem[i], m_prepared_t_gem[i], m_prepared_side[i], hiter, ntpad, nthit);
+    }
+  }
   void Detector(const std::string &name) { detector = name; }
 
  protected:
   std::string detector;
+
+ private:
+  //! last prepared batch, not owned
+  const double *m_prepared_x_gem = nullptr;
+  const double *m_prepared_y_gem = nullptr;
+  const double *m_prepared_t_gem = nullptr;
+  const unsigned int *m_prepared_side = nullptr;
 };
 
 #endif
@@ -9,6 +9,7 @@
 #include <g4main/PHG4HitContainer.h>
 
 #include <phool/PHRandomSeed.h>
+#include <phool/PHWorkerPool.h>
 #include <phool/getClass.h>
 
 #include <cdbobjects/CDBTTree.h>
@@ -20,7 +21,6 @@
 #include <trackbase/TrkrHit.h>   // for TrkrHit
 #include <trackbase/TrkrHitSet.h>
 #include <trackbase/TrkrHitSetContainer.h>
-#include <trackbase/TrkrHitv2.h>  // for TrkrHit
 
 #include <g4tracking/TrkrTruthTrack.h>
 #include <g4tracking/TrkrTruthTrackContainer.h>
@@ -37,11 +37,15 @@
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_rng.h>  // for gsl_rng_alloc
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>  // for getenv
 #include <format>
 #include <iostream>
 #include <map>      // for _Rb_tree_cons...
+#include <memory>
+#include <sstream>
+#include <thread>
 #include <utility>  // for pair
 
 class PHCompositeNode;
@@ -69,6 +73,20 @@ namespace
     return std::exp(-square(x / sigma) / 2) / (sigma * std::sqrt(2 * M_PI));
   }
 
+  /*
+  fraction of the charge on a pad at distance x_loc of the electron.
+  this corresponds to integrating the charge distribution Gaussian function (centered on rphi and of width sigma),
+  convoluted with a strip response function, which is triangular from -pitch to +pitch, with a maximum of 1. at stript center
+  */
+  double strip_overlap(const double x_loc, const double pitch, const double sigma)
+  {
+    return (pitch - x_loc) * (std::erf(x_loc / (M_SQRT2 * sigma)) - std::erf((x_loc - pitch) / (M_SQRT2 * sigma))) / (pitch * 2) + (pitch + x_loc) * (std::erf((x_loc + pitch) / (M_SQRT2 * sigma)) - std::erf(x_loc / (M_SQRT2 * sigma))) / (pitch * 2) + (gaus(x_loc - pitch, sigma) - gaus(x_loc, sigma)) * square(sigma) / pitch + (gaus(x_loc + pitch, sigma) - gaus(x_loc, sigma)) * square(sigma) / pitch;
+  }
+
+  //! number of points in the overlap tables
+  constexpr int overlap_table_points = 4096;
+  constexpr int time_table_points = 1024;
+
   constexpr unsigned int print_layer = 18;
 
 }  // namespace
@@ -107,6 +125,43 @@ int PHG4TpcPadPlaneReadout::InitRun(PHCompositeNode *topNode)
   const std::string seggeonodename = "TPCGEOMCONTAINER";
   GeomContainer = findNode::getClass<PHG4TpcGeomContainer>(topNode, seggeonodename);
   assert(GeomContainer);
+
+  // readout layer table, so that the geometry container is not searched for every electron
+  m_layers.clear();
+  PHG4TpcGeomContainer::ConstRange layerrange = GeomContainer->get_begin_end();
+  for (PHG4TpcGeomContainer::ConstIterator layeriter = layerrange.first;
+       layeriter != layerrange.second;
+       ++layeriter)
+  {
+    LayerReadout &layer = m_layers.emplace_back();
+    layer.geom = layeriter->second;
+    layer.layer = layer.geom->get_layer();
+    layer.rad_low = layer.geom->get_radius() - layer.geom->get_thickness() / 2.0;
+    layer.rad_high = layer.geom->get_radius() + layer.geom->get_thickness() / 2.0;
+    layer.phi_bin_width = layer.geom->get_phistep();
+    layer.sector_min_phi = layer.geom->get_sector_min_phi();
+    layer.sector_max_phi = layer.geom->get_sector_max_phi();
+  }
+
+  if (m_use_overlap_tables)
+  {
+    make_overlap_tables();
+  }
+
+  // persistent worker pool for batches of electrons, reused for all events
+  if (m_num_threads != 1 && !m_workerpool)
+  {
+    unsigned int nthreads = m_num_threads;
+    if (nthreads == 0)
+    {
+      nthreads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    m_workerpool = std::make_unique<PHWorkerPool>(nthreads);
+    if (Verbosity() > 0)
+    {
+      std::cout << "PHG4TpcPadPlaneReadout::InitRun - using " << m_workerpool->size() << " worker threads" << std::endl;
+    }
+  }
   
   PHG4TpcGeom *layergeom =  GeomContainer->GetLayerCellGeom(20);  // z geometry is the same for all layers
   double tpc_adc_clock = layergeom->get_adc_clock();
@@ -304,17 +359,105 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
     PHG4HitContainer::ConstIterator hiter, TNtuple * /*ntpad*/, TNtuple * /*nthit*/)
 {
   // One electron per call of this method
+  ElectronShares shares;
+  compute_shares(x_gem, y_gem, t_gem, side, shares, std::cout);
+  m_single_hits.clear();
+  fill_hits(shares, m_single_hits);
+  add_charge(tpc_truth_clusterer, single_hitsetcontainer, hitsetcontainer, shares, m_single_hits.data(), hiter);
+}
+
+void PHG4TpcPadPlaneReadout::PrepareElectrons(const std::size_t n, const double *x_gem, const double *y_gem, const double *t_gem, const unsigned int *side)
+{
+  if (m_shares.size() < n)
+  {
+    m_shares.resize(n);
+  }
+
+  // layer, pad and time bin shares do not depend on the random generator, they are computed
+  // for contiguous ranges of electrons, each range filling its own buffer of pad and time bin shares.
+  // A few ranges per thread even out the load
+  std::size_t nchunks = 1;
+  if (m_workerpool && n > 1)
+  {
+    nchunks = std::min<std::size_t>(n, 4 * m_workerpool->size());
+  }
+  if (m_hit_buffers.size() < nchunks)
+  {
+    m_hit_buffers.resize(nchunks);
+  }
+  const std::size_t chunksize = (n + nchunks - 1) / nchunks;
+
+  auto prepare_chunk = [&](std::size_t ichunk, std::ostream &os)
+  {
+    auto &buffer = m_hit_buffers[ichunk];
+    buffer.clear();
+    const std::size_t end = std::min(n, (ichunk + 1) * chunksize);
+    for (std::size_t i = ichunk * chunksize; i < end; ++i)
+    {
+      compute_shares(x_gem[i], y_gem[i], t_gem[i], side[i], m_shares[i], os);
+      m_shares[i].buffer = ichunk;
+      fill_hits(m_shares[i], buffer);
+    }
+  };
+
+  if (nchunks == 1)
+  {
+    prepare_chunk(0, std::cout);
+  }
+  else if (Verbosity() > 0)
+  {
+    // diagnostics are collected per range and printed in electron order once all ranges are done
+    std::vector<std::ostringstream> messages(nchunks);
+    m_workerpool->run(nchunks, [&](unsigned int /*worker*/, std::size_t ichunk)
+                      { prepare_chunk(ichunk, messages[ichunk]); });
+    for (const auto &message : messages)
+    {
+      std::cout << message.str();
+    }
+  }
+  else
+  {
+    // nothing is printed at verbosity 0
+    m_workerpool->run(nchunks, [&](unsigned int /*worker*/, std::size_t ichunk)
+                      { prepare_chunk(ichunk, std::cout); });
+  }
+}
+
+void PHG4TpcPadPlaneReadout::MapPreparedToPadPlane(
+    TpcClusterBuilder &tpc_truth_clusterer,
+    TrkrHitSetContainer *single_hitsetcontainer,
+    TrkrHitSetContainer *hitsetcontainer,
+    TrkrHitTruthAssoc * /*hittruthassoc*/,
+    const std::size_t begin, const std::size_t end,
+    PHG4HitContainer::ConstIterator hiter, TNtuple * /*ntpad*/, TNtuple * /*nthit*/)
+{
+  // gain and charge collection in electron order, so that random numbers and energy sums
+  // are the same as when mapping the electrons one by one, whatever the number of threads
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    const auto &shares = m_shares[i];
+    add_charge(tpc_truth_clusterer, single_hitsetcontainer, hitsetcontainer, shares, m_hit_buffers[shares.buffer].data() + shares.hits_begin, hiter);
+  }
+}
+
+void PHG4TpcPadPlaneReadout::compute_shares(const double x_gem, const double y_gem, const double t_gem, const unsigned int side, ElectronShares &shares, std::ostream &os) const
+{
   // The x_gem and y_gem values have already been randomized within the transverse drift diffusion width
   // The t_gem value already reflects the drift time of the primary electron from the production point, and is randomized within the longitudinal diffusion witdth
-
-  double phi = atan2(y_gem, x_gem);
-  if (phi > +M_PI)
+  shares.layer = nullptr;
+  shares.side = side;
+  shares.t_gem = t_gem;
+  shares.npads = 0;
+  shares.ntbins = 0;
+
+  double phi_gem = atan2(y_gem, x_gem);
+  if (phi_gem > +M_PI)
   {
-    phi -= 2 * M_PI;
+    phi_gem -= 2 * M_PI;
   }
-  if (phi < -M_PI)
+  if (phi_gem < -M_PI)
   {
-    phi += 2 * M_PI;
+    phi_gem += 2 * M_PI;
   }
 
   double rad_gem = get_r(x_gem, y_gem);
@@ -344,52 +487,25 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
     }
   }
 
-  unsigned int layernum = 0;
-  /* TpcClusterBuilder pass_data {}; */
-
   // Find which readout layer this electron ends up in
-
-  PHG4TpcGeomContainer::ConstRange layerrange = GeomContainer->get_begin_end();
-  for (PHG4TpcGeomContainer::ConstIterator layeriter = layerrange.first;
-       layeriter != layerrange.second;
-       ++layeriter)
+  for (const auto &layer : m_layers)
   {
-    double rad_low = layeriter->second->get_radius() - layeriter->second->get_thickness() / 2.0;
-    double rad_high = layeriter->second->get_radius() + layeriter->second->get_thickness() / 2.0;
-
-    if (rad_gem > rad_low && rad_gem < rad_high)
+    if (rad_gem > layer.rad_low && rad_gem < layer.rad_high)
     {
-      // capture the layer where this electron hits the gem stack
-      LayerGeom = layeriter->second;
-
-      layernum = LayerGeom->get_layer();
-      /* pass_data.layerGeom = LayerGeom; */
-      /* pass_data.layer = layernum; */
-      if (Verbosity() > 1000)
-      {
-        std::cout << " g4hit id " << hiter->first << " rad_gem " << rad_gem << " rad_low " << rad_low << " rad_high " << rad_high
-                  << " layer  " << hiter->second->get_layer() << " want to change to " << layernum << std::endl;
-      }
-      hiter->second->set_layer(layernum);  // have to set here, since the stepping action knows nothing about layers
+      shares.layer = &layer;
     }
   }
 
-  if (layernum == 0)
+  if (!shares.layer)
   {
     return;
   }
 
-  // store phi bins and tbins upfront to avoid repetitive checks on the phi methods
-  const auto phibins = LayerGeom->get_phibins();
-  /* pass_data.nphibins = phibins; */
-
-  const auto tbins = LayerGeom->get_zbins();
-
-  sector_min_Phi = LayerGeom->get_sector_min_phi();
-  sector_max_Phi = LayerGeom->get_sector_max_phi();
-  phi_bin_width = LayerGeom->get_phistep();
-
-  phi = check_phi(side, phi, rad_gem);
+  const LayerReadout &layer = *shares.layer;
+  const unsigned int layernum = layer.layer;
+  const double phi = check_phi(layer, side, phi_gem, rad_gem);
+  shares.rad_gem = rad_gem;
+  shares.phi = phi;
 
   // Create the distribution function of charge on the pad plane around the electron position
 
@@ -398,6 +514,110 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
   // Use the setSigmaT(const double) method to update...
   // We use a double gaussian to represent the smearing due to the SAMPA chip shaping time - default values of fShapingLead and fShapingTail are for 80 ns SAMPA
 
+
+  // Distribute the charge between the pads in phi
+  //====================================
+
+  if (Verbosity() > 200)
+  {
+    os << "  populate phi bins for "
+              << " layernum " << layernum
+              << " phi " << phi
+              << " sigmaT " << sigmaT
+              //<< " zigzag_pads " << zigzag_pads
+              << std::endl;
+  }
+
+  populate_zigzag_phibins(layer, side, phi, sigmaT, shares, os);
+  /* if (pad_phibin.size() == 0) { */
+  /* pass_data.neff_electrons = 0; */
+  /* } else { */
+  /* pass_data.fillPhiBins(pad_phibin); */
+  /* } */
+
+  // Normalize the shares so they add up to 1
+  double norm1 = 0.0;
+  for (unsigned int ipad = 0; ipad < shares.npads; ++ipad)
+  {
+    double pad_share = shares.pad_phibin_share[ipad];
+    norm1 += pad_share;
+  }
+  for (unsigned int iphi = 0; iphi < shares.npads; ++iphi)
+  {
+    shares.pad_phibin_share[iphi] /= norm1;
+  }
+
+  // Distribute the charge between the pads in t
+  //====================================
+  if (Verbosity() > 100 && layernum == print_layer)
+    {
+      os << "  populate t bins for layernum " << layernum
+		<< " with t_gem " << t_gem << " SAMPA peaking time  " << Ts << std::endl;
+    }
+
+  sampaTimeDistribution(layer.geom, t_gem, shares, os);
+
+  /* if (adc_tbin.size() == 0)  { */
+  /* pass_data.neff_electrons = 0; */
+  /* } else { */
+  /* pass_data.fillTimeBins(adc_tbin); */
+  /* } */
+
+  // Normalize the shares so that they add up to 1
+  double tnorm = 0.0;
+  for (unsigned int it = 0; it < shares.ntbins; ++it)
+  {
+    double bin_share = shares.adc_tbin_share[it];
+    tnorm += bin_share;
+  }
+  for (unsigned int it = 0; it < shares.ntbins; ++it)
+  {
+    shares.adc_tbin_share[it] /= tnorm;
+  }
+
+  /*
+  if(layernum == print_layer)
+    {
+      std::cout << "t_gem " << t_gem << std::endl;
+      for (unsigned int it = 0; it < shares.ntbins; ++it)
+	{
+	  std::cout << " tbin " << shares.adc_tbin[it] << " share " << shares.adc_tbin_share[it] << std::endl;
+	}
+    }
+  */
+}
+
+void PHG4TpcPadPlaneReadout::add_charge(
+    TpcClusterBuilder &tpc_truth_clusterer,
+    TrkrHitSetContainer *single_hitsetcontainer,
+    TrkrHitSetContainer *hitsetcontainer,
+    const ElectronShares &shares,
+    const PadTimeShare *hits,
+    PHG4HitContainer::ConstIterator hiter)
+{
+  if (!shares.layer)
+  {
+    return;
+  }
+
+  const LayerReadout &layer = *shares.layer;
+  const unsigned int layernum = layer.layer;
+  const unsigned int side = shares.side;
+  const double rad_gem = shares.rad_gem;
+  const double phi = shares.phi;
+  const double t_gem = shares.t_gem;
+
+  if (Verbosity() > 1000)
+  {
+    std::cout << " g4hit id " << hiter->first << " rad_gem " << rad_gem << " rad_low " << layer.rad_low << " rad_high " << layer.rad_high
+              << " layer  " << hiter->second->get_layer() << " want to change to " << layernum << std::endl;
+  }
+  hiter->second->set_layer(layernum);  // have to set here, since the stepping action knows nothing about layers
+
+  // store phi bins and tbins upfront to avoid repetitive checks on the phi methods
+  const auto phibins = layer.geom->get_phibins();
+  const auto tbins = layer.geom->get_zbins();
+
   // amplify the single electron in the gem stack
   //===============================
 
@@ -484,82 +704,6 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
   // std::cout<<"PHG4TpcPadPlaneReadout::MapToPadPlane gain_weight = "<<gain_weight<<std::endl;
   /* pass_data.neff_electrons = nelec; */
 
-  // Distribute the charge between the pads in phi
-  //====================================
-
-  if (Verbosity() > 200)
-  {
-    std::cout << "  populate phi bins for "
-              << " layernum " << layernum
-              << " phi " << phi
-              << " sigmaT " << sigmaT
-              //<< " zigzag_pads " << zigzag_pads
-              << std::endl;
-  }
-
-  std::vector<int> pad_phibin;
-  std::vector<double> pad_phibin_share;
-
-  populate_zigzag_phibins(side, layernum, phi, sigmaT, pad_phibin, pad_phibin_share);
-  /* if (pad_phibin.size() == 0) { */
-  /* pass_data.neff_electrons = 0; */
-  /* } else { */
-  /* pass_data.fillPhiBins(pad_phibin); */
-  /* } */
-
-  // Normalize the shares so they add up to 1
-  double norm1 = 0.0;
-  for (unsigned int ipad = 0; ipad < pad_phibin.size(); ++ipad)
-  {
-    double pad_share = pad_phibin_share[ipad];
-    norm1 += pad_share;
-  }
-  for (unsigned int iphi = 0; iphi < pad_phibin.size(); ++iphi)
-  {
-    pad_phibin_share[iphi] /= norm1;
-  }
-
-  // Distribute the charge between the pads in t
-  //====================================
-  if (Verbosity() > 100 && layernum == print_layer)
-    {
-      std::cout << "  populate t bins for layernum " << layernum
-		<< " with t_gem " << t_gem << " SAMPA peaking time  " << Ts << std::endl;
-    }
-
-  std::vector<int> adc_tbin;
-  std::vector<double> adc_tbin_share;
-  sampaTimeDistribution(t_gem, adc_tbin, adc_tbin_share);
-
-  /* if (adc_tbin.size() == 0)  { */
-  /* pass_data.neff_electrons = 0; */
-  /* } else { */
-  /* pass_data.fillTimeBins(adc_tbin); */
-  /* } */
-
-  // Normalize the shares so that they add up to 1
-  double tnorm = 0.0;
-  for (unsigned int it = 0; it < adc_tbin.size(); ++it)
-  {
-    double bin_share = adc_tbin_share[it];
-    tnorm += bin_share;
-  }
-  for (unsigned int it = 0; it < adc_tbin.size(); ++it)
-  {
-    adc_tbin_share[it] /= tnorm;
-  }
-
-  /*
-  if(layernum == print_layer)
-    {
-      std::cout << "t_gem " << t_gem << std::endl;
-      for (unsigned int it = 0; it < adc_tbin.size(); ++it)
-	{
-	  std::cout << " tbin " << adc_tbin[it] << " share " << adc_tbin_share[it] << std::endl;
-	}
-    }
-  */
-  
   // Fill HitSetContainer
   //===============
   // These are used to do a quick clustering for checking
@@ -567,121 +711,97 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
   double t_integral = 0.0;
   double weight = 0.0;
 
-  for (unsigned int ipad = 0; ipad < pad_phibin.size(); ++ipad)
+  // last hitsets used
+  bool has_hitset = false;
+  TrkrDefs::hitsetkey current_hitsetkey = 0;
+  TrkrHitSetContainer::Iterator hitsetit;
+  TrkrHitSetContainer::Iterator single_hitsetit;
+
+  // pad and time bin shares, in pad then time bin order
+  for (unsigned int ihit = 0; ihit < shares.nhits; ++ihit)
   {
-    int pad_num = pad_phibin[ipad];
-    double pad_share = pad_phibin_share[ipad];
+    const PadTimeShare &padtime = hits[ihit];
+    const int pad_num = padtime.pad;
+    const int tbin_num = padtime.tbin;
 
-    for (unsigned int it = 0; it < adc_tbin.size(); ++it)
+    // Divide electrons from avalanche between bins
+    float neffelectrons = nelec * (padtime.pad_share) * (padtime.adc_bin_share);
+    if (neffelectrons < neffelectrons_threshold)
     {
-      int tbin_num = adc_tbin[it];
-      double adc_bin_share = adc_tbin_share[it];
-
-      // Divide electrons from avalanche between bins
-      float neffelectrons = nelec * (pad_share) * (adc_bin_share);
-      if (neffelectrons < neffelectrons_threshold)
-      {
-        continue;  // skip signals that will be below the noise suppression threshold
-      }
+      continue;  // skip signals that will be below the noise suppression threshold
+    }
 
-      if (tbin_num >= tbins)
-      {
-        std::cout << " Error making key: adc_tbin " << tbin_num << " ntbins " << tbins << std::endl;
-      }
-      if (pad_num >= phibins)
-      {
-        std::cout << " Error making key: pad_phibin " << pad_num << " nphibins " << phibins << std::endl;
-      }
+    if (tbin_num >= tbins)
+    {
+      std::cout << " Error making key: adc_tbin " << tbin_num << " ntbins " << tbins << std::endl;
+    }
+    if (pad_num >= phibins)
+    {
+      std::cout << " Error making key: pad_phibin " << pad_num << " nphibins " << phibins << std::endl;
+    }
 
-      // collect information to do simple clustering. Checks operation of PHG4CylinderCellTpcReco, and
-      // is also useful for comparison with PHG4TpcClusterizer result when running single track events.
-      // The only information written to the cell other than neffelectrons is tbin and pad number, so get those from geometry
-      double tcenter = LayerGeom->get_zcenter(tbin_num);
-      double phicenter = LayerGeom->get_phicenter(pad_num, side);
+    // collect information to do simple clustering. Checks operation of PHG4CylinderCellTpcReco, and
+    // is also useful for comparison with PHG4TpcClusterizer result when running single track events.
+    // The only information written to the cell other than neffelectrons is tbin and pad number, so get those from geometry
+    if (Verbosity() > 1)
+    {
+      double tcenter = layer.geom->get_zcenter(tbin_num);
+      double phicenter = layer.geom->get_phicenter(pad_num, side);
       phi_integral += phicenter * neffelectrons;
       t_integral += tcenter * neffelectrons;
       weight += neffelectrons;
-      if (Verbosity() > 1 && layernum == print_layer)
+      if (layernum == print_layer)
       {
         std::cout << "   tbin_num " << tbin_num << " tcenter " << tcenter << " pad_num " << pad_num << " phicenter " << phicenter
                   << " neffelectrons " << neffelectrons << " neffelectrons_threshold " << neffelectrons_threshold << std::endl;
       }
+    }
 
-      // new containers
-      //============
-      // We add the Tpc TrkrHitsets directly to the node using hitsetcontainer
-      // We need to create the TrkrHitSet if not already made - each TrkrHitSet should correspond to a Tpc readout module
-      // The hitset key includes the layer, sector, side
-
-      // The side is an input parameter
-
-      // get the Tpc readout sector - there are 12 sectors with how many pads each?
-      unsigned int pads_per_sector = phibins / 12;
-      unsigned int sector = pad_num / pads_per_sector;
-      TrkrDefs::hitsetkey hitsetkey = TpcDefs::genHitSetKey(layernum, sector, side);
-      // Use existing hitset or add new one if needed
-      TrkrHitSetContainer::Iterator hitsetit = hitsetcontainer->findOrAddHitSet(hitsetkey);
-      TrkrHitSetContainer::Iterator single_hitsetit = single_hitsetcontainer->findOrAddHitSet(hitsetkey);
-      TrkrDefs::hitkey hitkey;
+    // new containers
+    //============
+    // We add the Tpc TrkrHitsets directly to the node using hitsetcontainer
+    // We need to create the TrkrHitSet if not already made - each TrkrHitSet should correspond to a Tpc readout module
+    // The hitset key includes the layer, sector, side, see fill_hits
+    const TrkrDefs::hitsetkey hitsetkey = padtime.hitsetkey;
+    // Use existing hitset or add new one if needed. All pads of an electron but those across a sector boundary share the same hitset
+    if (!has_hitset || hitsetkey != current_hitsetkey)
+    {
+      hitsetit = hitsetcontainer->findOrAddHitSet(hitsetkey);
+      single_hitsetit = single_hitsetcontainer->findOrAddHitSet(hitsetkey);
+      current_hitsetkey = hitsetkey;
+      has_hitset = true;
+    }
 
-      if (m_maskDeadChannels)
-      {
-        hitkey = TpcDefs::genHitKey((unsigned int) pad_num, 0);
-        if (m_deadChannelMap.contains(hitsetkey) &&
-            std::find(m_deadChannelMap[hitsetkey].begin(), m_deadChannelMap[hitsetkey].end(), hitkey) != m_deadChannelMap[hitsetkey].end())
-        {
-          continue;
-        }
-      }
-      if (m_maskHotChannels)
-      {
-        hitkey = TpcDefs::genHitKey((unsigned int) pad_num, 0);
-        if (m_hotChannelMap.contains(hitsetkey) &&
-            std::find(m_hotChannelMap[hitsetkey].begin(), m_hotChannelMap[hitsetkey].end(), hitkey) != m_hotChannelMap[hitsetkey].end())
-        {
-          continue;
-        }
-      }
-      // generate the key for this hit, requires tbin and phibin
-      hitkey = TpcDefs::genHitKey((unsigned int) pad_num, (unsigned int) tbin_num);
+    // dead and hot channels
+    if (padtime.masked)
+    {
+      continue;
+    }
 
-      // See if this hit already exists
-      TrkrHit *hit = nullptr;
-      hit = hitsetit->second->getHit(hitkey);
-      if (!hit)
-      {
-        // create a new one
-        hit = new TrkrHitv2();
-        hitsetit->second->addHitSpecificKey(hitkey, hit);
-      }
-      // Either way, add the energy to it  -- adc values will be added at digitization
-      hit->addEnergy(neffelectrons);
+    // generate the key for this hit, requires tbin and phibin
+    const TrkrDefs::hitkey hitkey = TpcDefs::genHitKey((unsigned int) pad_num, (unsigned int) tbin_num);
 
-      tpc_truth_clusterer.addhitset(hitsetkey, hitkey, neffelectrons);
+    // find existing hit, or create a new one
+    TrkrHit *hit = hitsetit->second->findOrAddHit(hitkey);
+    // Either way, add the energy to it  -- adc values will be added at digitization
+    hit->addEnergy(neffelectrons);
 
-      // repeat for the single_hitsetcontainer
-      // See if this hit already exists
-      TrkrHit *single_hit = nullptr;
-      single_hit = single_hitsetit->second->getHit(hitkey);
-      if (!single_hit)
-      {
-        // create a new one
-        single_hit = new TrkrHitv2();
-        single_hitsetit->second->addHitSpecificKey(hitkey, single_hit);
-      }
-      // Either way, add the energy to it  -- adc values will be added at digitization
-      single_hit->addEnergy(neffelectrons);
+    tpc_truth_clusterer.addhitset(hitsetkey, hitkey, neffelectrons);
 
-      /*
-      if (Verbosity() > 0)
-      {
-        assert(nthit);
-        nthit->Fill(layernum, pad_num, tbin_num, neffelectrons);
-      }
-      */
+    // repeat for the single_hitsetcontainer
+    // find existing hit, or create a new one
+    TrkrHit *single_hit = single_hitsetit->second->findOrAddHit(hitkey);
+    // Either way, add the energy to it  -- adc values will be added at digitization
+    single_hit->addEnergy(neffelectrons);
 
-    }  // end of loop over adc T bins
-  }  // end of loop over zigzag pads
+    /*
+    if (Verbosity() > 0)
+    {
+      assert(nthit);
+      nthit->Fill(layernum, pad_num, tbin_num, neffelectrons);
+    }
+    */
+  }  // end of loop over pad and time bin shares
   /* pass_data.phi_integral = phi_integral; */
   /* pass_data.time_integral = t_integral; */
 
@@ -715,7 +835,59 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
   m_NHits++;
   /* return pass_data; */
 }
-double PHG4TpcPadPlaneReadout::check_phi(const unsigned int side, const double phi, const double radius)
+
+void PHG4TpcPadPlaneReadout::fill_hits(ElectronShares &shares, std::vector<PadTimeShare> &buffer) const
+{
+  shares.hits_begin = buffer.size();
+  shares.nhits = 0;
+  if (!shares.layer)
+  {
+    return;
+  }
+
+  const LayerReadout &layer = *shares.layer;
+  const unsigned int side = shares.side;
+
+  // get the Tpc readout sector - there are 12 sectors with how many pads each?
+  const auto phibins = layer.geom->get_phibins();
+  unsigned int pads_per_sector = phibins / 12;
+
+  for (unsigned int ipad = 0; ipad < shares.npads; ++ipad)
+  {
+    const int pad_num = shares.pad_phibin[ipad];
+    unsigned int sector = pad_num / pads_per_sector;
+    const TrkrDefs::hitsetkey hitsetkey = TpcDefs::genHitSetKey(layer.layer, sector, side);
+
+    // channel masks do not depend on the time bin
+    bool masked = false;
+    if (m_maskDeadChannels || m_maskHotChannels)
+    {
+      const TrkrDefs::hitkey hitkey = TpcDefs::genHitKey((unsigned int) pad_num, 0);
+      masked = (m_maskDeadChannels && is_masked(m_deadChannelMap, hitsetkey, hitkey)) ||
+               (m_maskHotChannels && is_masked(m_hotChannelMap, hitsetkey, hitkey));
+    }
+
+    for (unsigned int it = 0; it < shares.ntbins; ++it)
+    {
+      PadTimeShare &padtime = buffer.emplace_back();
+      padtime.hitsetkey = hitsetkey;
+      padtime.pad = pad_num;
+      padtime.tbin = shares.adc_tbin[it];
+      padtime.pad_share = shares.pad_phibin_share[ipad];
+      padtime.adc_bin_share = shares.adc_tbin_share[it];
+      padtime.masked = masked;
+    }
+  }
+  shares.nhits = buffer.size() - shares.hits_begin;
+}
+
+bool PHG4TpcPadPlaneReadout::is_masked(const hitMaskTpc &mask, TrkrDefs::hitsetkey hitsetkey, TrkrDefs::hitkey hitkey)
+{
+  const auto iter = mask.find(hitsetkey);
+  return iter != mask.end() && std::find(iter->second.begin(), iter->second.end(), hitkey) != iter->second.end();
+}
+
+double PHG4TpcPadPlaneReadout::check_phi(const LayerReadout &layer, const unsigned int side, const double phi, const double radius) const
 {
   double new_phi = phi;
   int p_region = -1;
@@ -734,27 +906,27 @@ double PHG4TpcPadPlaneReadout::check_phi(const unsigned int side, const double p
       double daPhi = 0;
       if (s == 0)
       {
-        daPhi = fabs(sector_min_Phi[side][11] + 2 * M_PI - sector_max_Phi[side][s]);
+        daPhi = fabs(layer.sector_min_phi[side][11] + 2 * M_PI - layer.sector_max_phi[side][s]);
       }
       else
       {
-        daPhi = fabs(sector_min_Phi[side][s - 1] - sector_max_Phi[side][s]);
+        daPhi = fabs(layer.sector_min_phi[side][s - 1] - layer.sector_max_phi[side][s]);
       }
-      double min_phi = sector_max_Phi[side][s];
-      double max_phi = sector_max_Phi[side][s] + daPhi;
+      double min_phi = layer.sector_max_phi[side][s];
+      double max_phi = layer.sector_max_phi[side][s] + daPhi;
       if (new_phi <= max_phi && new_phi >= min_phi)
       {
         if (fabs(max_phi - new_phi) > fabs(new_phi - min_phi))
         {
-          new_phi = min_phi - phi_bin_width / 5;
+          new_phi = min_phi - layer.phi_bin_width / 5;
         }
         else
         {
-          new_phi = max_phi + phi_bin_width / 5;
+          new_phi = max_phi + layer.phi_bin_width / 5;
         }
       }
     }
-    if (new_phi < sector_min_Phi[side][11] && new_phi >= -M_PI)
+    if (new_phi < layer.sector_min_phi[side][11] && new_phi >= -M_PI)
     {
       new_phi += 2 * M_PI;
     }
@@ -763,8 +935,10 @@ double PHG4TpcPadPlaneReadout::check_phi(const unsigned int side, const double p
   return new_phi;
 }
 
-void PHG4TpcPadPlaneReadout::populate_zigzag_phibins(const unsigned int side, const unsigned int layernum, const double phi, const double cloud_sig_rp, std::vector<int> &phibin_pad, std::vector<double> &phibin_pad_share)
+void PHG4TpcPadPlaneReadout::populate_zigzag_phibins(const LayerReadout &layer, const unsigned int side, const double phi, const double cloud_sig_rp, ElectronShares &shares, std::ostream &os) const
 {
+  const PHG4TpcGeom *LayerGeom = layer.geom;
+  const unsigned int layernum = layer.layer;
   const double radius = LayerGeom->get_radius();
   const double phistepsize = LayerGeom->get_phistep();
   const auto phibins = LayerGeom->get_phibins();
@@ -775,9 +949,9 @@ void PHG4TpcPadPlaneReadout::populate_zigzag_phibins(const unsigned int side, co
   {
     if (LayerGeom->get_layer() == print_layer)
     {
-      std::cout << " populate_zigzag_phibins for layer " << layernum << " with radius " << radius << " phi " << phi
+      os << " populate_zigzag_phibins for layer " << layernum << " with radius " << radius << " phi " << phi
                 << " rphi " << rphi << " phistepsize " << phistepsize << std::endl;
-      std::cout << " fcharge created: radius " << radius << " rphi " << rphi << " cloud_sig_rp " << cloud_sig_rp << std::endl;
+      os << " fcharge created: radius " << radius << " rphi " << rphi << " cloud_sig_rp " << cloud_sig_rp << std::endl;
     }
   }
 
@@ -786,8 +960,8 @@ void PHG4TpcPadPlaneReadout::populate_zigzag_phibins(const unsigned int side, co
   const double philim_high_calc = phi + (_nsigmas * cloud_sig_rp / radius) + phistepsize;
 
   // Find the pad range that covers this phi range
-  const double philim_low = check_phi(side, philim_low_calc, radius);
-  const double philim_high = check_phi(side, philim_high_calc, radius);
+  const double philim_low = check_phi(layer, side, philim_low_calc, radius);
+  const double philim_high = check_phi(layer, side, philim_high_calc, radius);
 
   int phibin_low = LayerGeom->get_phibin(philim_high, side);
   int phibin_high = LayerGeom->get_phibin(philim_low, side);
@@ -797,7 +971,7 @@ void PHG4TpcPadPlaneReadout::populate_zigzag_phibins(const unsigned int side, co
   {
     if (layernum == print_layer)
     {
-      std::cout << "           zigzags: phi " << phi << " philim_low " << philim_low << " phibin_low " << phibin_low
+      os << "           zigzags: phi " << phi << " philim_low " << philim_low << " phibin_low " << phibin_low
                 << " philim_high " << philim_high << " phibin_high " << phibin_high << " npads " << npads << std::endl;
     }
   }
@@ -851,7 +1025,7 @@ void PHG4TpcPadPlaneReadout::populate_zigzag_phibins(const unsigned int side, co
     {
       if (layernum == print_layer)
       {
-        std::cout << " zigzags: make fpad for ipad " << ipad << " pad_now " << pad_now << " pad_rphi/2 " << pad_rphi / 2.0
+        os << " zigzags: make fpad for ipad " << ipad << " pad_now " << pad_now << " pad_rphi/2 " << pad_rphi / 2.0
                   << " rphi_pad_now " << rphi_pad_now << std::endl;
       }
     }
@@ -891,19 +1065,15 @@ void PHG4TpcPadPlaneReadout::populate_zigzag_phibins(const unsigned int side, co
 
     const double x_loc = x_loc_tmp;
     // calculate fraction of the total charge on this strip
-    /*
-    this corresponds to integrating the charge distribution Gaussian function (centered on rphi and of width cloud_sig_rp),
-    convoluted with a strip response function, which is triangular from -pitch to +pitch, with a maximum of 1. at stript center
-    */
-    overlap[ipad] =
-        (pitch - x_loc) * (std::erf(x_loc / (M_SQRT2 * sigma)) - std::erf((x_loc - pitch) / (M_SQRT2 * sigma))) / (pitch * 2) + (pitch + x_loc) * (std::erf((x_loc + pitch) / (M_SQRT2 * sigma)) - std::erf(x_loc / (M_SQRT2 * sigma))) / (pitch * 2) + (gaus(x_loc - pitch, sigma) - gaus(x_loc, sigma)) * square(sigma) / pitch + (gaus(x_loc + pitch, sigma) - gaus(x_loc, sigma)) * square(sigma) / pitch;
+    overlap[ipad] = pad_overlap(layer, x_loc, pitch, sigma);
   }
 
   // now we have the overlap for each pad
+  shares.npads = npads + 1;
   for (int ipad = 0; ipad <= npads; ipad++)
   {
-    phibin_pad.push_back(pad_keep[ipad]);
-    phibin_pad_share.push_back(overlap[ipad]);
+    shares.pad_phibin[ipad] = pad_keep[ipad];
+    shares.pad_phibin_share[ipad] = overlap[ipad];
   }
 
   return;
@@ -1029,7 +1199,7 @@ void PHG4TpcPadPlaneReadout::makeChannelMask(hitMaskTpc &aMask, const std::strin
   delete cdbttree;
 }
 
-void PHG4TpcPadPlaneReadout::sampaTimeDistribution(double tzero,  std::vector<int> &adc_tbin, std::vector<double> &adc_tbin_share)
+void PHG4TpcPadPlaneReadout::sampaTimeDistribution(const PHG4TpcGeom *LayerGeom, double tzero, ElectronShares &shares, std::ostream &os) const
 {
   // tzero is the arrival time of the electron at the GEM
   // Ts is the sampa peaking time
@@ -1039,13 +1209,41 @@ void PHG4TpcPadPlaneReadout::sampaTimeDistribution(double tzero,  std::vector<in
   double tstepsize = LayerGeom->get_zstep();
   int tbinzero = LayerGeom->get_zbin(tzero);
 
+  // interpolated integrals, with the same time bins as below
+  if (!m_time_table.empty() && tstepsize == m_time_table_tstep)
+  {
+    const double delta = std::clamp(tzero - (LayerGeom->get_zcenter(tbinzero) - tstepsize / 2.0), 0.0, tstepsize);
+    const double u = delta / tstepsize * time_table_points;
+    const int ipoint = std::min(static_cast<int>(u), time_table_points - 1);
+    const double w = u - ipoint;
+    const double *low = &m_time_table[ipoint * max_tbins];
+    const double *high = low + max_tbins;
+    for (int iclock = 0; iclock < nclocks; ++iclock)
+    {
+      int tbin = tbinzero + iclock;
+      if (iclock > 0 && (tbin < 0 || tbin > LayerGeom->get_zbins()))
+      {
+        if (Verbosity() > 0)
+        {
+          os << " t bin " << tbin << " is outside range of " << LayerGeom->get_zbins() << " so skip it" << std::endl;
+        }
+        continue;
+      }
+      shares.adc_tbin[shares.ntbins] = tbin;
+      shares.adc_tbin_share[shares.ntbins] = low[iclock] * (1 - w) + high[iclock] * w;
+      ++shares.ntbins;
+    }
+    return;
+  }
+
   // the first clock bin is a special case
   double tfirst_end = LayerGeom->get_zcenter(tbinzero) + tstepsize/2.0;
   double vfirst_end =  sampaShapingResponseFunction(tzero, tfirst_end); 
   double first_integral = (vfirst_end / 2.0) * (tfirst_end - tzero);
     
-  adc_tbin.push_back(tbinzero);
-  adc_tbin_share.push_back(first_integral);
+  shares.adc_tbin[shares.ntbins] = tbinzero;
+  shares.adc_tbin_share[shares.ntbins] = first_integral;
+  ++shares.ntbins;
 
   /*
   if (LayerGeom->get_layer() == print_layer)
@@ -1062,7 +1260,7 @@ void PHG4TpcPadPlaneReadout::sampaTimeDistribution(double tzero,  std::vector<in
 	{
 	  if (Verbosity() > 0)
 	    {
-	      std::cout << " t bin " << tbin << " is outside range of " << LayerGeom->get_zbins() << " so skip it" << std::endl;
+	      os << " t bin " << tbin << " is outside range of " << LayerGeom->get_zbins() << " so skip it" << std::endl;
 	    }
 	  continue;
 	}
@@ -1091,11 +1289,71 @@ void PHG4TpcPadPlaneReadout::sampaTimeDistribution(double tzero,  std::vector<in
 	}
 
 	  
-      adc_tbin.push_back(tbin);
-      adc_tbin_share.push_back(sintegral);      
+      shares.adc_tbin[shares.ntbins] = tbin;
+      shares.adc_tbin_share[shares.ntbins] = sintegral;
+      ++shares.ntbins;
     }
 }
   
+void PHG4TpcPadPlaneReadout::sampa_bin_integrals(const double delta, const double tstepsize, double *integrals) const
+{
+  // same integrals as sampaTimeDistribution, for an electron arriving at tzero = 0, delta after the start of its time bin
+  const double tfirst_end = tstepsize - delta;
+  integrals[0] = (sampaShapingResponseFunction(0, tfirst_end) / 2.0) * tfirst_end;
+
+  const int nsamples = 6;
+  const double sample_step = tstepsize / (double) nsamples;
+  for (int iclock = 1; iclock < max_tbins; ++iclock)
+  {
+    const double tlow = iclock * tstepsize - delta;
+    double sintegral = 0;
+    for (int isample = 0; isample < nsamples; ++isample)
+    {
+      const double tnow = tlow + (double) isample * sample_step + sample_step / 2.0;
+      sintegral += sampaShapingResponseFunction(0, tnow) * sample_step;
+    }
+    integrals[iclock] = sintegral;
+  }
+}
+
+void PHG4TpcPadPlaneReadout::make_overlap_tables()
+{
+  // pad overlaps. Pads are assumed to touch the center of the next phi bin on both sides, see populate_zigzag_phibins.
+  // Beyond overlap_xmax the overlap is evaluated analytically
+  const double sigma = sigmaT;
+  for (auto &layer : m_layers)
+  {
+    const double pitch = layer.geom->get_phistep() * layer.geom->get_radius();
+    layer.overlap_xmax = _nsigmas * sigma + 2 * pitch;
+    layer.overlap_step = 2 * layer.overlap_xmax / overlap_table_points;
+    layer.overlap.resize(overlap_table_points + 1);
+    for (int i = 0; i <= overlap_table_points; ++i)
+    {
+      layer.overlap[i] = strip_overlap(-layer.overlap_xmax + i * layer.overlap_step, pitch, sigma);
+    }
+  }
+
+  // time bin integrals, the time bins are the same for all layers
+  m_time_table_tstep = m_layers.empty() ? 0 : m_layers.front().geom->get_zstep();
+  m_time_table.resize((time_table_points + 1) * max_tbins);
+  for (int i = 0; i <= time_table_points; ++i)
+  {
+    sampa_bin_integrals(i * m_time_table_tstep / time_table_points, m_time_table_tstep, &m_time_table[i * max_tbins]);
+  }
+}
+
+double PHG4TpcPadPlaneReadout::pad_overlap(const LayerReadout &layer, const double x_loc, const double pitch, const double sigma)
+{
+  if (layer.overlap.empty() || std::abs(x_loc) >= layer.overlap_xmax)
+  {
+    return strip_overlap(x_loc, pitch, sigma);
+  }
+  const double u = (x_loc + layer.overlap_xmax) / layer.overlap_step;
+  const int i = std::min(static_cast<int>(u), overlap_table_points - 1);
+  const double w = u - i;
+  return layer.overlap[i] * (1 - w) + layer.overlap[i + 1] * w;
+}
+
 double PHG4TpcPadPlaneReadout::sampaShapingResponseFunction(double tzero, double t) const
   {
     double v = exp(-4*(t-tzero)/Ts) * pow( (t-tzero)/Ts, 4.0);
@@ -11,6 +11,9 @@
 #include <array>
 #include <climits>
 #include <cmath>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
 #include <string>  // for string
 #include <vector>
 #include <map>
@@ -20,6 +23,7 @@ typedef std::map<TrkrDefs::hitsetkey, std::vector<TrkrDefs::hitkey>> hitMaskTpc;
 class PHCompositeNode;
 class PHG4TpcGeomContainer;
 class PHG4TpcGeom;
+class PHWorkerPool;
 class TH2;
 class TF1;
 class TNtuple;
@@ -48,6 +52,19 @@ class PHG4TpcPadPlaneReadout : public PHG4TpcPadPlane
 
   void MapToPadPlane(TpcClusterBuilder &tpc_truth_clusterer, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer, TrkrHitTruthAssoc * /*hittruthassoc*/, const double x_gem, const double y_gem, const double t_gem, const unsigned int side, PHG4HitContainer::ConstIterator hiter, TNtuple * /*ntpad*/, TNtuple * /*nthit*/) override;
 
+  //! pad and time shares, and the pads and time bins they go to, for a batch of electrons. Computed on the worker threads
+  void PrepareElectrons(const std::size_t n, const double *x_gem, const double *y_gem, const double *t_gem, const unsigned int *side) override;
+
+  //! amplify the prepared electrons [begin, end) and add their charge, in electron order
+  void MapPreparedToPadPlane(TpcClusterBuilder &tpc_truth_clusterer, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer, TrkrHitTruthAssoc * /*hittruthassoc*/, const std::size_t begin, const std::size_t end, PHG4HitContainer::ConstIterator hiter, TNtuple * /*ntpad*/, TNtuple * /*nthit*/) override;
+
+  //! number of worker threads used for batches of electrons. 1 (default) means no threads, 0 means one per hardware thread
+  void SetNumThreads(unsigned int nthreads) { m_num_threads = nthreads; }
+
+  //! interpolate the pad overlaps and SAMPA time bin integrals in tables built at InitRun, rather than evaluating them for every electron.
+  //! The relative difference to the analytic shares is below 1e-4
+  void SetUseOverlapTables(bool flag) { m_use_overlap_tables = flag; }
+
   void SetDefaultParameters() override;
   void UpdateInternalParameters() override;
  
@@ -67,18 +84,112 @@ class PHG4TpcPadPlaneReadout : public PHG4TpcPadPlane
   }
 
  private:
+  //! readout layer geometry, filled at InitRun
+  struct LayerReadout
+  {
+    PHG4TpcGeom *geom = nullptr;
+    unsigned int layer = 0;
+    double rad_low = 0;
+    double rad_high = 0;
+    double phi_bin_width = 0;
+    std::array<std::vector<double>, 2> sector_min_phi;
+    std::array<std::vector<double>, 2> sector_max_phi;
+
+    //! pad overlap as a function of the distance between electron and pad center, for |x| < overlap_xmax
+    std::vector<double> overlap;
+    double overlap_xmax = 0;
+    double overlap_step = 0;
+  };
+
+  //! pad and time bin receiving a fraction of the charge of one electron, in the order charges are added
+  struct PadTimeShare
+  {
+    TrkrDefs::hitsetkey hitsetkey = 0;
+    int pad = 0;
+    int tbin = 0;
+    double pad_share = 0;
+    double adc_bin_share = 0;
+    //! dead or hot channel
+    bool masked = false;
+  };
+
+  //! maximum number of pads and time bins sharing the charge of one electron
+  static constexpr int max_pads = 10;
+  static constexpr int max_tbins = 8;
+
+  //! normalized pad and time bin shares of one electron, before amplification
+  struct ElectronShares
+  {
+    //! nullptr if the electron is outside of all readout layers
+    const LayerReadout *layer = nullptr;
+    unsigned int side = 0;
+    double rad_gem = 0;
+    double phi = 0;
+    double t_gem = 0;
+
+    unsigned int npads = 0;
+    std::array<int, max_pads> pad_phibin{};
+    std::array<double, max_pads> pad_phibin_share{};
+
+    unsigned int ntbins = 0;
+    std::array<int, max_tbins> adc_tbin{};
+    std::array<double, max_tbins> adc_tbin_share{};
+
+    //! pad and time bin shares, in m_hit_buffers[buffer] starting at hits_begin
+    unsigned int buffer = 0;
+    std::size_t hits_begin = 0;
+    unsigned int nhits = 0;
+  };
+
+  //! find readout layer and charge shares for one electron. Does not modify the readout, can be called from any thread. Diagnostics go to os
+  void compute_shares(const double x_gem, const double y_gem, const double t_gem, const unsigned int side, ElectronShares &shares, std::ostream &os) const;
+
+  //! append the pad and time bin shares of one electron to buffer, with their hitset keys and channel masks. Can be called from any thread
+  void fill_hits(ElectronShares &shares, std::vector<PadTimeShare> &buffer) const;
+
+  //! true if the pad is in the channel mask
+  static bool is_masked(const hitMaskTpc &mask, TrkrDefs::hitsetkey hitsetkey, TrkrDefs::hitkey hitkey);
+
+  //! amplify one electron and add its charge to the hitsets. hits are the shares.nhits pad and time bin shares of the electron
+  void add_charge(TpcClusterBuilder &tpc_truth_clusterer, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer, const ElectronShares &shares, const PadTimeShare *hits, PHG4HitContainer::ConstIterator hiter);
+
+  //! fill the pad overlap and time bin integral tables
+  void make_overlap_tables();
+
+  //! pad overlap at distance x_loc of the pad center, from the layer table when available
+  static double pad_overlap(const LayerReadout &layer, const double x_loc, const double pitch, const double sigma);
+
+  //! SAMPA response integrals of the first max_tbins time bins for an electron arriving delta after the start of its time bin
+  void sampa_bin_integrals(const double delta, const double tstepsize, double *integrals) const;
+
   //  void populate_rectangular_phibins(const unsigned int layernum, const double phi, const double cloud_sig_rp, std::vector<int> &pad_phibin, std::vector<double> &pad_phibin_share);
-  void populate_zigzag_phibins(const unsigned int side, const unsigned int layernum, const double phi, const double cloud_sig_rp, std::vector<int> &phibin_pad, std::vector<double> &phibin_pad_share);
+  void populate_zigzag_phibins(const LayerReadout &layer, const unsigned int side, const double phi, const double cloud_sig_rp, ElectronShares &shares, std::ostream &os) const;
 
-  void sampaTimeDistribution(double tzero,  std::vector<int> &adc_tbin, std::vector<double> &adc_tbin_share);
+  void sampaTimeDistribution(const PHG4TpcGeom *layergeom, double tzero, ElectronShares &shares, std::ostream &os) const;
   double sampaShapingResponseFunction(double tzero, double t) const;
   
-  double check_phi(const unsigned int side, const double phi, const double radius);
+  double check_phi(const LayerReadout &layer, const unsigned int side, const double phi, const double radius) const;
 
   void makeChannelMask(hitMaskTpc& aMask, const std::string& dbName, const std::string& totalChannelsToMask);
 
   PHG4TpcGeomContainer *GeomContainer = nullptr;
-  PHG4TpcGeom *LayerGeom = nullptr;
+
+  //! readout layers, ordered as in the geometry container
+  std::vector<LayerReadout> m_layers;
+
+  //! worker threads for batches of electrons, per electron shares and per work item pad and time bin shares, reused from one batch to the next
+  unsigned int m_num_threads = 1;
+  std::unique_ptr<PHWorkerPool> m_workerpool;
+  std::vector<ElectronShares> m_shares;
+  std::vector<std::vector<PadTimeShare>> m_hit_buffers;
+
+  //! pad and time bin shares of the electrons mapped one by one
+  std::vector<PadTimeShare> m_single_hits;
+
+  //! SAMPA time bin integrals as a function of the arrival time in the time bin, max_tbins values per point
+  bool m_use_overlap_tables = false;
+  std::vector<double> m_time_table;
+  double m_time_table_tstep = 0;
 
   double neffelectrons_threshold {std::numeric_limits<double>::quiet_NaN()};
 
@@ -91,7 +202,6 @@ class PHG4TpcPadPlaneReadout : public PHG4TpcPadPlane
 
   double sigmaT {std::numeric_limits<double>::quiet_NaN()};
   std::array<double, 2> sigmaL{};
-  double phi_bin_width{};
 
   int NTBins {std::numeric_limits<int>::max()};
   int m_NHits {0};
@@ -111,9 +221,6 @@ class PHG4TpcPadPlaneReadout : public PHG4TpcPadPlane
   double averageGEMGain {std::numeric_limits<double>::quiet_NaN()};
   double polyaTheta {std::numeric_limits<double>::quiet_NaN()};
 
-  std::array<std::vector<double>, NSides> sector_min_Phi;
-  std::array<std::vector<double>, NSides> sector_max_Phi;
-
   // return random distribution of number of electrons after amplification of GEM for each initial ionizing electron
   double getSingleEGEMAmplification();
   double getSingleEGEMAmplification(double weight);
@@ -11,7 +11,6 @@
 #include <trackbase/TrkrHitSet.h>
 #include <trackbase/TrkrHitSetContainer.h>  // for TrkrHitSetContainer
 #include <trackbase/TrkrHitSetContainerv1.h>
-#include <trackbase/TrkrHitv2.h>  // for TrkrHit
 
 #include <g4main/PHG4Hit.h>
 #include <g4main/PHG4TruthInfoContainer.h>
@@ -136,15 +135,8 @@ void TruthClusterizerBase::addhitset(
     return;
   }
   TrkrHitSetContainer::Iterator hitsetit = m_hits->findOrAddHitSet(hitsetkey);
-  // See if this hit already exists
-  TrkrHit* hit = nullptr;
-  hit = hitsetit->second->getHit(hitkey);
-  if (!hit)
-  {
-    // create a new one
-    hit = new TrkrHitv2();
-    hitsetit->second->addHitSpecificKey(hitkey, hit);
-  }
+  // find existing hit, or create a new one
+  TrkrHit* hit = hitsetit->second->findOrAddHit(hitkey);
   // Either way, add the energy to it  -- adc values will be added at digitization
   hit->addEnergy(neffelectrons);
 }